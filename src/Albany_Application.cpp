@@ -5,6 +5,7 @@
 #include "Albany_Application.hpp"
 
 #include <string>
+#include <vector>
 
 #include "AAdapt_Erosion.hpp"
 #include "AAdapt_RC_Manager.hpp"
@@ -12,13 +13,16 @@
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_DummyParameterAccessor.hpp"
+#include "Albany_FieldManagerScalarResponseFunction.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
 #include "Albany_ScalarResponseFunction.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "PHAL_Utilities.hpp"
 #include "SolutionSniffer.hpp"
+#include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 #include "Thyra_MultiVectorStdOps.hpp"
 #include "Thyra_VectorBase.hpp"
@@ -58,6 +62,22 @@ calcTangentDerivDimension(const Teuchos::RCP<Teuchos::ParameterList>& problemPar
   }
   return std::max(1, np);
 }
+
+// Bytes requested by the fields of a field manager for one evaluation type.
+// Fields of ScalarT carry the derivative components as well.
+template <typename EvalT>
+std::size_t
+fieldManagerBytes(PHX::FieldManager<PHAL::AlbanyTraits>& fm, int const deriv_dim)
+{
+  std::size_t       bytes       = 0;
+  std::size_t const fad_entry   = sizeof(RealType) * (deriv_dim + 1);
+  std::size_t const plain_entry = sizeof(RealType);
+  for (auto const& tag : fm.getFieldTagsForSizing<EvalT>()) {
+    bool const is_scalar = tag->dataTypeInfo() == typeid(typename EvalT::ScalarT);
+    bytes += tag->dataLayout().size() * (is_scalar == true ? fad_entry : plain_entry);
+  }
+  return bytes;
+}
 }  // namespace
 
 namespace Albany {
@@ -83,8 +103,10 @@ Application::Application(
 {
   initialSetUp(params);
   createMeshSpecs();
+  trackMemoryPhase("Mesh Load");
   buildProblem();
   createDiscretization();
+  trackMemoryPhase("Discretization");
   finalSetUp(params, initial_guess);
 }
 
@@ -289,6 +311,7 @@ Application::initialSetUp(const RCP<Teuchos::ParameterList>& params)
   writeToCoutRes         = debugParams->get("Write Residual to Standard Output", 0);
   writeToCoutJac         = debugParams->get("Write Jacobian to Standard Output", 0);
   derivatives_check_     = debugParams->get<int>("Derivative Check", 0);
+  if (debugParams->get<bool>("Track Memory", false) == true) MemoryTracker::instance().enable(comm);
   // the above parameters cannot have values < -1
   if (writeToMatrixMarketSol < -1) {
     ALBANY_ABORT(
@@ -498,7 +521,11 @@ Application::finalSetUp(const Teuchos::RCP<Teuchos::ParameterList>& params, Teuc
 
   // Now that space is allocated in STK for state fields, initialize states.
   // If the states have been already allocated, skip this.
-  if (!stateMgr.areStateVarsAllocated()) stateMgr.setupStateArrays(disc);
+  stateMgr.setDoubleBufferedStates(problemParams->get<bool>("Double-Buffered States", false));
+  if (!stateMgr.areStateVarsAllocated()) {
+    stateMgr.setupStateArrays(disc);
+    trackMemoryPhase("State Allocation");
+  }
 
   solMgr = rcp(new AAdapt::AdaptiveSolutionManager(
       params,
@@ -575,6 +602,11 @@ Application::finalSetUp(const Teuchos::RCP<Teuchos::ParameterList>& params, Teuc
   // Set up memory for workset
   fm = problem->getFieldManager();
   ALBANY_PANIC(fm == Teuchos::null, "getFieldManager not implemented!!!");
+
+  // The field managers are (re)built, so their fields are counted afresh in
+  // postRegSetup.
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled() == true) mt.setOwnerBytes(MemoryTracker::PHALANX_FIELDS, 0);
   dfm = problem->getDirichletFieldManager();
 
   offsets_    = problem->getOffsets();
@@ -645,7 +677,17 @@ Application::getVectorSpace() const
 RCP<Thyra_LinearOp>
 Application::createJacobianOp() const
 {
-  return disc->createJacobianOp();
+  RCP<Thyra_LinearOp> jac = disc->createJacobianOp();
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled() == true) {
+    using size_type                   = DeviceLocalMatrix<const ST>::size_type;
+    RCP<const Thyra_LinearOp>   cjac  = jac;
+    DeviceLocalMatrix<const ST> local = getDeviceData(cjac);
+    mt.setOwnerBytes(
+        MemoryTracker::JACOBIAN_CRS, local.nnz() * (sizeof(ST) + sizeof(LO)) + (local.numRows() + 1) * sizeof(size_type));
+  }
+  return jac;
 }
 
 RCP<Thyra_LinearOp>
@@ -672,6 +714,18 @@ Application::getNumResponses() const
   return responses.size();
 }
 
+void
+Application::addFusedResponse(Teuchos::RCP<FieldManagerScalarResponseFunction> const& response)
+{
+  fused_responses.push_back(response);
+}
+
+void
+Application::invalidateFusedResponses()
+{
+  ++solution_state;
+}
+
 Teuchos::RCP<AbstractResponseFunction>
 Application::getResponse(int i) const
 {
@@ -923,6 +977,9 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
     phxSetup->update_fields();
 
     writePhalanxGraph<EvalT>(fm[ps], evalName, phxGraphVisDetail);
+
+    MemoryTracker& mt = MemoryTracker::instance();
+    if (mt.isEnabled() == true) mt.addOwnerBytes(MemoryTracker::PHALANX_FIELDS, fieldManagerBytes<EvalT>(*fm[ps], 0));
   }
   if (dfm != Teuchos::null) {
     evalName = PHAL::evalName<EvalT>("DFM", 0);
@@ -949,6 +1006,8 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
 
       writePhalanxGraph<EvalT>(nfm[ps], evalName, phxGraphVisDetail);
     }
+
+  trackMemoryPhase("Field Manager Setup <Residual>");
 }
 
 template <>
@@ -980,6 +1039,9 @@ Application::postRegSetupDImpl()
 
     writePhalanxGraph<EvalT>(fm[ps], evalName, phxGraphVisDetail);
 
+    MemoryTracker& mt = MemoryTracker::instance();
+    if (mt.isEnabled() == true) mt.addOwnerBytes(MemoryTracker::PHALANX_FIELDS, fieldManagerBytes<EvalT>(*fm[ps], derivative_dimensions[0]));
+
     if (nfm != Teuchos::null && ps < nfm.size()) {
       evalName = PHAL::evalName<EvalT>("NFM", ps);
       phxSetup->insert_eval(evalName);
@@ -1011,6 +1073,8 @@ Application::postRegSetupDImpl()
 
     writePhalanxGraph<EvalT>(dfm, evalName, phxGraphVisDetail);
   }
+
+  trackMemoryPhase("Field Manager Setup <" + PHX::print<EvalT>() + ">");
 }
 
 template <typename EvalT>
@@ -1042,6 +1106,7 @@ Application::computeGlobalResidualImpl(
   TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: Residual");
   using EvalT = PHAL::AlbanyTraits::Residual;
   postRegSetup<EvalT>();
+  invalidateFusedResponses();
 
   // Load connectivity map and coordinates
   const auto& wsElNodeEqID = disc->getWsElNodeEqID();
@@ -1113,6 +1178,17 @@ Application::computeGlobalResidualImpl(
 
     workset.num_worksets = numWorksets;
 
+    // The evaluators of these responses are in the residual field managers.
+    // They are only registered there when strong Dirichlet conditions do not
+    // modify the solution.
+    bool const fuse_responses = fused_responses.empty() == false;
+    if (fuse_responses == true) {
+      ALBANY_ASSERT(x_post_SDBCs.is_null() == true, "Responses evaluated with the residual require the solution as given.\n");
+      workset.comm          = comm;
+      workset.x_cas_manager = cas_manager;
+      for (auto const& response : fused_responses) response->fusedPreEvaluate(workset);
+    }
+
     for (int ws = 0; ws < numWorksets; ws++) {
       std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
@@ -1125,6 +1201,27 @@ Application::computeGlobalResidualImpl(
         deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
       }
     }
+
+    if (fuse_responses == true) {
+      TEUCHOS_FUNC_TIME_MONITOR("Albany Residual Fill: Responses");
+      for (auto const& response : fused_responses) response->fusedPostEvaluate(workset);
+
+      // One reduction for the partial sums of all the responses
+      std::vector<ST> partial, total;
+      for (auto const& response : fused_responses) {
+        Teuchos::ArrayRCP<ST const> const values = getLocalData(response->fusedValues().getConst());
+        partial.insert(partial.end(), values.begin(), values.end());
+      }
+      total.resize(partial.size());
+      Teuchos::reduceAll<int, ST>(*comm, Teuchos::REDUCE_SUM, static_cast<int>(partial.size()), partial.data(), total.data());
+
+      std::size_t offset = 0;
+      for (auto const& response : fused_responses) {
+        Teuchos::ArrayRCP<ST> const values = getNonconstLocalData(response->fusedValues());
+        for (auto i = 0; i < values.size(); ++i) values[i] = total[offset++];
+        response->markFusedCurrent();
+      }
+    }
   }
 
   // Assemble the residual into a non-overlapping vector
@@ -1239,6 +1336,7 @@ Application::computeGlobalJacobianImpl(
   TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: Jacobian");
   using EvalT = PHAL::AlbanyTraits::Jacobian;
   postRegSetup<EvalT>();
+  invalidateFusedResponses();
 
   // Load connectivity map and coordinates
   const auto& wsElNodeEqID = disc->getWsElNodeEqID();
@@ -1312,7 +1410,8 @@ Application::computeGlobalJacobianImpl(
       workset.f_kokkos = getNonconstDeviceData(workset.f);
     }
     if (!workset.Jac.is_null()) {
-      workset.Jac_kokkos = getNonconstDeviceData(workset.Jac);
+      workset.Jac_kokkos     = getNonconstDeviceData(workset.Jac);
+      workset.block_jacobian = disc->hasBlockJacobian();
     }
     workset.num_worksets = numWorksets;
     for (int ws = 0; ws < numWorksets; ws++) {
@@ -37,6 +37,8 @@ class Manager;
 
 namespace Albany {
 
+class FieldManagerScalarResponseFunction;
+
 class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residual, SPL_Traits>
 {
  public:
@@ -149,6 +151,22 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   int
   getNumResponses() const;
 
+  //! Register a response that is evaluated during the residual fill
+  void
+  addFusedResponse(Teuchos::RCP<FieldManagerScalarResponseFunction> const& response);
+
+  //! Discard the response values computed during the last residual fill by
+  //! advancing the solution state
+  void
+  invalidateFusedResponses();
+
+  //! Counter advanced by every fill and at the end of every model evaluation
+  unsigned long long
+  getSolutionState() const
+  {
+    return solution_state;
+  }
+
   int
   getNumEquations() const
   {
@@ -579,6 +597,13 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   // Response functions
   Teuchos::Array<Teuchos::RCP<Albany::AbstractResponseFunction>> responses;
 
+  // Response functions evaluated during the residual fill
+  Teuchos::Array<Teuchos::RCP<Albany::FieldManagerScalarResponseFunction>> fused_responses;
+
+  // State of the solution the fused responses were evaluated at, starts
+  // past the initial state of the responses
+  unsigned long long solution_state{1};
+
   // Phalanx Field Manager for volumetric fills
   Teuchos::ArrayRCP<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> fm;
 
@@ -720,7 +745,9 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::s
   // Sidesets are integrated within the Cells
   loadWorksetSidesetInfo(workset, ws);
 
-  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateArrayPtr       = &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateHandleArrayPtr = &stateMgr.getStateHandleArray(ws);
+  workset.stateHandlesPtr     = &stateMgr.getStateHandles();
 }
 
 }  // namespace Albany
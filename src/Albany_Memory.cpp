@@ -6,10 +6,15 @@
 
 #include <Teuchos_CommHelpers.hpp>
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <vector>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 #if defined(ALBANY_HAVE_MALLINFO)
 #include <malloc.h>
 #endif
@@ -262,4 +267,146 @@ printMemoryAnalysis(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> con
   ma.print(os);
 }
 
+namespace {
+char const* const memory_owner_names[MemoryTracker::NUM_OWNERS] = {"Jacobian CRS", "StateArrays", "STK fields", "Phalanx MDFields"};
+
+double
+toMiB(double const bytes)
+{
+  return bytes / (1024.0 * 1024.0);
+}
+}  // namespace
+
+MemoryTracker&
+MemoryTracker::instance()
+{
+  // Static object lifetime
+  static MemoryTracker instance_;
+  return instance_;
+}
+
+void
+MemoryTracker::enable(Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  comm_    = comm;
+  enabled_ = Teuchos::nonnull(comm_);
+}
+
+void
+MemoryTracker::setOwnerBytes(Owner const owner, std::size_t const bytes)
+{
+  owner_bytes_[owner] = bytes;
+}
+
+void
+MemoryTracker::addOwnerBytes(Owner const owner, std::size_t const bytes)
+{
+  owner_bytes_[owner] += bytes;
+}
+
+std::size_t
+MemoryTracker::currentRSS()
+{
+#if defined(__linux__)
+  // Second field of statm is the resident set in pages.
+  std::ifstream statm("/proc/self/statm");
+  std::size_t   size_pages = 0, resident_pages = 0;
+  if (statm >> size_pages >> resident_pages) {
+    return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return 0;
+}
+
+std::size_t
+MemoryTracker::peakRSS()
+{
+#if defined(__linux__)
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      std::istringstream iss(line.substr(6));
+      std::size_t        kib = 0;
+      iss >> kib;
+      return kib * 1024;
+    }
+  }
+#endif
+#if defined(ALBANY_HAVE_GETRUSAGE)
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+  // macOS reports ru_maxrss in bytes.
+  return static_cast<std::size_t>(ru.ru_maxrss);
+#else
+  // Linux and the BSDs report ru_maxrss in KiB.
+  return static_cast<std::size_t>(ru.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+void
+MemoryTracker::markPhase(std::string const& phase)
+{
+  if (enabled_ == false) return;
+
+  double local[nvalues_];
+  local[0] = static_cast<double>(currentRSS());
+  local[1] = static_cast<double>(peakRSS());
+  for (int i = 0; i < NUM_OWNERS; ++i) local[2 + i] = static_cast<double>(owner_bytes_[i]);
+
+  PhaseRecord rec;
+  rec.name = phase;
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MIN, nvalues_, local, rec.min);
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MAX, nvalues_, local, rec.max);
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_SUM, nvalues_, local, rec.sum);
+  phases_.push_back(rec);
+
+  if (comm_->getRank() == 0) {
+    std::stringstream msg;
+    msg << ">>> Albany Memory [" << phase << "]" << std::endl;
+    printRecord(msg, rec);
+    std::cout << msg.str() << std::flush;
+  }
+}
+
+void
+MemoryTracker::printRecord(std::ostream& os, PhaseRecord const& rec) const
+{
+  os << "    " << std::setw(20) << std::left << "quantity (MiB)" << std::right << std::setw(12) << "min" << std::setw(12) << "max" << std::setw(14) << "sum"
+     << std::endl;
+  auto line = [&](char const* name, int const i) {
+    os << "    " << std::setw(20) << std::left << name << std::right << std::fixed << std::setprecision(1) << std::setw(12) << toMiB(rec.min[i])
+       << std::setw(12) << toMiB(rec.max[i]) << std::setw(14) << toMiB(rec.sum[i]) << std::endl;
+  };
+  line("current RSS", 0);
+  line("peak RSS", 1);
+  for (int i = 0; i < NUM_OWNERS; ++i) {
+    if (rec.max[2 + i] > 0.0) line(memory_owner_names[i], 2 + i);
+  }
+}
+
+void
+MemoryTracker::printSummary(std::ostream& os) const
+{
+  if (enabled_ == false || comm_->getRank() != 0) return;
+  std::stringstream msg;
+  msg << ">>> Albany Memory Phases" << std::endl;
+  msg << "    #ranks: " << comm_->getSize() << std::endl;
+  msg << "    " << std::setw(36) << std::left << "phase (max over ranks, MiB)" << std::right << std::setw(12) << "RSS" << std::setw(12) << "peak RSS";
+  for (int i = 0; i < NUM_OWNERS; ++i) msg << std::setw(18) << memory_owner_names[i];
+  msg << std::endl;
+  for (auto const& rec : phases_) {
+    msg << "    " << std::setw(36) << std::left << rec.name << std::right << std::fixed << std::setprecision(1);
+    for (int i = 0; i < 2; ++i) msg << std::setw(12) << toMiB(rec.max[i]);
+    for (int i = 0; i < NUM_OWNERS; ++i) msg << std::setw(18) << toMiB(rec.max[2 + i]);
+    msg << std::endl;
+  }
+  msg << "<<< Albany Memory Phases" << std::endl;
+  os << msg.str();
+}
+
 }  // namespace Albany
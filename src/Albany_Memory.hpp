@@ -6,7 +6,10 @@
 #define ALBANY_MEMORY_HPP
 
 #include <Teuchos_Comm.hpp>
+#include <cstddef>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace Albany {
 /*! \brief Depending on configuration, report min, median, and max values over
@@ -47,6 +50,105 @@ namespace Albany {
  */
 void
 printMemoryAnalysis(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+/*! \brief Phase-tagged memory accounting over the whole run.
+ *
+ *  Unlike printMemoryAnalysis, which is a single snapshot at the end of
+ *  Main_Solve, the tracker samples the process resident set size (current and
+ *  peak) at each setup phase (mesh load, discretization, state allocation,
+ *  field manager setup, solver setup) and after every mesh adaptation. Next to
+ *  the RSS it records the bytes held by the large owners of the run, as last
+ *  reported by them. Every sample is reduced over ranks (min, max, sum) and
+ *  printed on rank 0 as soon as it is taken, so a run that is killed for
+ *  running out of memory still shows which phase grew. Request it with
+ *
+ *      <ParameterList name="Debug Output">
+ *        <Parameter name="Track Memory" type="bool" value="true"/>
+ *      </ParameterList>
+ *
+ *  The RSS is read from /proc/self on Linux and from getrusage elsewhere when
+ *  ENABLE_GETRUSAGE is on; it does not need mallinfo. When tracking is off,
+ *  all calls return immediately. markPhase is collective over the
+ *  communicator passed to enable.
+ */
+class MemoryTracker
+{
+ public:
+  enum Owner
+  {
+    JACOBIAN_CRS = 0,
+    STATE_ARRAYS,
+    STK_FIELDS,
+    PHALANX_FIELDS,
+    NUM_OWNERS
+  };
+
+  static MemoryTracker&
+  instance();
+
+  void
+  enable(Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+  bool
+  isEnabled() const
+  {
+    return enabled_;
+  }
+
+  /// Set the bytes currently held by an owner, replacing the previous value.
+  void
+  setOwnerBytes(Owner const owner, std::size_t const bytes);
+
+  /// Add to the bytes held by an owner.
+  void
+  addOwnerBytes(Owner const owner, std::size_t const bytes);
+
+  /// Sample RSS and owner bytes, reduce over ranks and report under a tag.
+  void
+  markPhase(std::string const& phase);
+
+  /// Table of all phases recorded so far, printed on rank 0.
+  void
+  printSummary(std::ostream& os) const;
+
+  /// Resident set size of this process in bytes, 0 if unavailable.
+  static std::size_t
+  currentRSS();
+
+  /// High-water resident set size of this process in bytes, 0 if unavailable.
+  static std::size_t
+  peakRSS();
+
+ private:
+  MemoryTracker() = default;
+
+  // Sampled quantities: current RSS, peak RSS, then one slot per owner.
+  static int const nvalues_ = 2 + NUM_OWNERS;
+
+  struct PhaseRecord
+  {
+    std::string name;
+    double      min[nvalues_];
+    double      max[nvalues_];
+    double      sum[nvalues_];
+  };
+
+  void
+  printRecord(std::ostream& os, PhaseRecord const& rec) const;
+
+  bool                                   enabled_{false};
+  Teuchos::RCP<Teuchos::Comm<int> const> comm_;
+  std::size_t                            owner_bytes_[NUM_OWNERS]{};
+  std::vector<PhaseRecord>               phases_;
+};
+
+/// Convenience: mark a phase if memory tracking is enabled.
+inline void
+trackMemoryPhase(std::string const& phase)
+{
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled() == true) mt.markPhase(phase);
+}
 }  // namespace Albany
 
 #endif  // ALBANY_MEMORY_HPP
@@ -707,6 +707,9 @@ ModelEvaluator::evalModelImpl(const Thyra_InArgs& inArgs, const Thyra_OutArgs& o
       app->evaluateResponse(j, curr_time, x, x_dot, x_dotdot, sacado_param_vec, g_out);
     }
   }
+
+  // The solution may change in place before the next evaluation
+  app->invalidateFusedResponses();
 }
 
 Thyra_InArgs
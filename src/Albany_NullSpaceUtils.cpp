@@ -4,12 +4,15 @@
 
 #include "Albany_NullSpaceUtils.hpp"
 
+#include <vector>
+
 #include "Albany_CommUtils.hpp"
 #include "Albany_Macros.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_TpetraThyraUtils.hpp"
 #include "Piro_StratimikosUtils.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "Thyra_MultiVectorStdOps.hpp"
 
 namespace Albany {
 
@@ -213,6 +216,40 @@ subtractCentroid(Teuchos::RCP<Thyra_MultiVector> const& coordMV)
   }
 }
 
+// Copy of the coordinates relative to the centroid of the fragment of each
+// node. Rotations built from it are about the centroid of each fragment,
+// which keeps them well separated from the translations on fragments far
+// from the centroid of the whole body.
+Teuchos::RCP<Thyra_MultiVector>
+subtractFragmentCentroids(Teuchos::RCP<Thyra_MultiVector> const& coordMV, Teuchos::RCP<Thyra_Vector const> const& nodeFragments, int const numFragments)
+{
+  auto      spmd_vs = getSpmdVectorSpace(coordMV->range());
+  int const nnodes  = spmd_vs->localSubDim();    // local length of each vector
+  int const ndim    = coordMV->domain()->dim();  // Number of multivectors are the dimension of the problem
+
+  Teuchos::RCP<Thyra_MultiVector> fragMV = Thyra::createMembers(coordMV->range(), ndim);
+  Thyra::assign(fragMV.ptr(), *coordMV);
+
+  auto data     = getNonconstLocalData(fragMV);
+  auto fragment = getLocalData(nodeFragments);
+
+  // Coordinate sums of each fragment, followed by its number of nodes.
+  int const       stride = ndim + 1;
+  std::vector<ST> sum(stride * numFragments, 0.0), centroid(stride * numFragments);
+  for (int j = 0; j < nnodes; ++j) {
+    int const f = static_cast<int>(fragment[j]);
+    for (int i = 0; i < ndim; ++i) sum[f * stride + i] += data[i][j];
+    sum[f * stride + ndim] += 1.0;
+  }
+  Teuchos::reduceAll(*createTeuchosCommFromThyraComm(spmd_vs->getComm()), Teuchos::REDUCE_SUM, stride * numFragments, sum.data(), centroid.data());
+
+  for (int j = 0; j < nnodes; ++j) {
+    int const f = static_cast<int>(fragment[j]);
+    for (int i = 0; i < ndim; ++i) data[i][j] -= centroid[f * stride + i] / centroid[f * stride + ndim];
+  }
+  return fragMV;
+}
+
 struct Tpetra_NullSpace_Traits
 {
   typedef Tpetra_MultiVector            base_array_type;
@@ -265,7 +302,7 @@ struct TraitsImpl : public TraitsImplBase
 };
 
 RigidBodyModes::RigidBodyModes(int numPDEs_)
-    : numPDEs(numPDEs_), numElasticityDim(0), numScalar(0), nullSpaceDim(0), mueLuUsed(false), froschUsed(false), setNonElastRBM(false)
+    : numPDEs(numPDEs_), numElasticityDim(0), numScalar(0), nullSpaceDim(0), mueLuUsed(false), froschUsed(false), setNonElastRBM(false), numFragments(1)
 {
 }
 
@@ -305,6 +342,13 @@ RigidBodyModes::setParameters(int const numPDEs_, int const numElasticityDim_, i
   setNonElastRBM   = setNonElastRBM_;
 }
 
+void
+RigidBodyModes::setNodeFragments(Teuchos::RCP<Thyra_Vector const> const& nodeFragments_, int const numFragments_)
+{
+  nodeFragments = nodeFragments_;
+  numFragments  = numFragments_;
+}
+
 void
 RigidBodyModes::setCoordinates(Teuchos::RCP<Thyra_MultiVector> const& coordMV_)
 {
@@ -361,10 +405,15 @@ RigidBodyModes::setCoordinatesAndNullspace(
 
       subtractCentroid(coordMV);
 
+      // The coordinates passed to the preconditioner keep the shape of the
+      // body; only the rigid body modes use the fragment centroids.
+      Teuchos::RCP<Thyra_MultiVector> const rbmCoordMV =
+          (numFragments > 1 && nodeFragments.is_null() == false) ? subtractFragmentCentroids(coordMV, nodeFragments, numFragments) : coordMV;
+
       if (setNonElastRBM == true)
-        Coord2RBM_nonElasticity<Tpetra_NullSpace_Traits>(coordMV, numPDEs, numScalar, nullSpaceDim, trr);
+        Coord2RBM_nonElasticity<Tpetra_NullSpace_Traits>(rbmCoordMV, numPDEs, numScalar, nullSpaceDim, trr);
       else
-        Coord2RBM<Tpetra_NullSpace_Traits>(coordMV, numPDEs, numScalar, nullSpaceDim, trr);
+        Coord2RBM<Tpetra_NullSpace_Traits>(rbmCoordMV, numPDEs, numScalar, nullSpaceDim, trr);
 
       ALBANY_PANIC(
           soln_vs.is_null(),
@@ -65,6 +65,12 @@ class RigidBodyModes
   void
   setCoordinates(Teuchos::RCP<Thyra_MultiVector> const& coordMV);
 
+  //! Set the fragment, in [0, numFragments), of each node of the
+  //! nonoverlapping node map of the coordinates. With more than one
+  //! fragment, the rotations of each fragment are about its own centroid.
+  void
+  setNodeFragments(Teuchos::RCP<Thyra_Vector const> const& nodeFragments, int const numFragments);
+
  private:
   int  numPDEs, numElasticityDim, numScalar, nullSpaceDim;
   bool mueLuUsed, froschUsed, setNonElastRBM;
@@ -73,6 +79,9 @@ class RigidBodyModes
 
   Teuchos::RCP<Thyra_MultiVector> coordMV;
 
+  Teuchos::RCP<Thyra_Vector const> nodeFragments;
+  int                              numFragments;
+
   Teuchos::RCP<TraitsImplBase> traits;
 };
 
@@ -536,6 +536,7 @@ SolverFactory::getValidDebugParameters() const
   validPL->set<bool>("Write Distributed Solution and Map to MatrixMarket", false, "Flag to Write Distributed Solution and Map to MatrixMarket");
   validPL->set<int>("Write Solution to Standard Output", 0, "Solution Number to Dump to  Standard Output");
   validPL->set<bool>("Analyze Memory", false, "Flag to Analyze Memory");
+  validPL->set<bool>("Track Memory", false, "Flag to report per-phase memory usage");
   return validPL;
 }
 
@@ -39,10 +39,21 @@ using IDArray       = shards::Array<LO, shards::NaturalOrder>;
 using StateArray    = std::map<std::string, MDArray>;
 using StateArrayVec = std::vector<StateArray>;
 
+// Dense integer handle of a registered state, assigned by the StateManager at
+// registration. Per workset, the arrays of the registered element states are
+// also stored in a vector indexed by handle, so evaluators that cache their
+// handles skip the string lookup in the StateArray map. The map stays the
+// reference for I/O and for unregistered states.
+using StateHandle      = int;
+using StateHandleMap   = std::map<std::string, StateHandle>;
+using StateHandleArray = std::vector<MDArray>;
+
 struct StateArrays
 {
   StateArrayVec elemStateArrays;
   StateArrayVec nodeStateArrays;
+  // elemStateArrays entries indexed by StateHandle, one vector per workset
+  std::vector<StateHandleArray> elemStateHandleArrays;
 };
 
 //! Container to get state info from StateManager to STK. Made into a struct so
@@ -150,6 +161,12 @@ struct StateStruct
   bool        restartDataAvailable{false};
   // Bool that this state is to be copied into name+"_old"
   bool        saveOldState{false};
+  // With double-buffered states, copy into name+"_old" anyway, for states
+  // whose current value is read before it is written
+  bool        copyOldState{false};
+  // With double-buffered states, the name and name+"_old" arrays currently
+  // point at each other's mesh fields
+  bool        slotsSwapped{false};
   bool        layered{false};
   std::string meshPart{""};
   std::string ebName{""};
@@ -4,9 +4,29 @@
 #include "Albany_StateManager.hpp"
 
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+#include <utility>
+
+namespace {
+
+// Entities whose arrays live in the element state arrays of each workset
+bool
+isElemStateEntity(Albany::StateStruct::MeshFieldEntity const entity)
+{
+  switch (entity) {
+    case Albany::StateStruct::WorksetValue:
+    case Albany::StateStruct::ElemData:
+    case Albany::StateStruct::QuadPoint:
+    case Albany::StateStruct::ElemNode: return true;
+    default: return false;
+  }
+}
+
+}  // namespace
+
 Albany::StateManager::StateManager() : stateVarsAreAllocated(false), stateInfo(Teuchos::rcp(new StateInfoStruct))
 {
   // Nothing to be done here
@@ -42,6 +62,7 @@ Albany::StateManager::registerStateVariable(
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Save or Load State " + stateName + " to/from field " + fieldName));
   p->set<std::string const>("State Name", stateName);
+  p->set<StateHandle>("State Handle", getStateHandle(stateName));
   p->set<std::string const>("Field Name", fieldName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -64,6 +85,7 @@ Albany::StateManager::registerStateVariable(
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Save or Load State " + stateName + " to/from field " + stateName));
   p->set<std::string const>("State Name", stateName);
+  p->set<StateHandle>("State Handle", getStateHandle(stateName));
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -86,6 +108,7 @@ Albany::StateManager::registerNodalVectorStateVariable(
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Save or Load State " + stateName + " to/from field " + stateName));
   p->set<std::string const>("State Name", stateName);
+  p->set<StateHandle>("State Handle", getStateHandle(stateName));
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -106,6 +129,7 @@ Albany::StateManager::registerStateVariable(
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Save or Load State " + stateName + " to/from field " + stateName));
   p->set<std::string const>("State Name", stateName);
+  p->set<StateHandle>("State Handle", getStateHandle(stateName));
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   return p;
@@ -173,6 +197,13 @@ Albany::StateManager::registerStateVariable(
   } else
     ALBANY_ABORT("StateManager: Unknown Entity type - " << dl->name(0) << " - not supported" << std::endl);
 
+  // Only states stored per element workset get a handle; nodal states live in
+  // the node state arrays and are looked up by name.
+  if (isElemStateEntity(mfe_type) == true) {
+    registerStateHandle(stateName);
+    if (registerOldState == true) registerStateHandle(stateName + "_old");
+  }
+
   (*stateInfo).push_back(Teuchos::rcp(new StateStruct(stateName, mfe_type)));
   StateStruct& stateRef = *stateInfo->back();
   stateRef.setInitType(init_type);
@@ -269,6 +300,13 @@ Albany::StateManager::registerNodalVectorStateVariable(
   } else
     ALBANY_ABORT("StateManager: Unknown Entity type - " << dl->name(0) << " - not supported" << std::endl);
 
+  // Only states stored per element workset get a handle; nodal states live in
+  // the node state arrays and are looked up by name.
+  if (isElemStateEntity(mfe_type) == true) {
+    registerStateHandle(stateName);
+    if (registerOldState == true) registerStateHandle(stateName + "_old");
+  }
+
   (*stateInfo).push_back(Teuchos::rcp(new StateStruct(stateName, mfe_type)));
   StateStruct& stateRef = *stateInfo->back();
   stateRef.setInitType(init_type);
@@ -521,6 +559,11 @@ Albany::StateManager::setupStateArrays(const Teuchos::RCP<Albany::AbstractDiscre
 
   doSetStateArrays(disc, stateInfo);
 
+  // Every write of the mesh fields to file goes through the discretization, so
+  // resolving the swapped slots there covers all output paths, including the
+  // ones that do not go through updateStates.
+  disc->setStateSlotResolver([this]() { resolveStateSlots(); });
+
   // First, we check the explicitly required side discretizations exist...
   const auto& ss_discs = disc->getSideSetDiscretizations();
   for (auto const& it : sideSetStateInfo) {
@@ -538,6 +581,21 @@ Albany::StateManager::setupStateArrays(const Teuchos::RCP<Albany::AbstractDiscre
     }
     doSetStateArrays(it.second, sis);  // If sis was null, this should basically do nothing
   }
+
+  refreshStateHandleArrays();
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled() == true) {
+    std::size_t          bytes = 0;
+    Albany::StateArrays& sa    = getStateArrays();
+    for (auto const& esa : sa.elemStateArrays) {
+      for (auto const& st : esa) bytes += st.second.size() * sizeof(double);
+    }
+    for (auto const& nsa : sa.nodeStateArrays) {
+      for (auto const& st : nsa) bytes += st.second.size() * sizeof(double);
+    }
+    mt.setOwnerBytes(MemoryTracker::STATE_ARRAYS, bytes);
+  }
 }
 
 Teuchos::RCP<Albany::AbstractDiscretization>
@@ -682,58 +740,183 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
 {
   ALBANY_ASSERT(stateVarsAreAllocated == true);
   disc->setStateArrays(sa);
+  refreshStateHandleArrays();
   return;
 }
 
+Albany::StateHandle
+Albany::StateManager::getStateHandle(std::string const& stateName) const
+{
+  auto const it = stateHandles.find(stateName);
+  return it == stateHandles.end() ? -1 : it->second;
+}
+
+Albany::StateHandle
+Albany::StateManager::registerStateHandle(std::string const& stateName)
+{
+  auto const it = stateHandles.find(stateName);
+  if (it != stateHandles.end()) return it->second;
+  StateHandle const handle = stateHandles.size();
+  stateHandles[stateName]  = handle;
+  return handle;
+}
+
+Albany::StateHandleArray&
+Albany::StateManager::getStateHandleArray(int const ws) const
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+  return getStateArrays().elemStateHandleArrays[ws];
+}
+
+void
+Albany::StateManager::refreshStateHandleArrays() const
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+
+  Albany::StateArrays&   sa  = disc->getStateArrays();
+  Albany::StateArrayVec& esa = sa.elemStateArrays;
+
+  // States registered on other element blocks keep an empty array here.
+  sa.elemStateHandleArrays.assign(esa.size(), StateHandleArray(stateHandles.size()));
+  for (std::size_t ws = 0; ws < esa.size(); ++ws) {
+    for (auto const& it : stateHandles) {
+      auto const st = esa[ws].find(it.first);
+      if (st != esa[ws].end()) sa.elemStateHandleArrays[ws][it.second] = st->second;
+    }
+  }
+}
+
 void
 Albany::StateManager::updateStates()
 {
-  // Swap boolean that defines old and new (in terms of state1 and 2) in
-  // accessors
   ALBANY_ASSERT(stateVarsAreAllocated == true);
 
-  // Get states from STK mesh
+  // Swapping is O(1) per workset but leaves the current values in the
+  // name+"_old" mesh fields, so copy whenever the fields are about to be
+  // written to file.
+  bool const swap_slots = doubleBufferedStates == true && disc->nextWriteIsOutputStep() == false;
+
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    StateStruct& state = *(*stateInfo)[i];
+    if (state.saveOldState == false) continue;
+
+    if (swap_slots == true && state.copyOldState == false) {
+      swapStateSlots(state);
+    } else {
+      copyCurrentToOldState(state);
+      if (state.slotsSwapped == true) swapStateSlots(state);
+    }
+  }
+}
+
+void
+Albany::StateManager::requireOldStateCopy(std::string const& stateName)
+{
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    if ((*stateInfo)[i]->name == stateName) (*stateInfo)[i]->copyOldState = true;
+  }
+}
+
+void
+Albany::StateManager::resolveStateSlots() const
+{
+  if (stateVarsAreAllocated == false) return;
+
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    StateStruct& state = *(*stateInfo)[i];
+    if (state.slotsSwapped == false) continue;
+
+    // The accepted values are in the old array, which sits on the named mesh
+    // field. Swapping back puts them in the current array and copying them
+    // into the old one leaves both as after a copying update. The old values
+    // are not changed; current values written since the last update are
+    // recomputed by the next evaluation.
+    swapStateSlots(state);
+    copyCurrentToOldState(state);
+  }
+}
+
+void
+Albany::StateManager::copyCurrentToOldState(StateStruct const& state) const
+{
   Albany::StateArrays&   sa              = disc->getStateArrays();
   Albany::StateArrayVec& esa             = sa.elemStateArrays;
   Albany::StateArrayVec& nsa             = sa.nodeStateArrays;
   int                    numElemWorksets = esa.size();
   int                    numNodeWorksets = nsa.size();
 
-  // For each workset, loop over registered states
+  std::string const stateName     = state.name;
+  std::string const stateName_old = stateName + "_old";
 
-  for (unsigned int i = 0; i < stateInfo->size(); i++) {
-    if ((*stateInfo)[i]->saveOldState) {
-      std::string const stateName     = (*stateInfo)[i]->name;
-      std::string const stateName_old = stateName + "_old";
+  switch (state.entity) {
+    case Albany::StateStruct::NodalDataToElemNode:
+      for (int ws = 0; ws < numNodeWorksets; ws++)
+        for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+
+      break;
 
-      switch ((*stateInfo)[i]->entity) {
-        case Albany::StateStruct::NodalDataToElemNode:
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+    case Albany::StateStruct::WorksetValue:
+    case Albany::StateStruct::ElemData:
+    case Albany::StateStruct::QuadPoint:
+    case Albany::StateStruct::ElemNode: {
+      StateHandle const handle     = getStateHandle(stateName);
+      StateHandle const handle_old = getStateHandle(stateName_old);
+      bool const        by_handle  = handle >= 0 && handle_old >= 0;
 
-          break;
+      for (int ws = 0; ws < numElemWorksets; ws++) {
+        MDArray& current = by_handle == true ? sa.elemStateHandleArrays[ws][handle] : esa[ws][stateName];
+        MDArray& old     = by_handle == true ? sa.elemStateHandleArrays[ws][handle_old] : esa[ws][stateName_old];
+        for (int j = 0; j < current.size(); j++) old[j] = current[j];
+      }
 
-        case Albany::StateStruct::WorksetValue:
-        case Albany::StateStruct::ElemData:
-        case Albany::StateStruct::QuadPoint:
-        case Albany::StateStruct::ElemNode:
+      break;
+    }
 
-          for (int ws = 0; ws < numElemWorksets; ws++)
-            for (int j = 0; j < esa[ws][stateName].size(); j++) esa[ws][stateName_old][j] = esa[ws][stateName][j];
+    case Albany::StateStruct::NodalData:
 
-          break;
+      for (int ws = 0; ws < numNodeWorksets; ws++)
+        for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
 
-        case Albany::StateStruct::NodalData:
+      break;
 
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+    default: ALBANY_ABORT("Error: Cannot match state entity : " << state.entity << " in state manager. " << std::endl); break;
+  }
+}
 
-          break;
+void
+Albany::StateManager::swapStateSlots(StateStruct& state) const
+{
+  Albany::StateArrays& sa = disc->getStateArrays();
 
-        default: ALBANY_ABORT("Error: Cannot match state entity : " << (*stateInfo)[i]->entity << " in state manager. " << std::endl); break;
+  std::string const stateName     = state.name;
+  std::string const stateName_old = stateName + "_old";
+
+  // MDArrays are views, so swapping them exchanges the storage the
+  // evaluators see without touching the data.
+  switch (state.entity) {
+    case Albany::StateStruct::NodalDataToElemNode:
+    case Albany::StateStruct::NodalData:
+      for (auto& nsa : sa.nodeStateArrays) std::swap(nsa[stateName], nsa[stateName_old]);
+      break;
+
+    case Albany::StateStruct::WorksetValue:
+    case Albany::StateStruct::ElemData:
+    case Albany::StateStruct::QuadPoint:
+    case Albany::StateStruct::ElemNode: {
+      for (auto& esa : sa.elemStateArrays) std::swap(esa[stateName], esa[stateName_old]);
+
+      StateHandle const handle     = getStateHandle(stateName);
+      StateHandle const handle_old = getStateHandle(stateName_old);
+      if (handle >= 0 && handle_old >= 0) {
+        for (auto& sha : sa.elemStateHandleArrays) std::swap(sha[handle], sha[handle_old]);
       }
+      break;
     }
+
+    default: ALBANY_ABORT("Error: Cannot match state entity : " << state.entity << " in state manager. " << std::endl); break;
   }
+
+  state.slotsSwapped = !state.slotsSwapped;
 }
 
 void
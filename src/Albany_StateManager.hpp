@@ -40,7 +40,10 @@ class StateManager
 
   StateManager();
 
-  ~StateManager(){};
+  ~StateManager()
+  {
+    if (disc != Teuchos::null) disc->setStateSlotResolver(nullptr);
+  };
 
   typedef std::map<std::string, Teuchos::RCP<PHX::DataLayout>> RegisteredStates;
 
@@ -190,6 +193,28 @@ class StateManager
   void
   updateStates();
 
+  /// With double buffering, updateStates swaps the current and old arrays of
+  /// each state instead of copying them, except where a copy is requested
+  /// or the discretization is about to write the mesh fields to file.
+  void
+  setDoubleBufferedStates(bool const double_buffered)
+  {
+    doubleBufferedStates = double_buffered;
+  }
+
+  /// Always copy this state into its old slot, for models that read the
+  /// current value before writing it.
+  void
+  requireOldStateCopy(std::string const& stateName);
+
+  /// Put every swapped state back into canonical storage, with both arrays
+  /// holding the values accepted by the last updateStates. The old arrays
+  /// keep their values. Needed before anything reads the mesh fields by name.
+  /// The discretization calls it before every write to file; adaptation calls
+  /// it before the mesh is rebuilt from the fields.
+  void
+  resolveStateSlots() const;
+
   /// Method to get a StateInfoStruct of info needed by STK to output States as
   /// Fields
   Teuchos::RCP<Albany::StateInfoStruct>
@@ -215,7 +240,28 @@ class StateManager
   Albany::StateArrays&
   getStateArrays() const;
 
-  // Set the state array for all worksets.
+  /// Dense handle of a registered element state, -1 if the state is not
+  /// registered or is nodal
+  StateHandle
+  getStateHandle(std::string const& stateName) const;
+
+  /// Map from state name to handle, for I/O and lazy handle resolution
+  StateHandleMap const&
+  getStateHandles() const
+  {
+    return stateHandles;
+  }
+
+  /// Element state arrays of a workset, indexed by handle
+  StateHandleArray&
+  getStateHandleArray(int ws) const;
+
+  /// Rebuild the handle-indexed arrays from the state array maps. Needed
+  /// whenever the discretization rebuilds its state arrays.
+  void
+  refreshStateHandleArrays() const;
+
+  // Set the state array for all worksets. Rebuilds the handle-indexed arrays.
   void
   setStateArrays(Albany::StateArrays& sa);
 
@@ -263,10 +309,28 @@ class StateManager
   void
   doSetStateArrays(const Teuchos::RCP<Albany::AbstractDiscretization>& disc, const Teuchos::RCP<StateInfoStruct>& stateInfoPtr);
 
+  /// Assign the next dense handle to a state name, if it has none
+  StateHandle
+  registerStateHandle(std::string const& stateName);
+
+  /// Copy the current values of a state into its old array
+  void
+  copyCurrentToOldState(StateStruct const& state) const;
+
+  /// Exchange the current and old arrays of a state in every workset
+  void
+  swapStateSlots(StateStruct& state) const;
+
   /// boolean to enforce that allocate gets called once, and after registration
   /// and befor gets
   bool stateVarsAreAllocated;
 
+  /// Swap rather than copy old states in updateStates
+  bool doubleBufferedStates{false};
+
+  /// Dense handles of the registered states
+  StateHandleMap stateHandles;
+
   /// Container to hold the states that have been registered, by element block,
   /// to be allocated later
   std::map<std::string, RegisteredStates>                        statesToStore;
@@ -40,10 +40,10 @@ class ACEThermalParameters : public PHX::EvaluatorWithBaseImpl<Traits>, public P
   createElementBlockParameterMaps();
 
   ScalarT
-  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType> map);
+  queryElementBlockParameterMap(std::string const& eb_name, std::map<std::string, RealType> const& map) const;
 
-  std::vector<RealType>
-  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>> map);
+  std::vector<RealType> const&
+  queryElementBlockParameterMap(std::string const& eb_name, std::map<std::string, std::vector<RealType>> const& map) const;
 
  private:
   //! Validate the name strings under "ACE Thermal Parameters" section in input
@@ -51,6 +51,28 @@ class ACEThermalParameters : public PHX::EvaluatorWithBaseImpl<Traits>, public P
   Teuchos::RCP<Teuchos::ParameterList const>
   getValidThermalCondParameters() const;
 
+  //! Parameters of the QPs of a workset that only depend on their height,
+  //! stored cell by cell and QP by QP.
+  struct DepthProfile
+  {
+    std::vector<RealType> height;
+    std::vector<RealType> salinity;
+    std::vector<RealType> porosity;
+    std::vector<RealType> freezing_curve_exponent;
+    std::vector<RealType> temperature_shift;
+    std::vector<RealType> soil_density;
+    std::vector<RealType> soil_heat_capacity;
+    std::vector<RealType> soil_thermal_cond;
+  };
+
+  //! Evaluate the depth profiles at the QPs of the workset, unless they were
+  //! already evaluated at the same heights.
+  DepthProfile const&
+  getDepthProfile(typename Traits::EvalData workset);
+
+  //! Depth profiles by workset index. They change only with the mesh.
+  std::vector<DepthProfile> depth_profiles_;
+
   unsigned int                                                num_qps_{0}, num_dims_{0}, num_nodes_{0}, workset_size_{0};
   PHX::MDField<const MeshScalarT, Cell, QuadPoint, Dim>       coord_vec_;
   PHX::MDField<ScalarT, Cell, QuadPoint>                      thermal_conductivity_;
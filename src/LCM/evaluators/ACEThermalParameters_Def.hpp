@@ -4,6 +4,7 @@
 
 #include <MiniTensor.h>
 
+#include <algorithm>
 #include <fstream>
 
 #include "ACEcommon.hpp"
@@ -158,35 +159,21 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
     ALBANY_ASSERT(cell_boundary_indicator_.is_null() == false);
   }
 
-  std::vector<RealType> const salinity_eb               = this->queryElementBlockParameterMap(eb_name, salinity_map_);
-  std::vector<RealType> const z_above_mean_sea_level_eb = this->queryElementBlockParameterMap(eb_name, z_above_mean_sea_level_map_);
-  std::vector<RealType> const time_eb                   = this->queryElementBlockParameterMap(eb_name, time_map_);
-  std::vector<RealType> const sea_level_eb              = this->queryElementBlockParameterMap(eb_name, sea_level_map_);
-
-  std::vector<RealType> porosity_from_file_eb = this->queryElementBlockParameterMap(eb_name, porosity_from_file_map_);
-  std::vector<RealType> ocean_salinity_eb     = this->queryElementBlockParameterMap(eb_name, ocean_salinity_map_);
-  std::vector<RealType> snow_depth_eb         = this->queryElementBlockParameterMap(eb_name, snow_depth_map_);
-  std::vector<RealType> sand_from_file_eb     = this->queryElementBlockParameterMap(eb_name, sand_from_file_map_);
-  std::vector<RealType> clay_from_file_eb     = this->queryElementBlockParameterMap(eb_name, clay_from_file_map_);
-  std::vector<RealType> silt_from_file_eb     = this->queryElementBlockParameterMap(eb_name, silt_from_file_map_);
-  std::vector<RealType> peat_from_file_eb     = this->queryElementBlockParameterMap(eb_name, peat_from_file_map_);
-  // The following is for specifying snow for ACI/NH
-  std::vector<RealType> air_from_file_eb = this->queryElementBlockParameterMap(eb_name, air_from_file_map_);
+  std::vector<RealType> const& time_eb           = this->queryElementBlockParameterMap(eb_name, time_map_);
+  std::vector<RealType> const& sea_level_eb      = this->queryElementBlockParameterMap(eb_name, sea_level_map_);
+  std::vector<RealType> const& ocean_salinity_eb = this->queryElementBlockParameterMap(eb_name, ocean_salinity_map_);
+  std::vector<RealType> const& snow_depth_eb     = this->queryElementBlockParameterMap(eb_name, snow_depth_map_);
 
   ScalarT ice_density_eb         = this->queryElementBlockParameterMap(eb_name, ice_density_map_);
   ScalarT water_density_eb       = this->queryElementBlockParameterMap(eb_name, water_density_map_);
-  ScalarT soil_density_eb        = this->queryElementBlockParameterMap(eb_name, soil_density_map_);
   ScalarT ice_heat_capacity_eb   = this->queryElementBlockParameterMap(eb_name, ice_heat_capacity_map_);
   ScalarT water_heat_capacity_eb = this->queryElementBlockParameterMap(eb_name, water_heat_capacity_map_);
-  ScalarT soil_heat_capacity_eb  = this->queryElementBlockParameterMap(eb_name, soil_heat_capacity_map_);
   ScalarT ice_thermal_cond_eb    = this->queryElementBlockParameterMap(eb_name, ice_thermal_cond_map_);
   ScalarT water_thermal_cond_eb  = this->queryElementBlockParameterMap(eb_name, water_thermal_cond_map_);
-  ScalarT soil_thermal_cond_eb   = this->queryElementBlockParameterMap(eb_name, soil_thermal_cond_map_);
   ScalarT thermal_factor_eb      = this->queryElementBlockParameterMap(eb_name, thermal_factor_map_);
   ScalarT latent_heat_eb         = this->queryElementBlockParameterMap(eb_name, latent_heat_map_);
 
   ScalarT const salinity_base_eb   = this->queryElementBlockParameterMap(eb_name, salinity_base_map_);
-  ScalarT const porosity_bulk_eb   = this->queryElementBlockParameterMap(eb_name, porosity_bulk_map_);
   ScalarT const element_size_eb    = this->queryElementBlockParameterMap(eb_name, element_size_map_);
   ScalarT const salt_enhanced_D_eb = this->queryElementBlockParameterMap(eb_name, salt_enhanced_D_map_);
 
@@ -196,15 +183,36 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
   ScalarT const per_exposed_length = 1.0 / element_size_eb;
   ScalarT const factor             = per_exposed_length * salt_enhanced_D_eb;
 
+  // The following only depend on time and are the same for all QPs.
+  RealType const sea_level = sea_level_eb.size() > 0 ? interpolateVectors(time_eb, sea_level_eb, current_time) : -999.0;
+  // const ScalarT sea_level = sea_level_eb.size() > 0 ? (interpolateVectors(time_eb, sea_level_eb, current_time) * 2.0) : -999.0;
+
+  // IKT 2/23/2024: the following was added for the snow_depth field.
+  // TODO Jenn: use this field to incorporate snow into mixture model
+  ScalarT    snow_depth(0.0);
+  bool const snow_given = snow_depth_eb.size() > 0;
+  if (snow_given == true) {
+    snow_depth = interpolateVectors(time_eb, snow_depth_eb, current_time);
+  }
+  // std::cout << "IKT snow_depth = " << snow_depth << "\n";
+
+  // IKT, FIXME?: ocean_salinity is not block-dependent, so we may want to
+  // make it just a std::vector, to avoid creating and querying a map.
+  ScalarT ocean_sal = salinity_base_eb;
+  if (ocean_salinity_eb.size() > 0) {
+    ocean_sal = interpolateVectors(time_eb, ocean_salinity_eb, current_time);
+  }
+
+  // And the following only depend on the height of each QP.
+  DepthProfile const& profile = getDepthProfile(workset);
+
   for (std::size_t cell = 0; cell < num_cells; ++cell) {
     double const cell_bi     = have_cell_boundary_indicator_ == true ? *(cell_boundary_indicator_[cell]) : 0.0;
     bool const   is_erodible = cell_bi == 2.0;
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
-      RealType const height = Sacado::Value<ScalarT>::eval(coord_vec_(cell, qp, 2));
-      ScalarT        sal_eb = salinity_base_eb;
-      if (salinity_eb.size() > 0) {
-        sal_eb = interpolateVectors(z_above_mean_sea_level_eb, salinity_eb, height);
-      }
+      auto const     point  = cell * num_qps_ + qp;
+      RealType const height = profile.height[point];
+      ScalarT        sal_eb = profile.salinity[point];
       // IKT 11/4/2022: if we are in the initial timestep, set bluff_salinity from sal_eb
       if (is_initial_timestep_ == true) {
         bluff_salinity_(cell, qp) = sal_eb;
@@ -213,40 +221,16 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       else {
         bluff_salinity_(cell, qp) = bluff_salinity_read_(cell, qp);
       }
-      const ScalarT sea_level = sea_level_eb.size() > 0 ? interpolateVectors(time_eb, sea_level_eb, current_time) : -999.0;
-      // const ScalarT sea_level = sea_level_eb.size() > 0 ? (interpolateVectors(time_eb, sea_level_eb, current_time) * 2.0) : -999.0;
 
       // Thermal calculation
-      // Calculate the depth-dependent porosity
-      // NOTE: The porosity does not change in time so this calculation only
-      // needs
-      //       to be done once, at the beginning of the simulation.
-      ScalarT porosity_eb = porosity_bulk_eb;
-      if (porosity_from_file_eb.size() > 0) {
-        porosity_eb = interpolateVectors(z_above_mean_sea_level_eb, porosity_from_file_eb, height);
-      }
-      porosity_(cell, qp) = porosity_eb;
-
-      // IKT 2/23/2024: the following was added for the snow_depth field.
-      // TODO Jenn: use this field to incorporate snow into mixture model
-      ScalarT snow_depth(0.0);
-      bool    snow_given{false};
-      if (snow_depth_eb.size() > 0) {
-        snow_depth = interpolateVectors(time_eb, snow_depth_eb, current_time);
-        snow_given = true;
-      }
-      // std::cout << "IKT snow_depth = " << snow_depth << "\n";
+      // The depth-dependent porosity does not change in time.
+      ScalarT const porosity_eb = profile.porosity[point];
+      porosity_(cell, qp)       = porosity_eb;
 
       // Calculate the salinity of the grid cell
       if ((is_erodible == true) && (height <= sea_level)) {
-        ScalarT       ocean_sal = salinity_base_eb;
-        ScalarT const sal_curr  = bluff_salinity_(cell, qp);
-        // IKT, FIXME?: ocean_salinity is not block-dependent, so we may want to
-        // make it just a std::vector, to avoid creating and querying a map.
+        ScalarT const sal_curr = bluff_salinity_(cell, qp);
         ScalarT const zero_sal(0.0);
-        if (ocean_salinity_eb.size() > 0) {
-          ocean_sal = interpolateVectors(time_eb, ocean_salinity_eb, current_time);
-        }
         // --- elyce begin commenting out (8-26-24) ---- 
         // Note: below is being commented out because re: email thread with Jenn, it was decided to actually just take the ocean salinity at the bluff face
         // the below code was *likely* overriden the subsequent line of code, but not necessarily... so I am commenting it out just to be safe
@@ -277,38 +261,10 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       // Set current temperature
       ScalarT const& Tcurr = temperature_(cell, qp);
 
-      // Check if sediment fractions were provided
-      bool sediment_given{false};
-      if ((sand_from_file_eb.size() > 0) && (clay_from_file_eb.size() > 0) && (silt_from_file_eb.size() > 0) && (peat_from_file_eb.size() > 0)) {
-        sediment_given = true;
-      }
-
-      // Check if air fraction was provided
-      bool air_given{false};
-      if (air_from_file_eb.size() > 0) {
-        air_given = true;
-      }
-      ScalarT  Tshift;
-      ScalarT  Tdiff;
-      RealType v = 0.1;
-
-      if (sediment_given == true) {
-        auto sand_frac = interpolateVectors(z_above_mean_sea_level_eb, sand_from_file_eb, height);
-        auto clay_frac = interpolateVectors(z_above_mean_sea_level_eb, clay_from_file_eb, height);
-        auto silt_frac = interpolateVectors(z_above_mean_sea_level_eb, silt_from_file_eb, height);
-        auto peat_frac = interpolateVectors(z_above_mean_sea_level_eb, peat_from_file_eb, height);
-        v              = (peat_frac * 0.1) + (sand_frac * 1.0) + (silt_frac * 15.0) + (clay_frac * 50.0);
-        Tshift         = (peat_frac * 0.1) + (sand_frac * 0.3) + (silt_frac * 0.6) + (clay_frac * 1.0);
-      } else {
-        Tshift = 0.1;
-      }
-
-      // IKT 2/17/2024: code to use air frac goes here for Jenn to fill in.
-      // Might want to move elsewhere in this function...
-      if (air_given == true) {
-        auto air_frac = interpolateVectors(z_above_mean_sea_level_eb, air_from_file_eb, height);
-        // std::cout << "IKT air_frac = " << air_frac << "\n";
-      }
+      // Freezing curve parameters from the sediment fractions, if given
+      ScalarT const  Tshift = profile.temperature_shift[point];
+      RealType const v      = profile.freezing_curve_exponent[point];
+      ScalarT        Tdiff;
 
       // Use freezing curve to get icurr and dfdT
       ScalarT icurr{1.0};
@@ -366,35 +322,14 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       // Update the water saturation
       ScalarT wcurr = 1.0 - icurr;
 
-      ScalarT calc_soil_heat_capacity;
-      ScalarT calc_soil_thermal_cond;
-      ScalarT calc_soil_density;
-      if (sediment_given == true) {
-        ScalarT sand_frac = interpolateVectors(z_above_mean_sea_level_eb, sand_from_file_eb, height);
-        ScalarT clay_frac = interpolateVectors(z_above_mean_sea_level_eb, clay_from_file_eb, height);
-        ScalarT silt_frac = interpolateVectors(z_above_mean_sea_level_eb, silt_from_file_eb, height);
-        ScalarT peat_frac = interpolateVectors(z_above_mean_sea_level_eb, peat_from_file_eb, height);
-
-        // THERMAL PROPERTIES OF ROCKS, E.C. Robertson, U.S. Geological Survey
-        // Open-File Report 88-441 (1988).
-        // AGU presentation (2019) --> peat K value
-        // Gnatowski, Tomasz (2016) Thermal properties of degraded lowland
-        // peat-moorsh soils, EGU General Assembly 2016, held 17-22 April, 2016
-        // in Vienna Austria, id. EPSC2016-8105 --> peat Cp value Cp values in
-        // [J/kg/K]
-        calc_soil_heat_capacity = (0.7e3 * sand_frac) + (0.6e3 * clay_frac) + (0.7e3 * silt_frac) + (1.93e3 * peat_frac);
-        // K values in [W/K/m]
-        calc_soil_thermal_cond = (8.0 * sand_frac) + (0.4 * clay_frac) + (4.9 * silt_frac) + (0.40 * peat_frac);
-        // calc_soil_thermal_cond = (8.0 * sand_frac) + (0.4 * clay_frac) + (4.9 * silt_frac) + (0.08 * peat_frac);
-        // calc_soil_thermal_cond = pow(8.0,sand_frac) * pow(0.4,clay_frac) * pow(4.9,silt_frac) * pow(0.08,peat_frac);
-        //  Rho values in [kg/m3]
-        //  Peat density from Emily Bristol
-        calc_soil_density = (2600.0 * sand_frac) + (2350.0 * clay_frac) + (2500.0 * silt_frac) + (250.0 * peat_frac);
-        // Update the effective material density
-        density_(cell, qp) = (porosity_eb * ((ice_density_eb * icurr) + (water_density_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_density);
-      } else {
-        density_(cell, qp) = (porosity_eb * ((ice_density_eb * icurr) + (water_density_eb * wcurr))) + ((1.0 - porosity_eb) * soil_density_eb);
-      }
+      // Soil properties, from the sediment fractions if given, or else from
+      // the element block
+      RealType const calc_soil_heat_capacity = profile.soil_heat_capacity[point];
+      RealType const calc_soil_thermal_cond  = profile.soil_thermal_cond[point];
+      RealType const calc_soil_density       = profile.soil_density[point];
+
+      // Update the effective material density
+      density_(cell, qp) = (porosity_eb * ((ice_density_eb * icurr) + (water_density_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_density);
 
       if (snow_given == true) {
         auto const SWE     = 0.10;
@@ -402,13 +337,8 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       }
 
       // Update the effective material heat capacity
-      if (sediment_given == true) {
-        heat_capacity_(cell, qp) =
-            (porosity_eb * ((ice_heat_capacity_eb * icurr) + (water_heat_capacity_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_heat_capacity);
-      } else {
-        heat_capacity_(cell, qp) =
-            (porosity_eb * ((ice_heat_capacity_eb * icurr) + (water_heat_capacity_eb * wcurr))) + ((1.0 - porosity_eb) * soil_heat_capacity_eb);
-      }
+      heat_capacity_(cell, qp) =
+          (porosity_eb * ((ice_heat_capacity_eb * icurr) + (water_heat_capacity_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_heat_capacity);
       // HACK!! HACK!! HACK!!
       // HACK!! HACK!! HACK!!
       heat_capacity_(cell, qp) = (1.0) * heat_capacity_(cell, qp);
@@ -418,15 +348,10 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       }
 
       // Update the effective material thermal conductivity
-      if (sediment_given == true) {
-        thermal_conductivity_(cell, qp) =
-            (porosity_eb * ((ice_thermal_cond_eb * icurr) + (water_thermal_cond_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_thermal_cond);
-        // thermal_conductivity_(cell, qp) =
-        //     pow(ice_thermal_cond_eb,(icurr*porosity_eb)) * pow(water_thermal_cond_eb,(wcurr*porosity_eb)) * pow(calc_soil_thermal_cond,(1.0 - porosity_eb));
-      } else {
-        thermal_conductivity_(cell, qp) =
-            (porosity_eb * ((ice_thermal_cond_eb * icurr) + (water_thermal_cond_eb * wcurr))) + ((1.0 - porosity_eb) * soil_thermal_cond_eb);
-      }
+      thermal_conductivity_(cell, qp) =
+          (porosity_eb * ((ice_thermal_cond_eb * icurr) + (water_thermal_cond_eb * wcurr))) + ((1.0 - porosity_eb) * calc_soil_thermal_cond);
+      // thermal_conductivity_(cell, qp) =
+      //     pow(ice_thermal_cond_eb,(icurr*porosity_eb)) * pow(water_thermal_cond_eb,(wcurr*porosity_eb)) * pow(calc_soil_thermal_cond,(1.0 - porosity_eb));
       // HACK!! HACK!! HACK!!
       // HACK!! HACK!! HACK!!
       thermal_conductivity_(cell, qp) = (1.0) * thermal_conductivity_(cell, qp);
@@ -560,6 +485,8 @@ ACEThermalParameters<EvalT, Traits>::createElementBlockParameterMaps()
     if (material_db_->isElementBlockParam(eb_name, "ACE Time File") == true) {
       std::string const filename = material_db_->getElementBlockParam<std::string>(eb_name, "ACE Time File");
       time_map_[eb_name]         = vectorFromFile(filename);
+      ALBANY_ASSERT(
+          std::is_sorted(time_map_[eb_name].begin(), time_map_[eb_name].end()) == true, "*** ERROR: Times in ACE Time File must be increasing.");
     }
     if (material_db_->isElementBlockParam(eb_name, "ACE Sea Level File") == true) {
       std::string const filename = material_db_->getElementBlockParam<std::string>(eb_name, "ACE Sea Level File");
@@ -568,6 +495,9 @@ ACEThermalParameters<EvalT, Traits>::createElementBlockParameterMaps()
     if (material_db_->isElementBlockParam(eb_name, "ACE Z Depth File") == true) {
       std::string const filename           = material_db_->getElementBlockParam<std::string>(eb_name, "ACE Z Depth File");
       z_above_mean_sea_level_map_[eb_name] = vectorFromFile(filename);
+      ALBANY_ASSERT(
+          std::is_sorted(z_above_mean_sea_level_map_[eb_name].begin(), z_above_mean_sea_level_map_[eb_name].end()) == true,
+          "*** ERROR: Z values in ACE Z Depth File must be increasing.");
     }
     if (material_db_->isElementBlockParam(eb_name, "ACE Salinity File") == true) {
       std::string const filename = material_db_->getElementBlockParam<std::string>(eb_name, "ACE Salinity File");
@@ -660,13 +590,116 @@ ACEThermalParameters<EvalT, Traits>::createElementBlockParameterMaps()
   }
 }
 
+// **********************************************************************
+template <typename EvalT, typename Traits>
+typename ACEThermalParameters<EvalT, Traits>::DepthProfile const&
+ACEThermalParameters<EvalT, Traits>::getDepthProfile(typename Traits::EvalData workset)
+{
+  std::string const& eb_name   = workset.EBName;
+  auto const         num_cells = workset.numCells;
+  auto const         ws        = workset.wsIndex;
+
+  if (depth_profiles_.size() <= ws) depth_profiles_.resize(ws + 1);
+  DepthProfile& profile = depth_profiles_[ws];
+
+  // The profiles are kept until the mesh changes the heights of the QPs.
+  bool is_current = profile.height.size() == num_cells * num_qps_;
+  for (std::size_t cell = 0; cell < num_cells && is_current == true; ++cell) {
+    for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+      if (profile.height[cell * num_qps_ + qp] != Sacado::Value<MeshScalarT>::eval(coord_vec_(cell, qp, 2))) {
+        is_current = false;
+        break;
+      }
+    }
+  }
+  if (is_current == true) return profile;
+
+  std::vector<RealType> const& z_above_mean_sea_level_eb = this->queryElementBlockParameterMap(eb_name, z_above_mean_sea_level_map_);
+  std::vector<RealType> const& salinity_eb               = this->queryElementBlockParameterMap(eb_name, salinity_map_);
+  std::vector<RealType> const& porosity_from_file_eb     = this->queryElementBlockParameterMap(eb_name, porosity_from_file_map_);
+  std::vector<RealType> const& sand_from_file_eb         = this->queryElementBlockParameterMap(eb_name, sand_from_file_map_);
+  std::vector<RealType> const& clay_from_file_eb         = this->queryElementBlockParameterMap(eb_name, clay_from_file_map_);
+  std::vector<RealType> const& silt_from_file_eb         = this->queryElementBlockParameterMap(eb_name, silt_from_file_map_);
+  std::vector<RealType> const& peat_from_file_eb         = this->queryElementBlockParameterMap(eb_name, peat_from_file_map_);
+
+  RealType const salinity_base_eb      = salinity_base_map_.at(eb_name);
+  RealType const porosity_bulk_eb      = porosity_bulk_map_.at(eb_name);
+  RealType const soil_density_eb       = soil_density_map_.at(eb_name);
+  RealType const soil_heat_capacity_eb = soil_heat_capacity_map_.at(eb_name);
+  RealType const soil_thermal_cond_eb  = soil_thermal_cond_map_.at(eb_name);
+
+  // Check if sediment fractions were provided
+  bool const sediment_given =
+      (sand_from_file_eb.size() > 0) && (clay_from_file_eb.size() > 0) && (silt_from_file_eb.size() > 0) && (peat_from_file_eb.size() > 0);
+
+  // IKT 2/17/2024: the air fraction of the "ACE Air File" would be evaluated
+  // here for Jenn to use. It is read but not used yet.
+
+  auto const num_points = num_cells * num_qps_;
+  profile.height.resize(num_points);
+  profile.salinity.resize(num_points);
+  profile.porosity.resize(num_points);
+  profile.freezing_curve_exponent.resize(num_points);
+  profile.temperature_shift.resize(num_points);
+  profile.soil_density.resize(num_points);
+  profile.soil_heat_capacity.resize(num_points);
+  profile.soil_thermal_cond.resize(num_points);
+
+  for (std::size_t cell = 0; cell < num_cells; ++cell) {
+    for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+      auto const     point  = cell * num_qps_ + qp;
+      RealType const height = Sacado::Value<MeshScalarT>::eval(coord_vec_(cell, qp, 2));
+      profile.height[point] = height;
+
+      profile.salinity[point] = salinity_eb.size() > 0 ? interpolateVectors(z_above_mean_sea_level_eb, salinity_eb, height) : salinity_base_eb;
+
+      // Calculate the depth-dependent porosity
+      profile.porosity[point] =
+          porosity_from_file_eb.size() > 0 ? interpolateVectors(z_above_mean_sea_level_eb, porosity_from_file_eb, height) : porosity_bulk_eb;
+
+      if (sediment_given == false) {
+        profile.freezing_curve_exponent[point] = 0.1;
+        profile.temperature_shift[point]       = 0.1;
+        profile.soil_density[point]            = soil_density_eb;
+        profile.soil_heat_capacity[point]      = soil_heat_capacity_eb;
+        profile.soil_thermal_cond[point]       = soil_thermal_cond_eb;
+        continue;
+      }
+
+      RealType const sand_frac = interpolateVectors(z_above_mean_sea_level_eb, sand_from_file_eb, height);
+      RealType const clay_frac = interpolateVectors(z_above_mean_sea_level_eb, clay_from_file_eb, height);
+      RealType const silt_frac = interpolateVectors(z_above_mean_sea_level_eb, silt_from_file_eb, height);
+      RealType const peat_frac = interpolateVectors(z_above_mean_sea_level_eb, peat_from_file_eb, height);
+
+      profile.freezing_curve_exponent[point] = (peat_frac * 0.1) + (sand_frac * 1.0) + (silt_frac * 15.0) + (clay_frac * 50.0);
+      profile.temperature_shift[point]       = (peat_frac * 0.1) + (sand_frac * 0.3) + (silt_frac * 0.6) + (clay_frac * 1.0);
+
+      // THERMAL PROPERTIES OF ROCKS, E.C. Robertson, U.S. Geological Survey
+      // Open-File Report 88-441 (1988).
+      // AGU presentation (2019) --> peat K value
+      // Gnatowski, Tomasz (2016) Thermal properties of degraded lowland
+      // peat-moorsh soils, EGU General Assembly 2016, held 17-22 April, 2016
+      // in Vienna Austria, id. EPSC2016-8105 --> peat Cp value Cp values in
+      // [J/kg/K]
+      profile.soil_heat_capacity[point] = (0.7e3 * sand_frac) + (0.6e3 * clay_frac) + (0.7e3 * silt_frac) + (1.93e3 * peat_frac);
+      // K values in [W/K/m]
+      profile.soil_thermal_cond[point] = (8.0 * sand_frac) + (0.4 * clay_frac) + (4.9 * silt_frac) + (0.40 * peat_frac);
+      // calc_soil_thermal_cond = (8.0 * sand_frac) + (0.4 * clay_frac) + (4.9 * silt_frac) + (0.08 * peat_frac);
+      // calc_soil_thermal_cond = pow(8.0,sand_frac) * pow(0.4,clay_frac) * pow(4.9,silt_frac) * pow(0.08,peat_frac);
+      //  Rho values in [kg/m3]
+      //  Peat density from Emily Bristol
+      profile.soil_density[point] = (2600.0 * sand_frac) + (2350.0 * clay_frac) + (2500.0 * silt_frac) + (250.0 * peat_frac);
+    }
+  }
+  return profile;
+}
+
 // **********************************************************************
 template <typename EvalT, typename Traits>
 typename EvalT::ScalarT
-ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType> map)
+ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const& eb_name, std::map<std::string, RealType> const& map) const
 {
-  typename std::map<std::string, RealType>::const_iterator it;
-  it = map.find(eb_name);
+  auto const it = map.find(eb_name);
   if (it == map.end()) {
     ALBANY_ABORT("\nError! Element block = " << eb_name << " was not found in map!\n");
   }
@@ -675,16 +708,15 @@ ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string c
 // **********************************************************************
 
 template <typename EvalT, typename Traits>
-std::vector<RealType>
-ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>> map)
+std::vector<RealType> const&
+ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const& eb_name, std::map<std::string, std::vector<RealType>> const& map) const
 {
-  typename std::map<std::string, std::vector<RealType>>::const_iterator it;
-  it = map.find(eb_name);
+  static std::vector<RealType> const empty;
+
+  auto const it = map.find(eb_name);
   if (it == map.end()) {
     // Element block is not found in map - return std::vector of length 0
-    std::vector<RealType> vec;
-    vec.resize(0);
-    return vec;
+    return empty;
   }
   return it->second;
 }
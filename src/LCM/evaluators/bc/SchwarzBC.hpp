@@ -5,6 +5,8 @@
 #if !defined(LCM_SchwarzBC_hpp)
 #define LCM_SchwarzBC_hpp
 
+#include <vector>
+
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -22,6 +24,25 @@
 
 namespace LCM {
 
+///
+/// Interpolation of the coupled application at a node of the Schwarz
+/// boundary of this application: the global ids of the nodes of the coupled
+/// element that contains the node, and the values of their basis functions
+/// at it.
+///
+struct SchwarzInterpolation
+{
+  std::vector<GO>     node_gids;
+  std::vector<double> basis_values;
+};
+
+///
+/// Find the interpolation at node ns_node of the node set of this_app that
+/// is coupled to the application with index coupled_app_index.
+///
+SchwarzInterpolation
+findSchwarzInterpolation(Albany::Application const& this_app, int const coupled_app_index, std::size_t const ns_node);
+
 // \brief Schwarz for models BC Dirichlet evaluator
 
 // Specialization of the DirichletBase class
@@ -58,211 +58,30 @@ SchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val, T& y_v
     return;
   }
 
-  auto const this_app_index = getThisAppIndex();
+  Albany::Application const& this_app = getApplication(getThisAppIndex());
 
-  Albany::Application const& this_app = getApplication(this_app_index);
-
-  Teuchos::RCP<Albany::AbstractDiscretization> this_disc = this_app.getDiscretization();
-
-  auto* this_stk_disc = static_cast<Albany::STKDiscretization*>(this_disc.get());
+  SchwarzInterpolation const interpolation = findSchwarzInterpolation(this_app, coupled_app_index, ns_node);
 
   Teuchos::RCP<Albany::AbstractDiscretization> coupled_disc = coupled_app.getDiscretization();
 
   auto* coupled_stk_disc = static_cast<Albany::STKDiscretization*>(coupled_disc.get());
 
-  auto& coupled_gms = dynamic_cast<Albany::GenericSTKMeshStruct&>(*(coupled_stk_disc->getSTKMeshStruct()));
-
-  auto const& coupled_ws_eb_names = coupled_disc->getWsEBNames();
-
-  Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>> coupled_mesh_specs = coupled_gms.getMeshSpecs();
-
-  // Get cell topology of the application and block to which this node set
-  // is coupled.
-  std::string const& this_app_name      = this_app.getAppName();
-  std::string const& coupled_app_name   = coupled_app.getAppName();
-  std::string const  coupled_block_name = this_app.getCoupledBlockName(coupled_app_index);
-
-  bool const use_block = coupled_block_name != "NONE";
-
-  std::map<std::string, int> const& coupled_block_name_to_index = coupled_gms.getMeshSpecs()[0]->ebNameToIndex;
-
-  auto       it            = coupled_block_name_to_index.find(coupled_block_name);
-  bool const missing_block = it == coupled_block_name_to_index.end();
-
-  if (use_block == true && missing_block == true) {
-    std::cerr << "\nERROR: " << __PRETTY_FUNCTION__ << '\n';
-    std::cerr << "Unknown coupled block: " << coupled_block_name << '\n';
-    std::cerr << "Coupling application : " << this_app_name << '\n';
-    std::cerr << "To application       : " << coupled_app_name << '\n';
-    exit(1);
-  }
-
-  // When ignoring the block, set the index to zero to get defaults
-  // corresponding to the first block.
-  auto const coupled_block_index = use_block == true ? it->second : 0;
-
-  CellTopologyData const coupled_cell_topology_data = coupled_mesh_specs[coupled_block_index]->ctd;
-
-  shards::CellTopology coupled_cell_topology(&coupled_cell_topology_data);
-  auto const           coupled_dimension  = coupled_cell_topology_data.dimension;
-  auto const           coupled_node_count = coupled_cell_topology_data.node_count;
-
-  std::string const& coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
-
-  std::vector<double*> const& ns_coord = this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second;
-
-  auto const& ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
-
-  std::vector<minitensor::Vector<double>> coupled_element_nodes(coupled_node_count);
-
-  std::vector<minitensor::Vector<double>> coupled_element_solution(coupled_node_count);
-
-  for (unsigned i = 0; i < coupled_node_count; ++i) {
-    coupled_element_nodes[i].set_dimension(coupled_dimension);
-    coupled_element_solution[i].set_dimension(coupled_dimension);
-  }
-
-  // This tolerance is used for geometric approximations. It will be used
-  // to determine whether a node of this_app is inside an element of
-  // coupled_app within that tolerance.
-  double const tolerance = 5.0e-2;
-
-  auto const parametric_dimension = coupled_dimension;
-  auto const coupled_vertex_count = coupled_cell_topology_data.vertex_count;
-  auto const coupled_element_type = minitensor::find_type(coupled_dimension, coupled_vertex_count);
-
-  minitensor::Vector<double> lo(parametric_dimension, minitensor::Filler::ONES);
-  minitensor::Vector<double> hi(parametric_dimension, minitensor::Filler::ONES);
-
-  hi = hi * (1.0 + tolerance);
-
-  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> basis;
-
-  switch (coupled_element_type) {
-    default: MT_ERROR_EXIT("Unknown element type"); break;
-
-    case minitensor::ELEMENT::TETRAHEDRAL:
-      basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_TET_C1_FEM<PHX::Device>());
-      lo    = -tolerance * lo;
-      break;
-
-    case minitensor::ELEMENT::HEXAHEDRAL:
-      basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_HEX_C1_FEM<PHX::Device>());
-      lo    = -lo * (1.0 + tolerance);
-      break;
-  }
-
-  double* const              coord = ns_coord[ns_node];
-  minitensor::Vector<double> point;
-  point.set_dimension(coupled_dimension);
-  point.fill(coord);
-
-  // Determine the element that contains this point.
-  Teuchos::ArrayRCP<double> const& coupled_coordinates = coupled_stk_disc->getCoordinates();
+  auto const coupled_dimension = coupled_stk_disc->getNumDim();
 
   Teuchos::ArrayRCP<ST const> coupled_solution_view = Albany::getLocalData(coupled_solution);
 
-  Teuchos::RCP<Thyra_VectorSpace const> coupled_overlap_node_vs = coupled_stk_disc->getOverlapNodeVectorSpace();
-
-  // We do this element by element
-  auto const number_cells = 1;
-
-  // We do this point by point
-  auto const number_points = 1;
-
-  // Container for the parametric coordinates
-  Kokkos::DynRankView<RealType, PHX::Device> parametric_point("par_point", number_cells, number_points, parametric_dimension);
-
-  for (unsigned j = 0; j < parametric_dimension; ++j) {
-    parametric_point(0, 0, j) = 0.0;
-  }
-
-  // Container for the physical point
-  Kokkos::DynRankView<RealType, PHX::Device> physical_coordinates("phys_point", number_cells, number_points, coupled_dimension);
-
-  for (unsigned i = 0; i < coupled_dimension; ++i) {
-    physical_coordinates(0, 0, i) = point(i);
-  }
-
-  // Container for the physical nodal coordinates
-  Kokkos::DynRankView<RealType, PHX::Device> nodal_coordinates("coords", number_cells, coupled_node_count, coupled_dimension);
-
-  bool found = false;
-
-  auto coupled_ov_node_vs_indexer = Albany::createGlobalLocalIndexer(coupled_overlap_node_vs);
-  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
-    std::string const& coupled_element_block = coupled_ws_eb_names[workset];
-
-    bool const block_names_differ = coupled_element_block != coupled_block_name;
-    if (use_block == true && block_names_differ == true) continue;
-    auto const elements_per_workset = ws_elem_to_node_id[workset].size();
-
-    for (auto element = 0; element < elements_per_workset; ++element) {
-      for (unsigned node = 0; node < coupled_node_count; ++node) {
-        auto const global_node_id = ws_elem_to_node_id[workset][element][node];
-
-        auto const local_node_id = coupled_ov_node_vs_indexer->getLocalElement(global_node_id);
-
-        double* const pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
-
-        coupled_element_nodes[node].fill(pcoord);
-
-        for (unsigned i = 0; i < coupled_dimension; ++i) {
-          coupled_element_solution[node](i) = coupled_solution_view[coupled_dimension * local_node_id + i];
-        }  // dimension loop
-
-      }  // node loop
-
-      for (unsigned i = 0; i < coupled_node_count; ++i) {
-        for (unsigned j = 0; j < coupled_dimension; ++j) {
-          nodal_coordinates(0, i, j) = coupled_element_nodes[i](j);
-        }
-      }
-
-      // Get parametric coordinates
-      Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(parametric_point, physical_coordinates, nodal_coordinates, coupled_cell_topology);
-
-      bool in_element = true;
-
-      for (unsigned i = 0; i < parametric_dimension; ++i) {
-        auto const xi = parametric_point(0, 0, i);
-        in_element    = in_element && lo(i) <= xi && xi <= hi(i);
-      }
-
-      if (in_element == true) {
-        found = true;
-        break;
-      }
-
-    }  // element loop
-
-    if (found == true) {
-      break;
-    }
-
-  }  // workset loop
-
-  ALBANY_EXPECT(found == true);
-
-  // Evaluate shape functions at parametric point.
-  Kokkos::DynRankView<RealType, PHX::Device> basis_values("basis", coupled_node_count, number_points);
-
-  // Another container for the parametric coordinates. Needed because above
-  // it is required that parametric_points has rank 3 for mapToReferenceFrame
-  // but here basis->getValues requires a rank 2 view :(
-  Kokkos::DynRankView<RealType, PHX::Device> pp_reduced("par_point", number_points, parametric_dimension);
-
-  for (unsigned j = 0; j < parametric_dimension; ++j) {
-    pp_reduced(0, j) = parametric_point(0, 0, j);
-  }
-  basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
+  auto coupled_ov_node_vs_indexer = Albany::createGlobalLocalIndexer(coupled_stk_disc->getOverlapNodeVectorSpace());
 
   // Evaluate solution at parametric point using values of shape
-  // functions just computed.
+  // functions of the coupled element.
   minitensor::Vector<double> value(coupled_dimension, minitensor::Filler::ZEROS);
 
-  for (unsigned i = 0; i < coupled_node_count; ++i) {
-    value += basis_values(i, 0) * coupled_element_solution[i];
+  for (unsigned node = 0; node < interpolation.node_gids.size(); ++node) {
+    auto const local_node_id = coupled_ov_node_vs_indexer->getLocalElement(interpolation.node_gids[node]);
+
+    for (unsigned i = 0; i < coupled_dimension; ++i) {
+      value(i) += interpolation.basis_values[node] * coupled_solution_view[coupled_dimension * local_node_id + i];
+    }
   }
 
   x_val = value(0);
@@ -8,7 +8,9 @@
 // #include "Albany_ProblemUtils.hpp"
 #include <Phalanx_DataLayout_MDALayout.hpp>
 #include <Teuchos_AbstractFactoryStd.hpp>
+#include <Thyra_VectorStdOps.hpp>
 
+#include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Utils.hpp"
@@ -43,7 +45,19 @@ class ProjectIPtoNodalFieldManager : public Adapt::NodalDataBase::Manager
   // using.
   int ndb_start, ndb_numvecs;
 
-  ProjectIPtoNodalFieldManager() : nwrkr_(0), prectr_(0), postctr_(0) {}
+  // The mass matrix depends only on the mesh. It is assembled and factored
+  // once for the nodal graph in ovl_graph_factory, together with the
+  // communication plans and the vectors below, and reused by every projection
+  // until the discretization replaces the nodal graph.
+  bool                                                 mass_is_current;
+  Teuchos::RCP<const Albany::GlobalLocalIndexer>       ip_field_indexer;
+  Teuchos::RCP<const Albany::CombineAndScatterManager> cas_manager;
+  Teuchos::RCP<const Albany::CombineAndScatterManager> ndv_cas_manager;
+  Teuchos::RCP<Thyra_MultiVector>                      owned_ip_field;
+  Teuchos::RCP<Thyra_MultiVector>                      node_projected_ip_field;
+  Teuchos::RCP<Thyra_MultiVector>                      ovl_node_projected_ip_field;
+
+  ProjectIPtoNodalFieldManager() : mass_is_current(false), nwrkr_(0), prectr_(0), postctr_(0) {}
 
   void
   registerWorker()
@@ -280,17 +294,27 @@ class ProjectIPtoNodalFieldManager::MassLinearOp
  public:
   virtual ~MassLinearOp() {}
 
+  // Allocate the overlapped storage the mass matrix is assembled into.
+  virtual void
+  prepare(const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>& ovl_graph_factory) = 0;
+
   virtual void
   fill(
       const PHAL::Workset&                                       workset,
       const PHX::MDField<const RealType, Cell, Node, QuadPoint>& bf,
       const PHX::MDField<const RealType, Cell, Node, QuadPoint>& wbf) = 0;
 
-  Teuchos::RCP<Thyra_LinearOp>&
-  linear_op()
-  {
-    return linear_op_;
-  }
+  // Combine the assembled mass matrix into its one-to-one form and set up
+  // everything solve() needs. The overlapped storage is released.
+  virtual void
+  finalize(
+      const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>&     ovl_graph_factory,
+      const Teuchos::RCP<const Albany::CombineAndScatterManager>&  cas_manager,
+      const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST>>& lows_factory) = 0;
+
+  // Solve M x = b for all columns of b at once.
+  virtual Thyra::SolveStatus<ST>
+  solve(const Thyra_MultiVector& b, Thyra_MultiVector& x) const = 0;
 
   bool&
   is_static()
@@ -302,13 +326,19 @@ class ProjectIPtoNodalFieldManager::MassLinearOp
   create(EMassLinearOpType::Enum type);
 
  protected:
-  Teuchos::RCP<Thyra_LinearOp> linear_op_;
-  bool                         is_static_;
+  bool is_static_;
 };
 
 class ProjectIPtoNodalFieldManager::FullMassLinearOp : public ProjectIPtoNodalFieldManager::MassLinearOp
 {
  public:
+  virtual void
+  prepare(const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>& ovl_graph_factory)
+  {
+    ovl_linear_op_ = ovl_graph_factory->createOp();
+    Albany::resumeFill(ovl_linear_op_);
+  }
+
   virtual void
   fill(
       const PHAL::Workset&                                       workset,
@@ -317,69 +347,138 @@ class ProjectIPtoNodalFieldManager::FullMassLinearOp : public ProjectIPtoNodalFi
   {
     int const  num_nodes = bf.extent(1), num_pts = bf.extent(2);
     bool const is_static_graph = this->is_static();
+    Teuchos::Array<GO> cols(num_nodes);
+    Teuchos::Array<ST> vals(num_nodes);
     for (unsigned int cell = 0; cell < workset.numCells; ++cell) {
+      for (int cnode = 0; cnode < num_nodes; ++cnode) cols[cnode] = workset.wsElNodeID[cell][cnode];
       for (int rnode = 0; rnode < num_nodes; ++rnode) {
-        GO                 global_row = workset.wsElNodeID[cell][rnode];
-        Teuchos::Array<GO> cols;
-        Teuchos::Array<ST> vals;
+        GO global_row = workset.wsElNodeID[cell][rnode];
 
         for (int cnode = 0; cnode < num_nodes; ++cnode) {
-          const GO global_col = workset.wsElNodeID[cell][cnode];
-          cols.push_back(global_col);
-
           ST mass_value = 0;
           for (int qp = 0; qp < num_pts; ++qp) mass_value += wbf(cell, rnode, qp) * bf(cell, cnode, qp);
-          vals.push_back(mass_value);
+          vals[cnode] = mass_value;
         }
         if (is_static_graph) {
-          const LO ret = Albany::addToGlobalRowValues(this->linear_op_, global_row, cols(), vals());
+          const LO ret = Albany::addToGlobalRowValues(ovl_linear_op_, global_row, cols(), vals());
           ALBANY_PANIC(ret != 0, "Albany::addToGlobalRowValues failed: global row " << global_row << " of mass matrix is missing elements \n");
         } else {
           ALBANY_ABORT(
               "Albany is switching to static graph, so ProjectIPtoNodalField \n"
               << "response is not supported with dynamic graph!\n");
           // IKT, FIXME: does this case need to be implemented?
-          Albany::addToGlobalRowValues(this->linear_op_, global_row, cols(), vals());
+          Albany::addToGlobalRowValues(ovl_linear_op_, global_row, cols(), vals());
         }
       }
     }
   }
+
+  virtual void
+  finalize(
+      const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>&     ovl_graph_factory,
+      const Teuchos::RCP<const Albany::CombineAndScatterManager>&  cas_manager,
+      const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST>>& lows_factory)
+  {
+    // Ifpack2 assumes the row map is nonoverlapping, so export the mass matrix
+    // to a new matrix having nonoverlapping row and col maps.
+    // IKT, note to self: the following is an owned graph factory built from
+    // an overlap graph factory
+    Teuchos::RCP<Thyra_VectorSpace const> const space = cas_manager->getOwnedVectorSpace();
+    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> mm_graph_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(space, space, ovl_graph_factory));
+    Teuchos::RCP<Thyra_LinearOp>                mm               = mm_graph_factory->createOp();
+    // IKT, note to self: we are going from overlap space to owned space -> use
+    // combine method Arguments of combine are (src, tgt) IKT, note to self: the
+    // resumeFill and fillComplete before/after combine are critical!!
+    Albany::resumeFill(mm);
+    cas_manager->combine(*ovl_linear_op_, *mm, Albany::CombineMode::ADD);
+    Albany::fillComplete(mm);
+    // We don't need the assemble form of the mass matrix any longer.
+    ovl_linear_op_ = Teuchos::null;
+
+    // Set up the solver, and with it the preconditioner, once for all solves.
+    nsA_ = lows_factory->createOp();
+    Thyra::initializeOp<ST>(*lows_factory, mm, nsA_.ptr());
+  }
+
+  virtual Thyra::SolveStatus<ST>
+  solve(const Thyra_MultiVector& b, Thyra_MultiVector& x) const
+  {
+    return Thyra::solve(*nsA_, Thyra::NOTRANS, b, Teuchos::ptrFromRef(x));
+  }
+
+ private:
+  Teuchos::RCP<Thyra_LinearOp>                   ovl_linear_op_;
+  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>> nsA_;
 };
 
+// The lumped mass matrix is diagonal, so it is kept as a vector and its solve
+// is a scaling by the inverse diagonal. Neither a matrix nor Belos is needed.
 class ProjectIPtoNodalFieldManager::LumpedMassLinearOp : public ProjectIPtoNodalFieldManager::MassLinearOp
 {
  public:
+  virtual void
+  prepare(const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>& ovl_graph_factory)
+  {
+    Teuchos::RCP<Thyra_VectorSpace const> const ovl_space = ovl_graph_factory->getRangeVectorSpace();
+    ovl_diag_                                             = Thyra::createMember(ovl_space);
+    ovl_diag_->assign(0.0);
+    ovl_diag_view_ = Albany::getNonconstLocalData(ovl_diag_);
+    ovl_indexer_   = Albany::createGlobalLocalIndexer(ovl_space);
+  }
+
   virtual void
   fill(
       const PHAL::Workset&                                       workset,
       const PHX::MDField<const RealType, Cell, Node, QuadPoint>& bf,
       const PHX::MDField<const RealType, Cell, Node, QuadPoint>& wbf)
   {
-    int const  num_nodes = bf.extent(1), num_pts = bf.extent(2);
-    bool const is_static_graph = this->is_static();
+    int const num_nodes = bf.extent(1), num_pts = bf.extent(2);
     for (unsigned int cell = 0; cell < workset.numCells; ++cell) {
       for (int rnode = 0; rnode < num_nodes; ++rnode) {
-        const GO                 global_row = workset.wsElNodeID[cell][rnode];
-        const Teuchos::Array<GO> cols(1, global_row);
-        double                   diag = 0;
+        const GO global_row = workset.wsElNodeID[cell][rnode];
+        double   diag       = 0;
         for (int qp = 0; qp < num_pts; ++qp) {
           double diag_qp = 0;
           for (int cnode = 0; cnode < num_nodes; ++cnode) diag_qp += bf(cell, cnode, qp);
           diag += wbf(cell, rnode, qp) * diag_qp;
         }
-        const Teuchos::Array<ST> vals(1, diag);
-        if (is_static_graph) {
-          Albany::addToGlobalRowValues(this->linear_op_, global_row, cols(), vals());
-        } else {
-          ALBANY_ABORT(
-              "Albany is switching to static graph, so ProjectIPtoNodalField \n"
-              << "response is not supported with dynamic graph!\n");
-          // IKT, FIXME: does this case need to be implemented?
-          Albany::addToGlobalRowValues(this->linear_op_, global_row, cols, vals);
-        }
+        ovl_diag_view_[ovl_indexer_->getLocalElement(global_row)] += diag;
       }
     }
   }
+
+  virtual void
+  finalize(
+      const Teuchos::RCP<const Albany::ThyraCrsMatrixFactory>& /* ovl_graph_factory */,
+      const Teuchos::RCP<const Albany::CombineAndScatterManager>& cas_manager,
+      const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST>>& /* lows_factory */)
+  {
+    inv_diag_ = Thyra::createMember(cas_manager->getOwnedVectorSpace());
+    inv_diag_->assign(0.0);
+    cas_manager->combine(*ovl_diag_, *inv_diag_, Albany::CombineMode::ADD);
+    Thyra::reciprocal<ST>(*inv_diag_, inv_diag_.ptr());
+    ovl_diag_      = Teuchos::null;
+    ovl_diag_view_ = Teuchos::null;
+    ovl_indexer_   = Teuchos::null;
+  }
+
+  virtual Thyra::SolveStatus<ST>
+  solve(const Thyra_MultiVector& b, Thyra_MultiVector& x) const
+  {
+    for (int i = 0; i < b.domain()->dim(); ++i) {
+      x.col(i)->assign(0.0);
+      Thyra::ele_wise_prod<ST>(1.0, *b.col(i), *inv_diag_, x.col(i).ptr());
+    }
+    Thyra::SolveStatus<ST> status;
+    status.solveStatus = Thyra::SOLVE_STATUS_CONVERGED;
+    return status;
+  }
+
+ private:
+  Teuchos::RCP<Thyra_Vector>                     ovl_diag_;
+  Teuchos::ArrayRCP<ST>                          ovl_diag_view_;
+  Teuchos::RCP<const Albany::GlobalLocalIndexer> ovl_indexer_;
+  Teuchos::RCP<Thyra_Vector>                     inv_diag_;
 };
 
 typename ProjectIPtoNodalFieldManager::MassLinearOp*
@@ -556,11 +655,12 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::preEvaluate(ty
   bool const am_first = ctr == 1;
   if (!am_first) return;
 
-  // Reallocate the mass matrix for assembly. Since the matrix is overwritten by
-  // a version used for linear algebra having a nonoverlapping row map, we can't
-  // just resumeFill. ip_field also alternates between overlapping
-  // and nonoverlapping maps and so must be reallocated.
-  mgr_->ovl_graph_factory           = p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalOpFactory();
+  // The mass matrix is reassembled only if the discretization has replaced
+  // the nodal graph since it was last built, i.e., if the mesh has changed.
+  Teuchos::RCP<const Albany::ThyraCrsMatrixFactory> const ovl_graph_factory =
+      p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalOpFactory();
+  mgr_->mass_is_current             = mgr_->mass_is_current && ovl_graph_factory.getRawPtr() == mgr_->ovl_graph_factory.getRawPtr();
+  mgr_->ovl_graph_factory           = ovl_graph_factory;
   mgr_->mass_linear_op->is_static() = true;
   if (Teuchos::is_null(mgr_->ovl_graph_factory)) {
     ALBANY_ABORT(
@@ -577,8 +677,24 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::preEvaluate(ty
     ovl_graph_factory_nonconst->fillComplete();
     mgr_->ovl_graph_factory = Teuchos::rcp_dynamic_cast<const Albany::ThyraCrsMatrixFactory>(ovl_graph_factory_nonconst);
   }
-  mgr_->mass_linear_op->linear_op() = mgr_->ovl_graph_factory->createOp();
-  mgr_->ip_field                    = Thyra::createMembers(mgr_->ovl_graph_factory->getRangeVectorSpace(), mgr_->ndb_numvecs);
+
+  if (!mgr_->mass_is_current) {
+    // Allocate the mass matrix for assembly, and everything else that lives on
+    // the nodal maps of this mesh.
+    Teuchos::RCP<Thyra_VectorSpace const> const ovl_space = mgr_->ovl_graph_factory->getRangeVectorSpace();
+    Teuchos::RCP<Thyra_VectorSpace const> const space     = Albany::createOneToOneVectorSpace(ovl_space);
+    Teuchos::RCP<Thyra_VectorSpace const> const ndv_ovl_space =
+        p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalDataVector()->getOverlappedVectorSpace();
+    mgr_->mass_linear_op->prepare(mgr_->ovl_graph_factory);
+    // IKT, note to self: cas_manager arguments are (owned, overlapped)
+    mgr_->cas_manager                 = Albany::createCombineAndScatterManager(space, ovl_space);
+    mgr_->ndv_cas_manager             = Albany::createCombineAndScatterManager(space, ndv_ovl_space);
+    mgr_->ip_field                    = Thyra::createMembers(ovl_space, mgr_->ndb_numvecs);
+    mgr_->ip_field_indexer            = Albany::createGlobalLocalIndexer(ovl_space);
+    mgr_->owned_ip_field              = Thyra::createMembers(space, mgr_->ndb_numvecs);
+    mgr_->node_projected_ip_field     = Thyra::createMembers(space, mgr_->ndb_numvecs);
+    mgr_->ovl_node_projected_ip_field = Thyra::createMembers(ndv_ovl_space, mgr_->ndb_numvecs);
+  }
   mgr_->ip_field->assign(0.0);
 }
 
@@ -599,8 +715,7 @@ ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::fillRHS(const typen
 #endif
       ;
 
-  Teuchos::RCP<Thyra_VectorSpace const> ip_field_space      = mgr_->ip_field->col(0)->space();
-  auto                                  ip_field_vs_indexer = Albany::createGlobalLocalIndexer(ip_field_space);
+  const Teuchos::RCP<const Albany::GlobalLocalIndexer>& ip_field_vs_indexer = mgr_->ip_field_indexer;
   for (int field = 0; field < num_fields; ++field) {
     int node_var_offset, node_var_ndofs;
     node_data->getNDofsAndOffset(nodal_field_names_[field], node_var_offset, node_var_ndofs);
@@ -645,12 +760,13 @@ template <typename Traits>
 void
 ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  Albany::resumeFill(mgr_->mass_linear_op->linear_op());
-  if (Teuchos::nonnull(quad_mgr_)) {
-    quad_mgr_->evaluateBasis(coords_verts_);
-    mgr_->mass_linear_op->fill(workset, quad_mgr_->bf_const(), quad_mgr_->wbf_const());
-  } else {
-    mgr_->mass_linear_op->fill(workset, BF, wBF);
+  if (!mgr_->mass_is_current) {
+    if (Teuchos::nonnull(quad_mgr_)) {
+      quad_mgr_->evaluateBasis(coords_verts_);
+      mgr_->mass_linear_op->fill(workset, quad_mgr_->bf_const(), quad_mgr_->wbf_const());
+    } else {
+      mgr_->mass_linear_op->fill(workset, BF, wBF);
+    }
   }
 #if defined(PROJ_INTERP_TEST)
   for (unsigned int cell = 0; cell < workset.numCells; ++cell)
@@ -669,28 +785,13 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::postEvaluate(t
 
   typedef Teuchos::ScalarTraits<ST>::magnitudeType MT;
 
-  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
-
-  // IKT, note to self: in original Tpetra code, we had the following
-  // fillComplete. mgr_->mass_linear_op->linear_op()->fillComplete(); This is
-  // not needed in the Thyra code b/c fillComplete gets called in createOp(),
-  // which we call on mgr_->mass_linear_op->linear_op() in preEvaluate.
-
-  // Right now, ip_field and mass_linear_op->linear_op() have the same
-  // overlapping (row) map.
-  //   1. If we're not using a preconditioner, then we could fillComplete the
-  // mass matrix with valid 1-1 domain and range maps, export ip_field to b,
-  // where b has the mass matrix's range map, and proceed. The linear algebra
-  // using the matrix would be limited to matrix-vector products, which would
-  // use these valid range and domain maps.
-  //   2. However, we want to use Ifpack2, and Ifpack2 assumes the row map is
-  // nonoverlapping. (This assumption makes sense because of the type of
-  // operations Ifpack2 performs.) Hence I export mass matrix to a new matrix
-  // having nonoverlapping row and col maps. As in case 1, I also have to create
-  // a compatible b.
-  {
-    // Get overlapping and nonoverlapping maps.
-    const Teuchos::RCP<const Thyra_LinearOp>& mm_ovl = mgr_->mass_linear_op->linear_op();
+  // Right now, ip_field and the assembled mass matrix have the same
+  // overlapping (row) map. We want to use Ifpack2, and Ifpack2 assumes the row
+  // map is nonoverlapping, so the mass matrix is exported to a matrix having
+  // nonoverlapping row and col maps, and ip_field to a compatible b. The mass
+  // matrix and its preconditioner are built on the first projection after a
+  // mesh change only.
+  if (!mgr_->mass_is_current) {
     if (!mgr_->mass_linear_op->is_static()) {
       ALBANY_ABORT(
           "Albany is switching to static graph, so ProjectIPtoNodalField \n"
@@ -700,79 +801,41 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::postEvaluate(t
       // IKT, FIXME: does this case need to be implemented?
       p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->updateNodalGraph(mgr_->ovl_graph_factory);
     }
-    Teuchos::RCP<Thyra_VectorSpace const> const ovl_space = mgr_->ovl_graph_factory->getRangeVectorSpace();
-    Teuchos::RCP<Thyra_VectorSpace const> const space     = Albany::createOneToOneVectorSpace(ovl_space);
-    // Export the mass matrix.
-    // IKT, the last argument in the following line tells the code to use a
-    // static profile to build the graph.  If this is not true, that needs to
-    // change.
-    // Albany::ThyraCrsMatrixFactory mm_graph_factory =
-    //  Albany::ThyraCrsMatrixFactory(space, space,
-    //  Albany::getGlobalMaxNumRowEntries(mm_ovl), true);
-    // IKT, note to self: the following is an owned graph factory built from
-    // an overlap graph factory
-    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> mm_graph_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(space, space, mgr_->ovl_graph_factory));
-    Teuchos::RCP<Thyra_LinearOp>                mm               = mm_graph_factory->createOp();
-    // IKT, note to self: createOp calls fillComplete() on the matrix that is
-    // returned before it is returned
-    // IKT, note to self: cas_manager arguments are (owned, overlapped)
-    auto cas_manager = Albany::createCombineAndScatterManager(space, ovl_space);
-    // IKT, note to self: we are going from overlap space to owned space -> use
-    // combine method Arguments of combine are (src, tgt) IKT, note to self: the
-    // resumeFill and fillComplete before/after combine are critical!!
-    Albany::resumeFill(mm);
-    cas_manager->combine(mm_ovl, mm, Albany::CombineMode::ADD);
-    Albany::fillComplete(mm);
-    // We don't need the assemble form of the mass matrix any longer.
-    mgr_->mass_linear_op->linear_op() = mm;
-    // IKT, note to self: the original code has a fillComplete() here.  I don't
-    // think we need it because createOp() calls fillComplete.
-    // mm->fillComplete();
-
-    // Now export ip_field.
-    // IKT, note to self: ipf has owned layout, since it is that of mm.
-    Teuchos::RCP<Thyra_MultiVector> ipf = Thyra::createMembers(mm->range(), Albany::getNumVectors(mgr_->ip_field));
-    // IKT, not to self: we are going from overlap space to owned space -> use
-    // combine method Arguments of combine are (src, tgt)
-    cas_manager->combine(mgr_->ip_field, ipf, Albany::CombineMode::ADD);
-    // Don't need the assemble form of the ip_field either.
-    mgr_->ip_field = ipf;
+    mgr_->mass_linear_op->finalize(mgr_->ovl_graph_factory, mgr_->cas_manager, lowsFactory_);
+    mgr_->mass_is_current = true;
   }
-  // Create x in A x = b.
-  Teuchos::RCP<Thyra_MultiVector> node_projected_ip_field =
-      Thyra::createMembers(mgr_->mass_linear_op->linear_op()->domain(), Albany::getNumVectors(mgr_->ip_field));
-  node_projected_ip_field->assign(0.0);
-  const Teuchos::RCP<Thyra_LinearOp>             A   = mgr_->mass_linear_op->linear_op();
-  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>> nsA = lowsFactory_->createOp();
-  Thyra::initializeOp<ST>(*lowsFactory_, A, nsA.ptr());
-  Teuchos::RCP<Thyra_MultiVector> x = node_projected_ip_field;
-  Teuchos::RCP<Thyra_MultiVector> b = mgr_->ip_field;
+
+  // Now export ip_field.
+  // IKT, not to self: we are going from overlap space to owned space -> use
+  // combine method Arguments of combine are (src, tgt)
+  Teuchos::RCP<Thyra_MultiVector> b = mgr_->owned_ip_field;
+  b->assign(0.0);
+  mgr_->cas_manager->combine(*mgr_->ip_field, *b, Albany::CombineMode::ADD);
 
   // Compute the column norms of the right-hand side b. If b = 0, no need to
   // proceed.
-  Teuchos::Array<MT> norm_b(Albany::getNumVectors(mgr_->ip_field));
+  int const          num_vecs = Albany::getNumVectors(b);
+  Teuchos::Array<MT> norm_b(num_vecs);
   Thyra::norms_2(*b, norm_b());
   bool b_is_zero = true;
-  for (int i = 0; i < Albany::getNumVectors(mgr_->ip_field); ++i)
+  for (int i = 0; i < num_vecs; ++i)
     if (norm_b[i] != 0) {
       b_is_zero = false;
       break;
     }
   if (b_is_zero) return;
 
-  Thyra::SolveStatus<ST> solveStatus = Thyra::solve(*nsA, Thyra::NOTRANS, *b, x.ptr());
+  // Solve for all projected fields at once.
+  Teuchos::RCP<Thyra_MultiVector> x = mgr_->node_projected_ip_field;
+  x->assign(0.0);
+  Thyra::SolveStatus<ST> solveStatus = mgr_->mass_linear_op->solve(*b, *x);
   {  // Store the overlapped vector data back in stk.
-    Teuchos::RCP<Thyra_VectorSpace const> const ovl_space =
-        (p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalDataVector()->getOverlappedVectorSpace());
-    Teuchos::RCP<Thyra_VectorSpace const> const space = node_projected_ip_field->col(0)->space();
-    Teuchos::RCP<Thyra_MultiVector>             npif  = Thyra::createMembers(ovl_space, Albany::getNumVectors(node_projected_ip_field));
+    Teuchos::RCP<Thyra_MultiVector> npif = mgr_->ovl_node_projected_ip_field;
     npif->assign(0.0);
-    // IKT, note to self: cas_manager arguments are (owned, overlapped)
-    auto cas_manager = Albany::createCombineAndScatterManager(space, ovl_space);
     // IKT, not to self: we are going from owned space (node_projected_ip_field)
     // to overlap space (npif) -> use scatter method Arguments of scatter are
     // (src, tgt)
-    cas_manager->scatter(node_projected_ip_field, npif, Albany::CombineMode::ADD);
+    mgr_->ndv_cas_manager->scatter(*x, *npif, Albany::CombineMode::ADD);
     p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalDataVector()->saveNodalDataState(npif, mgr_->ndb_start);
   }
   bbcc++;
@@ -48,50 +48,6 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Eval
   void
   evaluateFields(typename Traits::EvalData d);
 
-  ///
-  /// Takes given coordinates and computes the corresponding midplane
-  /// \param refCoords
-  /// \param midplane_coords
-  ///
-  template <typename ST>
-  void
-  computeMidplaneCoords(PHX::MDField<const ST, Cell, Vertex, Dim> const coords, Kokkos::DynRankView<ST, PHX::Device>& midplane_coords);
-
-  ///
-  /// Computes basis from the reference midplane
-  /// \param midplane_coords
-  /// \param basis
-  ///
-  template <typename ST>
-  void
-  computeBasisVectors(Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords, PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis);
-
-  ///
-  /// Computes the Dual from the midplane and reference bases
-  /// \param midplane_coords
-  /// \param basis
-  /// \param normal
-  /// \param dual_basis
-  ///
-  void
-  computeDualBasisVectors(
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> const&       midplane_coords,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis);
-
-  ///
-  /// Computes the jacobian mapping - da/dA
-  /// \param basis
-  /// \param dual_basis
-  /// \param area
-  ///
-  void
-  computeJacobian(
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area);
-
  private:
   unsigned int container_size, num_dims_, num_nodes_, num_qps_, num_surf_nodes_, num_surf_dims_;
 
@@ -112,16 +68,6 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Eval
   ///
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> intrepid_basis_;
 
-  ///
-  /// Local View to store the reference midplane_coords
-  ///
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> ref_midplane_coords_;
-
-  ///
-  /// Local View to store the current midplane_coords
-  ///
-  Kokkos::DynRankView<ScalarT, PHX::Device> current_midplane_coords_;
-
   ///
   /// Output: Reference basis
   ///
@@ -172,6 +118,33 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Eval
   /// Reference Cell View for integration weights
   ///
   Kokkos::DynRankView<RealType, PHX::Device> ref_weights_;
+
+ public:  // Kokkos
+  struct reference_Tag
+  {
+  };
+  struct current_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, reference_Tag> reference_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, current_Tag>   current_Policy;
+
+  ///
+  /// Reference basis, dual basis, normal and area of a cell
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(reference_Tag const& tag, int const& cell) const;
+
+  ///
+  /// Current basis of a cell
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(current_Tag const& tag, int const& cell) const;
 };
 }  // namespace LCM
 
@@ -88,172 +88,101 @@ SurfaceBasis<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d,
   ref_points_  = Kokkos::DynRankView<RealType, PHX::Device>("XXX", num_qps_, num_surf_dims_);
   ref_weights_ = Kokkos::DynRankView<RealType, PHX::Device>("XXX", num_qps_);
 
-  // temp space for midplane coords
-  ref_midplane_coords_ = Kokkos::createDynRankView(reference_coords_.get_view(), "XXX", container_size, num_surf_nodes_, num_dims_);
-  if (need_current_basis_ == true) {
-    current_midplane_coords_ = Kokkos::createDynRankView(current_coords_.get_view(), "XXX", container_size, num_surf_nodes_, num_dims_);
-  }
-
   // Pre-Calculate reference element quantitites
   cubature_->getCubature(ref_points_, ref_weights_);
   intrepid_basis_->getValues(ref_values_, ref_points_, Intrepid2::OPERATOR_VALUE);
   intrepid_basis_->getValues(ref_grads_, ref_points_, Intrepid2::OPERATOR_GRAD);
 }
 
+// ***************************************************************************
+// Kokkos kernels
 template <typename EvalT, typename Traits>
-void
-SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceBasis<EvalT, Traits>::operator()(reference_Tag const& tag, int const& cell) const
 {
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    // for the reference geometry
-    // compute the mid-plane coordinates
-    computeMidplaneCoords(reference_coords_, ref_midplane_coords_);
-
-    // compute basis vectors
-    computeBasisVectors(ref_midplane_coords_, ref_basis_);
+  for (int pt(0); pt < num_qps_; ++pt) {
+    // compute the base vectors from the mid-plane coordinates
+    minitensor::Vector<MeshScalarT, 3> g_0(minitensor::Filler::ZEROS), g_1(minitensor::Filler::ZEROS);
+    for (int node(0); node < num_surf_nodes_; ++node) {
+      int const top_node = node + num_surf_nodes_;
+      for (int dim(0); dim < 3; ++dim) {
+        MeshScalarT const midplane = 0.5 * (reference_coords_(cell, node, dim) + reference_coords_(cell, top_node, dim));
+        g_0(dim) += ref_grads_(node, pt, 0) * midplane;
+        g_1(dim) += ref_grads_(node, pt, 1) * midplane;
+      }
+    }
+    minitensor::Vector<MeshScalarT, 3> const g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
 
     // compute the dual
-    computeDualBasisVectors(ref_midplane_coords_, ref_basis_, ref_normal_, ref_dual_basis_);
-
-    // compute the Jacobian
-    computeJacobian(ref_basis_, ref_dual_basis_, ref_area_);
-
-    if (need_current_basis_) {
-      // for the current configuration
-      // compute the mid-plane coordinates
-      computeMidplaneCoords(current_coords_, current_midplane_coords_);
-
-      // compute base vectors
-      computeBasisVectors(current_midplane_coords_, current_basis_);
+    minitensor::Vector<MeshScalarT, 3> g0 = minitensor::cross(g_1, g_2);
+    minitensor::Vector<MeshScalarT, 3> g1 = minitensor::cross(g_0, g_2);
+    minitensor::Vector<MeshScalarT, 3> g2 = minitensor::cross(g_0, g_1);
+
+    g0 = g0 / minitensor::dot(g_0, g0);
+    g1 = g1 / minitensor::dot(g_1, g1);
+    g2 = g2 / minitensor::dot(g_2, g2);
+
+    minitensor::Tensor<MeshScalarT, 3> dPhi, dPhiInv;
+    for (int dim(0); dim < 3; ++dim) {
+      dPhi(0, dim)    = g_0(dim);
+      dPhi(1, dim)    = g_1(dim);
+      dPhi(2, dim)    = g_2(dim);
+      dPhiInv(0, dim) = g0(dim);
+      dPhiInv(1, dim) = g1(dim);
+      dPhiInv(2, dim) = g2(dim);
     }
-  }
-}
 
-template <typename EvalT, typename Traits>
-template <typename ST>
-void
-SurfaceBasis<EvalT, Traits>::computeMidplaneCoords(
-    PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
-    Kokkos::DynRankView<ST, PHX::Device>&           midplane_coords)
-{
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // compute the mid-plane coordinates
-    for (int node(0); node < num_surf_nodes_; ++node) {
-      int top_node = node + num_surf_nodes_;
-
-      for (int dim(0); dim < num_dims_; ++dim) {
-        midplane_coords(cell, node, dim) = 0.5 * (coords(cell, node, dim) + coords(cell, top_node, dim));
+    // compute the Jacobian
+    MeshScalarT const j0       = minitensor::det(dPhi);
+    MeshScalarT const jacobian = j0 * std::sqrt(minitensor::dot(minitensor::dot(g_2, minitensor::transpose(dPhiInv) * dPhiInv), g_2));
+
+    ref_area_(cell, pt) = jacobian * ref_weights_(pt);
+    for (int i(0); i < 3; ++i) {
+      ref_normal_(cell, pt, i) = g_2(i);
+      for (int j(0); j < 3; ++j) {
+        ref_basis_(cell, pt, i, j)      = dPhi(i, j);
+        ref_dual_basis_(cell, pt, i, j) = dPhiInv(i, j);
       }
     }
   }
 }
 
 template <typename EvalT, typename Traits>
-template <typename ST>
-void
-SurfaceBasis<EvalT, Traits>::computeBasisVectors(Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords, PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis)
+KOKKOS_INLINE_FUNCTION void
+SurfaceBasis<EvalT, Traits>::operator()(current_Tag const& tag, int const& cell) const
 {
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // get the midplane coordinates
-    std::vector<minitensor::Vector<ST>> midplane_nodes(num_surf_nodes_);
-
+  for (int pt(0); pt < num_qps_; ++pt) {
+    // compute the base vectors from the mid-plane coordinates
+    minitensor::Vector<ScalarT, 3> g_0(minitensor::Filler::ZEROS), g_1(minitensor::Filler::ZEROS);
     for (int node(0); node < num_surf_nodes_; ++node) {
-      midplane_nodes[node] = minitensor::Vector<ST>(minitensor::Source::ARRAY, 3, midplane_coords, cell, node, 0);
-    }
-
-    minitensor::Vector<ST> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
-
-    // compute the base vectors
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0.fill(minitensor::Filler::ZEROS);
-      g_1.fill(minitensor::Filler::ZEROS);
-      for (int node(0); node < num_surf_nodes_; ++node) {
-        g_0 += ref_grads_(node, pt, 0) * midplane_nodes[node];
-        g_1 += ref_grads_(node, pt, 1) * midplane_nodes[node];
+      int const top_node = node + num_surf_nodes_;
+      for (int dim(0); dim < 3; ++dim) {
+        ScalarT const midplane = 0.5 * (current_coords_(cell, node, dim) + current_coords_(cell, top_node, dim));
+        g_0(dim) += ref_grads_(node, pt, 0) * midplane;
+        g_1(dim) += ref_grads_(node, pt, 1) * midplane;
       }
-      g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
-
-      basis(cell, pt, 0, 0) = g_0(0);
-      basis(cell, pt, 0, 1) = g_0(1);
-      basis(cell, pt, 0, 2) = g_0(2);
-      basis(cell, pt, 1, 0) = g_1(0);
-      basis(cell, pt, 1, 1) = g_1(1);
-      basis(cell, pt, 1, 2) = g_1(2);
-      basis(cell, pt, 2, 0) = g_2(0);
-      basis(cell, pt, 2, 1) = g_2(1);
-      basis(cell, pt, 2, 2) = g_2(2);
     }
-  }
-}
-
-template <typename EvalT, typename Traits>
-void
-SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> const&       midplane_coords,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis)
-{
-  int worksetSize = midplane_coords.extent(0);
-
-  minitensor::Vector<MeshScalarT> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
-
-  minitensor::Vector<MeshScalarT> g0(0, 0, 0), g1(0, 0, 0), g2(0, 0, 0);
+    minitensor::Vector<ScalarT, 3> const g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
 
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
-
-      g_1 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 1, 0);
-
-      g_2 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
-
-      normal(cell, pt, 0) = g_2(0);
-      normal(cell, pt, 1) = g_2(1);
-      normal(cell, pt, 2) = g_2(2);
-
-      g0 = minitensor::cross(g_1, g_2);
-      g1 = minitensor::cross(g_0, g_2);
-      g2 = minitensor::cross(g_0, g_1);
-
-      g0 = g0 / dot(g_0, g0);
-      g1 = g1 / dot(g_1, g1);
-      g2 = g2 / dot(g_2, g2);
-
-      dual_basis(cell, pt, 0, 0) = g0(0);
-      dual_basis(cell, pt, 0, 1) = g0(1);
-      dual_basis(cell, pt, 0, 2) = g0(2);
-      dual_basis(cell, pt, 1, 0) = g1(0);
-      dual_basis(cell, pt, 1, 1) = g1(1);
-      dual_basis(cell, pt, 1, 2) = g1(2);
-      dual_basis(cell, pt, 2, 0) = g2(0);
-      dual_basis(cell, pt, 2, 1) = g2(1);
-      dual_basis(cell, pt, 2, 2) = g2(2);
+    for (int dim(0); dim < 3; ++dim) {
+      current_basis_(cell, pt, 0, dim) = g_0(dim);
+      current_basis_(cell, pt, 1, dim) = g_1(dim);
+      current_basis_(cell, pt, 2, dim) = g_2(dim);
     }
   }
 }
 
+// ***************************************************************************
 template <typename EvalT, typename Traits>
 void
-SurfaceBasis<EvalT, Traits>::computeJacobian(
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area)
+SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  int const worksetSize = basis.extent(0);
-
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      minitensor::Tensor<MeshScalarT> dPhiInv(minitensor::Source::ARRAY, 3, dual_basis, cell, pt, 0, 0);
-
-      minitensor::Tensor<MeshScalarT> dPhi(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
+  int const num_cells = workset.numCells;
 
-      minitensor::Vector<MeshScalarT> G_2(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
+  Kokkos::parallel_for(reference_Policy(0, num_cells), *this);
 
-      MeshScalarT j0       = minitensor::det(dPhi);
-      MeshScalarT jacobian = j0 * std::sqrt(minitensor::dot(minitensor::dot(G_2, minitensor::transpose(dPhiInv) * dPhiInv), G_2));
-      area(cell, pt)       = jacobian * ref_weights_(pt);
-    }
+  if (need_current_basis_ == true) {
+    Kokkos::parallel_for(current_Policy(0, num_cells), *this);
   }
 }
 
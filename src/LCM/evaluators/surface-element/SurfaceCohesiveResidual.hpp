@@ -71,6 +71,19 @@ class SurfaceCohesiveResidual : public PHX::EvaluatorWithBaseImpl<Traits>, publi
   unsigned int num_surf_nodes_;
 
   unsigned int num_surf_dims_;
+
+ public:  // Kokkos
+  struct residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, residual_Tag> residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(residual_Tag const& tag, int const& cell) const;
 };
 }  // namespace LCM
 
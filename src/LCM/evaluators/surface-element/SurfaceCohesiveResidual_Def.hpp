@@ -62,39 +62,39 @@ SurfaceCohesiveResidual<EvalT, Traits>::postRegistrationSetup(typename Traits::S
   intrepid_basis_->getValues(ref_grads_, ref_points_, Intrepid2::OPERATOR_GRAD);
 }
 
+// ***************************************************************************
+// Kokkos kernels
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceCohesiveResidual<EvalT, Traits>::operator()(residual_Tag const& tag, int const& cell) const
+{
+  for (int bottom_node(0); bottom_node < num_surf_nodes_; ++bottom_node) {
+    int const top_node = bottom_node + num_surf_nodes_;
+
+    // initialize force vector
+    minitensor::Vector<ScalarT, 3> f_plus(minitensor::Filler::ZEROS);
+
+    for (int pt(0); pt < num_qps_; ++pt) {
+      // refValues(numPlaneNodes, numQPs) = shape function
+      // refArea(numCells, numQPs) = |Jacobian|*weight
+      for (int dim(0); dim < 3; ++dim) {
+        f_plus(dim) += cohesive_traction_(cell, pt, dim) * ref_values_(bottom_node, pt) * ref_area_(cell, pt);
+      }
+    }
+
+    for (int dim(0); dim < 3; ++dim) {
+      force_(cell, bottom_node, dim) = -f_plus(dim);
+      force_(cell, top_node, dim)    = f_plus(dim);
+    }
+  }
+}
+
 //*****
 template <typename EvalT, typename Traits>
 void
 SurfaceCohesiveResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  minitensor::Vector<ScalarT> f_plus(0, 0, 0);
-
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int bottom_node(0); bottom_node < num_surf_nodes_; ++bottom_node) {
-      int top_node = bottom_node + num_surf_nodes_;
-
-      // initialize force vector
-      f_plus.fill(minitensor::Filler::ZEROS);
-
-      for (int pt(0); pt < num_qps_; ++pt) {
-        // refValues(numPlaneNodes, numQPs) = shape function
-        // refArea(numCells, numQPs) = |Jacobian|*weight
-        f_plus(0) += cohesive_traction_(cell, pt, 0) * ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-        f_plus(1) += cohesive_traction_(cell, pt, 1) * ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-        f_plus(2) += cohesive_traction_(cell, pt, 2) * ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-
-      }  // end of pt loop
-
-      force_(cell, bottom_node, 0) = -f_plus(0);
-      force_(cell, bottom_node, 1) = -f_plus(1);
-      force_(cell, bottom_node, 2) = -f_plus(2);
-
-      force_(cell, top_node, 0) = f_plus(0);
-      force_(cell, top_node, 1) = f_plus(1);
-      force_(cell, top_node, 2) = f_plus(2);
-
-    }  // end of planeNode loop
-  }    // end of cell loop
+  Kokkos::parallel_for(residual_Policy(0, workset.numCells), *this);
 }
 //*****
 }  // namespace LCM
@@ -62,6 +62,19 @@ class SurfaceVectorJump : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX:
   unsigned int                                num_dims_;
   unsigned int                                num_plane_nodes_;
   unsigned int                                num_plane_dims_;
+
+ public:  // Kokkos
+  struct jump_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, jump_Tag> jump_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(jump_Tag const& tag, int const& cell) const;
 };
 }  // namespace LCM
 
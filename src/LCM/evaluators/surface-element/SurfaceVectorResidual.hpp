@@ -102,6 +102,19 @@ class SurfaceVectorResidual : public PHX::EvaluatorWithBaseImpl<Traits>, public
 
   /// Topology modification for adaptive insertion flag.
   bool have_topmod_adaptation_;
+
+ public:  // Kokkos
+  struct residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, residual_Tag> residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(residual_Tag const& tag, int const& cell) const;
 };
 }  // namespace LCM
 
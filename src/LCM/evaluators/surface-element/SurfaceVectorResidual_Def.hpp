@@ -107,119 +107,113 @@ SurfaceVectorResidual<EvalT, Traits>::postRegistrationSetup(typename Traits::Set
   intrepid_basis_->getValues(ref_grads_, ref_points_, Intrepid2::OPERATOR_GRAD);
 }
 
+// ***************************************************************************
+// Kokkos kernels
 template <typename EvalT, typename Traits>
-void
-SurfaceVectorResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceVectorResidual<EvalT, Traits>::operator()(residual_Tag const& tag, int const& cell) const
 {
-  // define and initialize tensors/vectors
-  minitensor::Vector<ScalarT> f_plus(0, 0, 0), f_minus(0, 0, 0);
+  for (int node(0); node < num_nodes_; ++node) {
+    for (int dim(0); dim < 3; ++dim) {
+      force_(cell, node, dim) = 0.0;
+    }
+  }
+
+  for (int pt(0); pt < num_qps_; ++pt) {
+    // deformed bases
+    minitensor::Vector<ScalarT, 3> g_0, g_1, n;
+    // ref bases
+    minitensor::Vector<MeshScalarT, 3> G0, G1, G2;
+    // ref normal
+    minitensor::Vector<MeshScalarT, 3> N;
+    for (int dim(0); dim < 3; ++dim) {
+      g_0(dim) = current_basis_(cell, pt, 0, dim);
+      g_1(dim) = current_basis_(cell, pt, 1, dim);
+      n(dim)   = current_basis_(cell, pt, 2, dim);
+      G0(dim)  = ref_dual_basis_(cell, pt, 0, dim);
+      G1(dim)  = ref_dual_basis_(cell, pt, 1, dim);
+      G2(dim)  = ref_dual_basis_(cell, pt, 2, dim);
+      N(dim)   = ref_normal_(cell, pt, dim);
+    }
 
-  ScalarT dgapdxN, tmp1, tmp2, dndxbar, dFdx_plus, dFdx_minus;
+    // h * P * dFperpdx --> +/- \lambda * P * N
+    minitensor::Vector<ScalarT, 3> PN(minitensor::Filler::ZEROS);
+    if (use_cohesive_traction_) {
+      for (int i(0); i < 3; ++i) PN(i) = traction_(cell, pt, i);
+    } else {
+      for (int i(0); i < 3; ++i) {
+        for (int j(0); j < 3; ++j) PN(i) += stress_(cell, pt, i, j) * N(j);
+      }
+    }
 
-  // 2nd-order identity tensor
-  minitensor::Tensor<MeshScalarT> const I = minitensor::identity<MeshScalarT>(3);
+    bool const    membrane = use_cohesive_traction_ == false && compute_membrane_forces_ == true;
+    ScalarT const norm_g   = membrane == true ? minitensor::norm(minitensor::cross(g_0, g_1)) : ScalarT(1.0);
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
     for (int bottom_node(0); bottom_node < num_surf_nodes_; ++bottom_node) {
-      force_(cell, bottom_node, 0) = 0.0;
-      force_(cell, bottom_node, 1) = 0.0;
-      force_(cell, bottom_node, 2) = 0.0;
-
-      int top_node = bottom_node + num_surf_nodes_;
-
-      force_(cell, top_node, 0) = 0.0;
-      force_(cell, top_node, 1) = 0.0;
-      force_(cell, top_node, 2) = 0.0;
-
-      for (int pt(0); pt < num_qps_; ++pt) {
-        // deformed bases
-        minitensor::Vector<ScalarT> g_0(minitensor::Source::ARRAY, 3, current_basis_, cell, pt, 0, 0);
-        minitensor::Vector<ScalarT> g_1(minitensor::Source::ARRAY, 3, current_basis_, cell, pt, 1, 0);
-        minitensor::Vector<ScalarT> n(minitensor::Source::ARRAY, 3, current_basis_, cell, pt, 2, 0);
-        // ref bases
-        minitensor::Vector<MeshScalarT> G0(minitensor::Source::ARRAY, 3, ref_dual_basis_, cell, pt, 0, 0);
-        minitensor::Vector<MeshScalarT> G1(minitensor::Source::ARRAY, 3, ref_dual_basis_, cell, pt, 1, 0);
-        minitensor::Vector<MeshScalarT> G2(minitensor::Source::ARRAY, 3, ref_dual_basis_, cell, pt, 2, 0);
-        // ref normal
-        minitensor::Vector<MeshScalarT> N(minitensor::Source::ARRAY, 3, ref_normal_, cell, pt, 0);
-
-        // compute dFdx_plus_or_minus
-        f_plus.fill(minitensor::Filler::ZEROS);
-        f_minus.fill(minitensor::Filler::ZEROS);
-
-        // h * P * dFperpdx --> +/- \lambda * P * N
-        if (use_cohesive_traction_) {
-          minitensor::Vector<ScalarT> T(minitensor::Source::ARRAY, 3, traction_, cell, pt, 0);
-
-          f_plus  = ref_values_(bottom_node, pt) * T;
-          f_minus = -ref_values_(bottom_node, pt) * T;
-        } else {
-          minitensor::Tensor<ScalarT> P(minitensor::Source::ARRAY, 3, stress_, cell, pt, 0, 0);
-
-          f_plus  = ref_values_(bottom_node, pt) * P * N;
-          f_minus = -ref_values_(bottom_node, pt) * P * N;
-
-          if (compute_membrane_forces_) {
-            for (int m(0); m < num_dims_; ++m) {
-              for (int i(0); i < num_dims_; ++i) {
-                for (int L(0); L < num_dims_; ++L) {
-                  // tmp1 = (1/2) * delta * lambda_{,alpha} * G^{alpha L}
-                  tmp1 = 0.5 * I(m, i) * (ref_grads_(bottom_node, pt, 0) * G0(L) + ref_grads_(bottom_node, pt, 1) * G1(L));
-
-                  // tmp2 = (1/2) * dndxbar * G^{3}
-                  dndxbar = 0.0;
-                  for (int r(0); r < num_dims_; ++r) {
-                    for (int s(0); s < num_dims_; ++s) {
-                      dndxbar += minitensor::levi_civita<MeshScalarT>(i, r, s) *
-                                 (g_1(r) * ref_grads_(bottom_node, pt, 0) - g_0(r) * ref_grads_(bottom_node, pt, 1)) * (I(m, s) - n(m) * n(s)) /
-                                 minitensor::norm(minitensor::cross(g_0, g_1));
-                    }
-                  }
-                  tmp2 = 0.5 * dndxbar * G2(L);
-
-                  // dFdx_plus
-                  dFdx_plus = tmp1 + tmp2;
-
-                  // dFdx_minus
-                  dFdx_minus = tmp1 + tmp2;
-
-                  // F = h * P:dFdx
-                  f_plus(i) += thickness_ * P(m, L) * dFdx_plus;
-                  f_minus(i) += thickness_ * P(m, L) * dFdx_minus;
+      int const top_node = bottom_node + num_surf_nodes_;
+
+      // compute dFdx_plus_or_minus
+      minitensor::Vector<ScalarT, 3> f_plus  = ref_values_(bottom_node, pt) * PN;
+      minitensor::Vector<ScalarT, 3> f_minus = -ref_values_(bottom_node, pt) * PN;
+
+      if (membrane == true) {
+        for (int m(0); m < num_dims_; ++m) {
+          for (int i(0); i < num_dims_; ++i) {
+            for (int L(0); L < num_dims_; ++L) {
+              // tmp1 = (1/2) * delta * lambda_{,alpha} * G^{alpha L}
+              ScalarT const tmp1 = 0.5 * (m == i ? 1.0 : 0.0) * (ref_grads_(bottom_node, pt, 0) * G0(L) + ref_grads_(bottom_node, pt, 1) * G1(L));
+
+              // tmp2 = (1/2) * dndxbar * G^{3}
+              ScalarT dndxbar = 0.0;
+              for (int r(0); r < num_dims_; ++r) {
+                for (int s(0); s < num_dims_; ++s) {
+                  dndxbar += minitensor::levi_civita<MeshScalarT>(i, r, s) *
+                             (g_1(r) * ref_grads_(bottom_node, pt, 0) - g_0(r) * ref_grads_(bottom_node, pt, 1)) * ((m == s ? 1.0 : 0.0) - n(m) * n(s)) /
+                             norm_g;
                 }
               }
+              ScalarT const tmp2 = 0.5 * dndxbar * G2(L);
+
+              // dFdx_plus and dFdx_minus
+              ScalarT const dFdx_plus  = tmp1 + tmp2;
+              ScalarT const dFdx_minus = tmp1 + tmp2;
+
+              // F = h * P:dFdx
+              f_plus(i) += thickness_ * stress_(cell, pt, m, L) * dFdx_plus;
+              f_minus(i) += thickness_ * stress_(cell, pt, m, L) * dFdx_minus;
             }
           }
         }
+      }
 
-        // area (Reference) = |Jacobian| * weights
-        force_(cell, top_node, 0) += f_plus(0) * ref_area_(cell, pt);
-        force_(cell, top_node, 1) += f_plus(1) * ref_area_(cell, pt);
-        force_(cell, top_node, 2) += f_plus(2) * ref_area_(cell, pt);
-
-        force_(cell, bottom_node, 0) += f_minus(0) * ref_area_(cell, pt);
-        force_(cell, bottom_node, 1) += f_minus(1) * ref_area_(cell, pt);
-        force_(cell, bottom_node, 2) += f_minus(2) * ref_area_(cell, pt);
-
-      }  // end of pt
-    }    // end of numPlaneNodes
-  }      // end of cell
+      // area (Reference) = |Jacobian| * weights
+      for (int dim(0); dim < 3; ++dim) {
+        force_(cell, top_node, dim) += f_plus(dim) * ref_area_(cell, pt);
+        force_(cell, bottom_node, dim) += f_minus(dim) * ref_area_(cell, pt);
+      }
+    }
+  }
 
   // This is here just to satisfy projection operators from QPs to nodes
   if (have_topmod_adaptation_ == true) {
-    for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
-      for (std::size_t pt = 0; pt < num_qps_; ++pt) {
-        for (int i = 0; i < num_dims_; ++i) {
-          for (int j = 0; j < num_dims_; ++j) {
-            if (use_cohesive_traction_) {
-              cauchy_stress_(cell, pt, i, j) = traction_(cell, pt, i) * ref_normal_(cell, pt, j);
-            } else {
-              cauchy_stress_(cell, pt, i, j) = stress_(cell, pt, i, j);
-            }
+    for (int pt(0); pt < num_qps_; ++pt) {
+      for (int i(0); i < num_dims_; ++i) {
+        for (int j(0); j < num_dims_; ++j) {
+          if (use_cohesive_traction_) {
+            cauchy_stress_(cell, pt, i, j) = traction_(cell, pt, i) * ref_normal_(cell, pt, j);
+          } else {
+            cauchy_stress_(cell, pt, i, j) = stress_(cell, pt, i, j);
           }
         }
       }
     }
   }
 }
+
+template <typename EvalT, typename Traits>
+void
+SurfaceVectorResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(residual_Policy(0, workset.numCells), *this);
+}
 }  // namespace LCM
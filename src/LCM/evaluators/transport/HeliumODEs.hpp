@@ -5,7 +5,10 @@
 #if !defined(HeliumODEs_hpp)
 #define HeliumODEs_hpp
 
+#include <MiniTensor.h>
+
 #include "Albany_Layouts.hpp"
+#include "NOX_StatusTest_ModelEvaluatorFlag.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
@@ -19,7 +22,12 @@ namespace LCM {
 ///   1. He concentration
 ///   2. Total bubble density
 ///   3. Bubble volume fraction
-/// We employ implicit integration (backward Euler)
+/// We employ implicit integration (backward Euler) with adaptive
+/// substepping at each integration point. The local error of each substep
+/// is estimated against the trapezoidal rule and the substep size is
+/// adjusted to keep it below the local integration tolerance. If the
+/// maximum number of substeps is exceeded the NOX status test is set to
+/// failed so that the global load step is cut.
 ///
 template <typename EvalT, typename Traits>
 class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
@@ -46,6 +54,28 @@ class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalua
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
 
+  ///
+  /// Right-hand side of the ODEs for source term g
+  ///
+  minitensor::Vector<ScalarT>
+  rates(minitensor::Vector<ScalarT> const& y, ScalarT const& d, ScalarT const& g) const;
+
+  ///
+  /// One backward Euler substep of size h from y_old with the source term
+  /// at the end of the substep. Returns false if Newton does not converge
+  /// or the result is not admissible.
+  ///
+  bool
+  backwardEulerStep(minitensor::Vector<ScalarT> const& y_old, ScalarT const& h, ScalarT const& d, ScalarT const& g, minitensor::Vector<ScalarT>& y) const;
+
+  ///
+  /// Integrate the ODEs at one integration point over the time step dt.
+  /// The source term varies linearly from g_old to g. Returns false if
+  /// the maximum number of substeps is exceeded.
+  ///
+  bool
+  integratePoint(ScalarT const& dt, ScalarT const& d, ScalarT const& g_old, ScalarT const& g, minitensor::Vector<ScalarT>& y) const;
+
   ///
   /// Input: total_concentration - addition of lattice and trapped
   ///        concentration
@@ -83,6 +113,18 @@ class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalua
   ///
   RealType avogadros_num_, omega_, t_decay_constant_, he_radius_, eta_;
 
+  ///
+  /// Local integration controls
+  ///
+  RealType local_tolerance_;
+  int      max_substeps_;
+
+  ///
+  /// Status test set to failed when the substeps run out, so that the
+  /// global load step is reduced
+  ///
+  Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> nox_status_test_;
+
   ///
   /// Scalar names for obtaining state old
   ///
@@ -1,10 +1,13 @@
 // Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
+#include <Kokkos_Core.hpp>
 #include <MiniTensor.h>
 
 #include <Phalanx_DataLayout.hpp>
+#include <algorithm>
 #include <cmath>
+#include <sstream>
 
 #include "Albany_MaterialDatabase.hpp"
 
@@ -21,6 +24,19 @@ lcm_cbrt(T const& x)
   return std::cbrt(x);
 }
 
+// Relative tolerance for the local Newton iterations and threshold below
+// which a concentration or bubble density is considered zero.
+constexpr double helium_tolerance = 1.0e-12;
+
+constexpr int helium_max_newton_iterations = 20;
+
+template <typename T>
+double
+helium_value(T const& x)
+{
+  return Sacado::ScalarValue<T>::eval(x);
+}
+
 template <typename EvalT, typename Traits>
 HeliumODEs<EvalT, Traits>::HeliumODEs(Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
     : total_concentration_(p.get<std::string>("Total Concentration Name"), dl->qp_scalar),
@@ -43,6 +59,16 @@ HeliumODEs<EvalT, Traits>::HeliumODEs(Teuchos::ParameterList& p, const Teuchos::
   eta_              = mat_params_2->get<RealType>("Atoms Per Cluster");
   omega_            = mat_params_3->get<RealType>("Value");
 
+  local_tolerance_ = mat_params_2->get<RealType>("Local Integration Tolerance", 1.0e-6);
+  max_substeps_    = mat_params_2->get<int>("Maximum Local Substeps", 1000);
+
+  if (p.isParameter("NOX Status Test") == true) {
+    nox_status_test_ = p.get<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>("NOX Status Test");
+  } else {
+    nox_status_test_ = Teuchos::rcp(new NOX::StatusTest::ModelEvaluatorFlag);
+    p.set<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>("NOX Status Test", nox_status_test_);
+  }
+
   // add dependent fields
   this->addDependentField(total_concentration_);
   this->addDependentField(diffusion_coefficient_);
@@ -78,25 +104,169 @@ HeliumODEs<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, P
 }
 
 template <typename EvalT, typename Traits>
-void
-HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+minitensor::Vector<typename EvalT::ScalarT>
+HeliumODEs<EvalT, Traits>::rates(minitensor::Vector<ScalarT> const& y, ScalarT const& d, ScalarT const& g) const
+{
+  double const pi           = std::acos(-1.0);
+  double const cub_tfpi     = std::cbrt(3.0 / 4.0 / pi);
+  double const atomic_omega = omega_ / avogadros_num_;
+
+  ScalarT const n1 = y(0);
+
+  // coalescence of He atoms into new bubbles and absorption by existing ones
+  ScalarT const coalescence = 32.0 * pi * he_radius_ * d * n1 * n1;
+  ScalarT const absorption  = 4.0 * pi * d * n1 * cub_tfpi * lcm_cbrt(y(2)) * lcm_cbrt<ScalarT>(y(1) * y(1));
+
+  minitensor::Vector<ScalarT> f(3);
+
+  f(0) = g - coalescence - absorption;
+  f(1) = 0.5 * coalescence;
+  f(2) = atomic_omega / eta_ * (coalescence + absorption);
+
+  return f;
+}
+
+template <typename EvalT, typename Traits>
+bool
+HeliumODEs<EvalT, Traits>::backwardEulerStep(
+    minitensor::Vector<ScalarT> const& y_old,
+    ScalarT const&                     h,
+    ScalarT const&                     d,
+    ScalarT const&                     g,
+    minitensor::Vector<ScalarT>&       y) const
 {
-  // Declaring time step & calculated input parameters
-  ScalarT dt;
-  ScalarT atomic_omega;
-  // Declaring tangent, residual, norms, and increment for N-R
+  double const pi              = std::acos(-1.0);
+  double const atomic_omega    = omega_ / avogadros_num_;
+  double const cube_root_pi2   = std::cbrt(pi * pi);
+  double const cube_root_2     = std::cbrt(2.0);
+  double const cube_root_6     = std::cbrt(6.0);
+  double const cube_root_9     = std::cbrt(9.0);
+  double const cube_root_pi2_9 = std::cbrt(pi * pi / 9.0);
+
   minitensor::Tensor<ScalarT> tangent(3);
-  minitensor::Vector<ScalarT> residual(3);
-  ScalarT                     norm_residual_2, norm_residual_goal_2;
-  minitensor::Vector<ScalarT> increment(3);
+  minitensor::Vector<ScalarT> residual = y - y_old - h * rates(y, d, g);
+
+  ScalarT       norm_residual_2      = minitensor::norm_square(residual);
+  ScalarT const norm_residual_goal_2 = helium_tolerance * helium_tolerance * norm_residual_2;
+
+  int iter(0);
+
+  while (norm_residual_2 > norm_residual_goal_2 && iter < helium_max_newton_iterations) {
+    ScalarT const& n1 = y(0);
+    ScalarT const& nb = y(1);
+    ScalarT const& sb = y(2);
+
+    // Common factors w/cube_root
+    ScalarT const cube_root_nb  = lcm_cbrt(nb);
+    ScalarT const cube_root_nb2 = lcm_cbrt<ScalarT>(nb * nb);
+    ScalarT const cube_root_sb  = lcm_cbrt(sb);
+    ScalarT const cube_root_sb2 = lcm_cbrt<ScalarT>(sb * sb);
+
+    // The absorption term is not differentiable at nb = 0 or sb = 0, where
+    // it vanishes. Drop its derivatives there.
+    ScalarT d_nb = 0.0;
+    ScalarT d_sb = 0.0;
+    if (helium_value(cube_root_nb) > 0.0) d_nb = 4.0 * cube_root_2 * h * d * n1 * cube_root_pi2 * cube_root_sb / cube_root_9 / cube_root_nb;
+    if (helium_value(cube_root_sb2) > 0.0) d_sb = 2.0 * cube_root_2 * h * d * n1 * cube_root_nb2 * cube_root_pi2_9 / cube_root_sb2;
+
+    // calculate tangent
+    tangent(0, 0) = 1.0 + 2.0 * h * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb);
+    tangent(0, 1) = d_nb;
+    tangent(0, 2) = d_sb;
+    tangent(1, 0) = -32.0 * h * d * n1 * pi * he_radius_;
+    tangent(1, 1) = 1.0;
+    tangent(1, 2) = 0.0;
+    tangent(2, 0) = -2.0 * h * d * atomic_omega * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
+    tangent(2, 1) = -atomic_omega / eta_ * d_nb;
+    tangent(2, 2) = 1.0 - atomic_omega / eta_ * d_sb;
+
+    // find increment and update quantities
+    y -= minitensor::inverse(tangent) * residual;
+
+    // find new residual and norm
+    residual        = y - y_old - h * rates(y, d, g);
+    norm_residual_2 = minitensor::norm_square(residual);
+    iter++;
+  }
+
+  if (norm_residual_2 > norm_residual_goal_2) return false;
+
+  for (minitensor::Index i = 0; i < 3; ++i) {
+    double const y_i = helium_value(y(i));
+    if (std::isfinite(y_i) == false || y_i < 0.0) return false;
+  }
 
-  // tolarences and iterations for newton
-  double const tolerance = 1.0e-12, tolerance_2 = tolerance * tolerance;
-  int const    maxIterations = 20;  // FIXME: Currently a maximum, need relative measures
-  // subincrementation for explicit predictor //FIXME: No guarantee of stability
-  ScalarT   dt_explicit;
-  int const explicit_sub_increments = 5;
+  return true;
+}
 
+template <typename EvalT, typename Traits>
+bool
+HeliumODEs<EvalT, Traits>::integratePoint(ScalarT const& dt, ScalarT const& d, ScalarT const& g_old, ScalarT const& g, minitensor::Vector<ScalarT>& y) const
+{
+  minitensor::Vector<ScalarT> y_new(3);
+
+  // Elapsed and substep fractions of the time step. Only values are used to
+  // select the substeps, derivatives are carried through the updates.
+  double elapsed  = 0.0;
+  double fraction = 1.0;
+
+  for (int substep = 0; substep < max_substeps_; ++substep) {
+    bool const last = fraction >= 1.0 - elapsed;
+    if (last == true) fraction = 1.0 - elapsed;
+
+    ScalarT const h       = fraction * dt;
+    ScalarT const half_h  = 0.5 * h;
+    ScalarT const g_start = g_old + elapsed * (g - g_old);
+    ScalarT const g_mid   = g_old + (elapsed + 0.5 * fraction) * (g - g_old);
+    ScalarT const g_end   = g_old + (elapsed + fraction) * (g - g_old);
+    auto const    f_start = rates(y, d, g_start);
+
+    // If the bubble density is small, use two explicit half steps as
+    // predictor to obtain a finite nb and avoid issues with 1/nb and 1/sb
+    // in the tangent.
+    y_new = y;
+    if (helium_value(y(1)) < helium_tolerance) {
+      y_new += half_h * f_start;
+      y_new += half_h * rates(y_new, d, g_mid);
+    }
+
+    if (backwardEulerStep(y, h, d, g_end, y_new) == false) {
+      fraction *= 0.5;
+      continue;
+    }
+
+    // Local error estimate from the difference with the trapezoidal rule.
+    auto const error = half_h * (rates(y_new, d, g_end) - f_start);
+
+    double error_norm = 0.0;
+    for (minitensor::Index i = 0; i < 3; ++i) {
+      double const scale = local_tolerance_ * std::max(std::max(std::abs(helium_value(y(i))), std::abs(helium_value(y_new(i)))), helium_tolerance);
+      error_norm         = std::max(error_norm, std::abs(helium_value(error(i))) / scale);
+    }
+
+    // Backward Euler is first order, the local error goes as h^2.
+    double const factor = error_norm > 0.0 ? 0.9 / std::sqrt(error_norm) : 5.0;
+
+    if (error_norm > 1.0) {
+      fraction *= std::max(0.2, factor);
+      continue;
+    }
+
+    y = y_new;
+
+    if (last == true) return true;
+
+    elapsed += fraction;
+    fraction *= std::min(5.0, factor);
+  }
+
+  return false;
+}
+
+template <typename EvalT, typename Traits>
+void
+HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
   // state old
   Albany::MDArray total_concentration_old    = (*workset.stateArrayPtr)[total_concentration_name_];
   Albany::MDArray he_concentration_old       = (*workset.stateArrayPtr)[he_concentration_name_];
@@ -120,140 +290,48 @@ HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   //   he_radius_ - radius of He atom
   //   eta_ - atoms per cluster (not variable)
 
-  // convert molar volume to atomic volume through avogadros_num_
-  atomic_omega = omega_ / avogadros_num_;
-
   // time step
-  dt = delta_time_(0);
-
-  // loop over cells and points for implicit time integration
-
-  // constants for computations
-  double const pi       = acos(-1.0);
-  double const onethrd  = 1.0 / 3.0;
-  double const twothrd  = 2.0 / 3.0;
-  double const cub_tfpi = std::cbrt(3.0 / 4.0 / pi);
-
-  // temporary variables
-  ScalarT n1_old, nb_old, sb_old, n1, nb, sb;
-  ScalarT n1_exp, nb_exp, sb_exp;
-  ScalarT d, g_old, g;
-
-  double const pi2             = pi * pi;
-  double const cube_root_pi2   = std::cbrt(pi2);
-  double const cube_root_2     = std::cbrt(2.0);
-  double const cube_root_6     = std::cbrt(6.0);
-  double const cube_root_9     = std::cbrt(9.0);
-  double const cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
-
-  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
-    for (std::size_t pt = 0; pt < num_pts_; ++pt) {
-      // temporary variables
-      n1_old = he_concentration_old(cell, pt);
-      nb_old = total_bubble_density_old(cell, pt);
-      sb_old = bubble_volume_fraction_old(cell, pt);
-      n1     = n1_old;
-      nb     = nb_old;
-      sb     = sb_old;
-      d      = diffusion_coefficient_(cell, pt);
-
-      // determine if any tritium exists - note that concentration is in mol
-      // (not atoms) if no tritium exists, no need to solve the ODEs
-      if (total_concentration_(cell, pt) > tolerance) {
-        // source terms for helium bubble generation
-        g_old = avogadros_num_ * t_decay_constant_ * total_concentration_old(cell, pt);
-        g     = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
-
-        // check if old bubble density is small
-        // if small, use an explict guess to avoid issues with 1/nb and 1/sb in
-        // tangent
-
-        if (nb_old < tolerance) {
-          // explicit time integration for predictor
-          // Note that two or more steps are required to obtain a finite nb if
-          // the total_concentration_old is zero.
-          dt_explicit = dt / explicit_sub_increments;
-          n1_exp      = n1_old;
-          nb_exp      = nb_old;
-          sb_exp      = sb_old;
-
-          ScalarT const nb_exp2           = nb_exp * nb_exp;
-          ScalarT const cube_root_nb_exp2 = lcm_cbrt(nb_exp2);
-
-          for (int sub_increment = 0; sub_increment < explicit_sub_increments; sub_increment++) {
-            n1 = n1_exp +
-                 dt_explicit * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp - 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
-            nb = nb_exp + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
-            sb = sb_exp + atomic_omega / eta_ * dt_explicit *
-                              (32. * pi * he_radius_ * d * n1_exp * n1_exp + 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
-            n1_exp = n1;
-            nb_exp = nb;
-            sb_exp = sb;
+  ScalarT const dt = delta_time_(0);
+
+  // Integration points are independent, integrate them in parallel over
+  // cells and count the points that exceed the maximum number of substeps.
+  int failures = 0;
+
+  Kokkos::parallel_reduce(
+      "HeliumODEs",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, workset.numCells),
+      [&](int const cell, int& local_failures) {
+        minitensor::Vector<ScalarT> y(3);
+
+        for (std::size_t pt = 0; pt < num_pts_; ++pt) {
+          y(0) = he_concentration_old(cell, pt);
+          y(1) = total_bubble_density_old(cell, pt);
+          y(2) = bubble_volume_fraction_old(cell, pt);
+
+          // determine if any tritium exists - note that concentration is in
+          // mol (not atoms) if no tritium exists, no need to solve the ODEs
+          if (total_concentration_(cell, pt) > helium_tolerance) {
+            // source terms for helium bubble generation
+            ScalarT const g_old = avogadros_num_ * t_decay_constant_ * total_concentration_old(cell, pt);
+            ScalarT const g     = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
+
+            if (integratePoint(dt, diffusion_coefficient_(cell, pt), g_old, g, y) == false) ++local_failures;
           }
-        }
 
-        ScalarT nb2           = nb * nb;
-        ScalarT cube_root_nb2 = lcm_cbrt(nb2);
-        ScalarT cube_root_sb  = lcm_cbrt(sb);
-
-        // calculate initial residual for a relative tolerance
-        residual(0) = n1 - n1_old - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 - 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-        residual(2) =
-            sb - sb_old - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 + 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        norm_residual_2      = minitensor::norm_square(residual);
-        norm_residual_goal_2 = tolerance_2 * norm_residual_2;
-        int iter(0);
-
-        // N-R loop for implicit time integration
-        while (norm_residual_2 > norm_residual_goal_2 && iter < maxIterations) {
-          // Common factors w/cube_root
-          ScalarT cube_root_nb  = lcm_cbrt(nb);
-          nb2                   = nb * nb;
-          cube_root_nb2         = lcm_cbrt(nb2);
-          cube_root_sb          = lcm_cbrt(sb);
-          ScalarT sb2           = sb * sb;
-          ScalarT cube_root_sb2 = lcm_cbrt(sb2);
-
-          // calculate tangent
-          tangent(0, 0) = 1.0 + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb);
-          tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 * cube_root_sb / cube_root_9 / cube_root_nb;
-          tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * cube_root_pi2_9 / cube_root_sb2;
-          tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
-          tangent(1, 1) = 1.0;
-          tangent(1, 2) = 0.0;
-          tangent(2, 0) = -2.0 * dt * d * atomic_omega * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
-          tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega * cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
-          tangent(2, 2) = 1.0 - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
-
-          // find increment
-          increment = -minitensor::inverse(tangent) * residual;
-
-          // update quantities
-          n1 = n1 + increment(0);
-          nb = nb + increment(1);
-          sb = sb + increment(2);
-
-          nb2           = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb  = lcm_cbrt(sb);
-
-          // find new residual and norm
-          residual(0) = n1 - n1_old - dt * (g - 32. * pi * he_radius_ * d * n1 * n1 - 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-          residual(2) =
-              sb - sb_old - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 + 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          norm_residual_2 = minitensor::norm_square(residual);
-          iter++;
+          // Update global fields
+          he_concentration_(cell, pt)       = y(0);
+          total_bubble_density_(cell, pt)   = y(1);
+          bubble_volume_fraction_(cell, pt) = y(2);
         }
-      }
-
-      // Update global fields
-
-      he_concentration_(cell, pt)       = n1;
-      total_bubble_density_(cell, pt)   = nb;
-      bubble_volume_fraction_(cell, pt) = sb;
-    }
+      },
+      failures);
+
+  // Do not abort, ask the solver for a smaller global load step instead.
+  if (failures > 0) {
+    std::ostringstream msg;
+    msg << "Helium ODEs not integrated within " << max_substeps_ << " substeps at " << failures << " integration points";
+    nox_status_test_->status_         = NOX::StatusTest::Failed;
+    nox_status_test_->status_message_ = msg.str();
   }
 }
 }  // namespace LCM
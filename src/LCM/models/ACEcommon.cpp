@@ -4,6 +4,7 @@
 
 #include "ACEcommon.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -87,15 +88,13 @@ RealType
 LCM::interpolateVectors(std::vector<RealType> const& xv, std::vector<RealType> const& yv, RealType const x)
 {
   RealType y{0.0};
-  size_t   i{0};
 
   auto const n = xv.size();
   ALBANY_ASSERT(n == yv.size(), "Vectors must have same size.\n");
 
-  while (xv[i] < x) {
-    if (i + 1 == n) break;
-    ++i;
-  }
+  // First abscissa not less than x, or the last one. The abscissae are
+  // increasing, so binary search finds it.
+  size_t const i = std::min<size_t>(std::lower_bound(xv.begin(), xv.end(), x) - xv.begin(), n - 1);
 
   if (i == 0) {
     y = yv[0];
@@ -24,6 +24,8 @@ operator<<(std::ostream& os, const std::vector<RealType>& t);
 std::vector<std::vector<RealType>>
 twoDvectorFromFile(std::string const& filename);
 
+// Piecewise linear interpolation, clamped at the ends. The abscissae xv
+// must be increasing, the readers of the ACE tables check that.
 RealType
 interpolateVectors(std::vector<RealType> const& xv, std::vector<RealType> const& yv, RealType const x);
 
@@ -261,7 +261,18 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(Teuchos::ParameterLis
   } else if (model_name == "Creep") {
     model = rcp(new CreepModel<EvalT, Traits>(p, dl));
   } else if (model_name == "CrystalPlasticity") {
-    model = rcp(new CrystalPlasticityModel<EvalT, Traits>(p, dl));
+    // Size per-point slip arrays and the local system to the crystal.
+    int const num_slip = p->get<int>("Number of Slip Systems", 0);
+    ALBANY_ASSERT(num_slip <= static_cast<int>(CP::MAX_SLIP), "CrystalPlasticity supports at most " << CP::MAX_SLIP << " slip systems");
+    if (num_slip <= 12) {
+      model = rcp(new CrystalPlasticityModel<EvalT, Traits, 12>(p, dl));
+    } else if (num_slip <= 18) {
+      model = rcp(new CrystalPlasticityModel<EvalT, Traits, 18>(p, dl));
+    } else if (num_slip <= 24) {
+      model = rcp(new CrystalPlasticityModel<EvalT, Traits, 24>(p, dl));
+    } else {
+      model = rcp(new CrystalPlasticityModel<EvalT, Traits>(p, dl));
+    }
   } else if (model_name == "Drucker Prager") {
     model = rcp(new DruckerPragerModel<EvalT, Traits>(p, dl));
   } else if (model_name == "ElasticCrystal") {
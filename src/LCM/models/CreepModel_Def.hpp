@@ -218,11 +218,11 @@ CreepModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
           ScalarT debug_dFdX[max_count + 1];
           ScalarT debug_res[max_count + 1];
 
-          LocalNonlinearSolver<EvalT, Traits> solver;
+          FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-          std::vector<ScalarT> F(1);
-          std::vector<ScalarT> dFdX(1);
-          std::vector<ScalarT> X(1);
+          std::array<ScalarT, 1> F;
+          std::array<ScalarT, 1> dFdX;
+          std::array<ScalarT, 1> X;
 
           X[0] = creep_initial_guess_;
 
@@ -348,11 +348,11 @@ CreepModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
         // smag_new = 0.0;
         dgam_plastic = 0.0;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F;
+        std::array<ScalarT, 1> dFdX;
+        std::array<ScalarT, 1> X;
 
         F[0]    = f;
         X[0]    = 0.0;
@@ -8,11 +8,18 @@
 #include "PHAL_AlbanyTraits.hpp"
 #include "ParallelConstitutiveModel_Def.hpp"
 
-template <typename EvalT, typename Traits>
-LCM::CrystalPlasticityModel<EvalT, Traits>::CrystalPlasticityModel(Teuchos::ParameterList* p, Teuchos::RCP<Albany::Layouts> const& dl)
-    : LCM::ParallelConstitutiveModel<EvalT, Traits, CrystalPlasticityKernel<EvalT, Traits>>(p, dl)
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+LCM::CrystalPlasticityModel<EvalT, Traits, NumSlipT>::CrystalPlasticityModel(Teuchos::ParameterList* p, Teuchos::RCP<Albany::Layouts> const& dl)
+    : LCM::ParallelConstitutiveModel<EvalT, Traits, CrystalPlasticityKernel<EvalT, Traits, NumSlipT>>(p, dl)
 {
 }
 
+// Slip-count specializations, selected in ConstitutiveModelInterface
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityKernel, 12)
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityKernel, 18)
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityKernel, 24)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CrystalPlasticityKernel)
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityModel, 12)
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityModel, 18)
+PHAL_INSTANTIATE_TEMPLATE_CLASS_WITH_EXTRA_ARGS(LCM::CrystalPlasticityModel, 24)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CrystalPlasticityModel)
@@ -15,7 +15,9 @@
 namespace LCM {
 
 //! \brief CrystalPlasticity Plasticity Constitutive Model
-template <typename EvalT, typename Traits>
+//! NumSlipT is the compile-time capacity of the per-point slip arrays and of
+//! the local nonlinear system; it must be at least the number of slip systems.
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT = CP::MAX_SLIP>
 class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 {
  public:
@@ -79,11 +81,59 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   void
   finalize(
-      CP::StateMechanical<ScalarT, CP::MAX_DIM> const&                                state_mechanical,
-      CP::StateInternal<ScalarT, CP::MAX_SLIP> const&                                 state_internal,
-      utility::StaticPointer<CP::Integrator<EvalT, CP::MAX_DIM, CP::MAX_SLIP>> const& integrator,
-      int const                                                                       cell,
-      int const                                                                       pt) const;
+      CP::StateMechanical<ScalarT, CP::MAX_DIM> const& state_mechanical,
+      CP::StateInternal<ScalarT, NumSlipT> const&      state_internal,
+      RealType const                                   norm_residual,
+      int const                                        num_iters,
+      int const                                        cell,
+      int const                                        pt) const;
+
+  ///
+  /// Integrate the local problem over a step of size dt from the state held
+  /// by state_mechanical and state_internal. Failures are recorded in status
+  /// and not in the global NOX status test. Returns false on failure.
+  ///
+  bool
+  integrateStep(
+      utility::StaticAllocator&                                allocator,
+      std::vector<CP::SlipSystem<CP::MAX_DIM>> const&          element_slip_systems,
+      minitensor::Tensor4<ScalarT, CP::MAX_DIM> const&         C,
+      CP::StateMechanical<ScalarT, CP::MAX_DIM>&               state_mechanical,
+      CP::StateInternal<ScalarT, NumSlipT>&                    state_internal,
+      RealType const                                           dt,
+      Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> const& status,
+      RealType&                                                norm_residual,
+      int&                                                     num_iters) const;
+
+  ///
+  /// Integrate the local problem over the step with adaptive substeps,
+  /// warm-started from the slip rates of the previous step. On success the
+  /// end-of-step results are written to state_mechanical and state_internal.
+  /// Returns false if the substep budget is exhausted.
+  ///
+  bool
+  integrateSubsteps(
+      utility::StaticAllocator&                                allocator,
+      std::vector<CP::SlipSystem<CP::MAX_DIM>> const&          element_slip_systems,
+      minitensor::Tensor4<ScalarT, CP::MAX_DIM> const&         C,
+      minitensor::Vector<RealType, NumSlipT> const&            slip_dot_n,
+      CP::StateMechanical<ScalarT, CP::MAX_DIM>&               state_mechanical,
+      CP::StateInternal<ScalarT, NumSlipT>&                    state_internal,
+      Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> const& status,
+      RealType&                                                norm_residual,
+      int&                                                     num_iters) const;
+
+  ///
+  /// Embedded error estimate of a backward Euler step, relative to the
+  /// substep tolerance: half the distance to the forward Euler step taken
+  /// with the slip rates at the start of the step.
+  ///
+  RealType
+  estimateSlipError(
+      minitensor::Vector<RealType, NumSlipT> const& slip_start,
+      minitensor::Vector<RealType, NumSlipT> const& rates_start,
+      minitensor::Vector<ScalarT, NumSlipT> const&  slip_end,
+      RealType const                                dt) const;
 
   ///
   ///  Set a NOX status test to Failed, which will trigger Piro to cut the
@@ -147,7 +197,7 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
   minitensor::Tensor4<ScalarT, CP::MAX_DIM> C_unrotated_;
 
   /// Vector of structs holding slip system family data
-  std::vector<CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>> slip_families_;
+  std::vector<CP::SlipFamily<CP::MAX_DIM, NumSlipT>> slip_families_;
 
   /// Vector of structs holding slip system data
   std::vector<CP::SlipSystem<CP::MAX_DIM>> slip_systems_;
@@ -167,10 +217,10 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
   minitensor::StepType step_type_{minitensor::StepType::UNDEFINED};
 
   /// Minisolver Minimizer
-  minitensor::Minimizer<ValueT, CP::NLS_DIM> minimizer_;
+  minitensor::Minimizer<ValueT, CP::NlsDim<NumSlipT>::value> minimizer_;
 
   /// ROL Minimizer
-  ROL::MiniTensor_Minimizer<ValueT, CP::NLS_DIM> rol_minimizer_;
+  ROL::MiniTensor_Minimizer<ValueT, CP::NlsDim<NumSlipT>::value> rol_minimizer_;
 
   ///
   /// Output options
@@ -179,6 +229,20 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   bool write_data_file_{false};
 
+  ///
+  /// Local substepping options. A point whose step fails, or whose error
+  /// estimate exceeds the tolerance, is subdivided before a global load step
+  /// reduction is requested. The budget counts every attempt at the point,
+  /// the full step included, so a budget of 1 disables substepping. A zero
+  /// tolerance disables the error control and only failures are substepped.
+  /// The residual and Jacobian evaluations take the same substeps. The
+  /// tangent of a substepped point ignores the sensitivities of the substep
+  /// start states, so it is only approximate.
+  ///
+  int max_num_substeps_{1};
+
+  RealType substep_tolerance_{0.0};
+
   ///
   /// Dependent MDFields
   ///
@@ -254,6 +318,10 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   std::string const temperature_string_ = "Temperature";
 
+  std::string const Fp_old_string_ = Fp_string_ + "_old";
+
+  std::string const F_old_string_ = F_string_ + "_old";
+
   ///
   /// State Variables
   ///
@@ -261,13 +329,17 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   Albany::MDArray previous_defgrad_;
 
+  Albany::StateHandle Fp_old_handle_{-1};
+
+  Albany::StateHandle F_old_handle_{-1};
+
   RealType dt_{0.0};
 
   Teuchos::ArrayRCP<RealType*> rotation_matrix_transpose_;
 };
 
-template <typename EvalT, typename Traits>
-class CrystalPlasticityModel : public LCM::ParallelConstitutiveModel<EvalT, Traits, CrystalPlasticityKernel<EvalT, Traits>>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT = CP::MAX_SLIP>
+class CrystalPlasticityModel : public LCM::ParallelConstitutiveModel<EvalT, Traits, CrystalPlasticityKernel<EvalT, Traits, NumSlipT>>
 {
  public:
   CrystalPlasticityModel(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl);
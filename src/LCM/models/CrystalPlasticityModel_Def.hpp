@@ -50,14 +50,14 @@ isnaninf(const T& x)
 }  // anonymous namespace
 
 namespace LCM {
-template <typename EvalT, typename Traits>
-CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::CrystalPlasticityKernel(
     ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
     Teuchos::RCP<Albany::Layouts> const& dl)
     : BaseKernel(model), num_family_(p->get<int>("Number of Slip Families", 1)), num_slip_(p->get<int>("Number of Slip Systems", 0))
 {
-  CP::ParameterReader<EvalT, Traits> preader(p);
+  CP::ParameterReader<EvalT, Traits, NumSlipT> preader(p);
 
   slip_systems_.resize(num_slip_);
 
@@ -119,6 +119,12 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
 
   write_data_file_ = p->get<bool>("Write Data File", false);
 
+  max_num_substeps_  = p->get<int>("Maximum Number of Substeps", 1);
+  substep_tolerance_ = p->get<RealType>("Substep Tolerance", 0.0);
+
+  ALBANY_ASSERT(max_num_substeps_ >= 1, "Maximum Number of Substeps must be at least 1");
+  ALBANY_ASSERT(substep_tolerance_ >= 0.0, "Substep Tolerance must be non-negative");
+
   if (verbosity_ >= CP::Verbosity::HIGH) {
     std::cout << ">>> in cp constructor\n";
     std::cout << ">>> parameter list:\n" << *p << std::endl;
@@ -169,7 +175,7 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
 
     slip_system.slip_family_index_ = ss_list.get<int>("Slip Family", 0);
 
-    CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>& slip_family = slip_families_[slip_system.slip_family_index_];
+    CP::SlipFamily<CP::MAX_DIM, NumSlipT>& slip_family = slip_families_[slip_system.slip_family_index_];
 
     minitensor::Index slip_system_index = slip_family.num_slip_sys_;
 
@@ -221,8 +227,12 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
     // Create latent matrix for hardening law
     slip_family.phardening_parameters_->createLatentMatrix(slip_family, slip_systems_);
 
+    // Select the cheapest exact product for the latent hardening interaction
+    slip_family.setLatentOperators();
+
     if (verbosity_ >= CP::Verbosity::HIGH) {
       std::cout << slip_family.latent_matrix_ << std::endl;
+      std::cout << "latent matrix structure: " << slip_family.latent_operator_.getStructureName() << std::endl;
     }
 
     slip_family.slip_system_indices_.set_dimension(slip_family.num_slip_sys_);
@@ -342,9 +352,9 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
 }
 
 // Initialize state for computing the constitutive response of the material
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 void
-CrystalPlasticityKernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT const>& dep_fields, FieldMap<ScalarT>& eval_fields)
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::init(Workset& workset, FieldMap<ScalarT const>& dep_fields, FieldMap<ScalarT>& eval_fields)
 {
   if (verbosity_ == CP::Verbosity::EXTREME) {
     index_element_ = workset.wsIndex;
@@ -396,8 +406,8 @@ CrystalPlasticityKernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT
 
   // get state variables
 
-  previous_plastic_deformation_ = (*workset.stateArrayPtr)[Fp_string_ + "_old"];
-  previous_defgrad_             = (*workset.stateArrayPtr)[F_string_ + "_old"];
+  previous_plastic_deformation_ = workset.getStateArray(Fp_old_string_, Fp_old_handle_);
+  previous_defgrad_             = workset.getStateArray(F_old_string_, F_old_handle_);
 
   dt_ = SSV::eval(delta_time_(0));
 
@@ -406,9 +416,9 @@ CrystalPlasticityKernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT
   // nox_status_test_->status_ = NOX::StatusTest::Unevaluated;
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 KOKKOS_INLINE_FUNCTION void
-CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::operator()(int cell, int pt) const
 {
   if (verbosity_ >= CP::Verbosity::MEDIUM) {
     std::cout << ">>> in kernel::operator\n";
@@ -424,16 +434,19 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
   // TODO: In the future for CUDA this should be moved out of the kernel because
   // it uses dynamic allocation for the buffer. It should also be modified to
   // use cudaMalloc.
-  utility::StaticAllocator allocator(1024 * 1024);
+  // The buffer is allocated once per thread and rewound for every point; the
+  // integrator built below is placement-constructed into it.
+  static thread_local utility::StaticAllocator allocator(1024 * 1024);
+  allocator.clear();
 
   // Known quantities
   minitensor::Tensor<RealType, CP::MAX_DIM> Fp_n(num_dims_);
 
-  minitensor::Vector<RealType, CP::MAX_SLIP> slip_n(num_slip_);
+  minitensor::Vector<RealType, NumSlipT> slip_n(num_slip_);
 
-  minitensor::Vector<RealType, CP::MAX_SLIP> slip_dot_n(num_slip_);
+  minitensor::Vector<RealType, NumSlipT> slip_dot_n(num_slip_);
 
-  minitensor::Vector<RealType, CP::MAX_SLIP> state_hardening_n(num_slip_);
+  minitensor::Vector<RealType, NumSlipT> state_hardening_n(num_slip_);
 
   minitensor::Tensor<ScalarT, CP::MAX_DIM> F_np1(num_dims_);
 
@@ -448,11 +461,11 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
   minitensor::Tensor<ScalarT, CP::MAX_DIM> S_np1(num_dims_);
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> slip_np1(num_slip_);
+  minitensor::Vector<ScalarT, NumSlipT> slip_np1(num_slip_);
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> shear_np1(num_slip_);
+  minitensor::Vector<ScalarT, NumSlipT> shear_np1(num_slip_);
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> state_hardening_np1(num_slip_);
+  minitensor::Vector<ScalarT, NumSlipT> state_hardening_np1(num_slip_);
 
   ///
   /// Elasticity tensor
@@ -540,9 +553,15 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
   // Set up slip predictor to assign isochoric part of F_increment to
   // Fp_increment
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> slip_resistance(num_slip_, minitensor::Filler::ZEROS);
+  minitensor::Vector<ScalarT, NumSlipT> slip_resistance(num_slip_, minitensor::Filler::ZEROS);
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> rates_slip(num_slip_, minitensor::Filler::ZEROS);
+  minitensor::Vector<ScalarT, NumSlipT> rates_slip(num_slip_, minitensor::Filler::ZEROS);
+
+  // Failures at this point are first handled by local substepping.
+  static thread_local Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> status_point = Teuchos::rcp(new NOX::StatusTest::ModelEvaluatorFlag);
+
+  status_point->status_         = NOX::StatusTest::Unevaluated;
+  status_point->status_message_ = "";
 
   if (dt_ > 0.0) {
     bool failed{false};
@@ -560,7 +579,7 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
           std::cout << slip_np1 << std::endl;
         }
 
-        CP::updateHardness<CP::MAX_DIM, CP::MAX_SLIP, ScalarT>(
+        CP::updateHardness<CP::MAX_DIM, NumSlipT, ScalarT>(
             slip_systems_, slip_families_, dt_, rates_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
 
       } break;
@@ -580,7 +599,7 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
         auto const size_problem = std::max(num_slip_, num_dims_ * num_dims_);
 
-        minitensor::Tensor<RealType, CP::MAX_SLIP> dyad_matrix(size_problem);
+        minitensor::Tensor<RealType, NumSlipT> dyad_matrix(size_problem);
 
         dyad_matrix.fill(minitensor::Filler::ZEROS);
 
@@ -590,9 +609,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
           }
         }
 
-        minitensor::Tensor<RealType, CP::MAX_SLIP> U_svd(size_problem);
-        minitensor::Tensor<RealType, CP::MAX_SLIP> S_svd(size_problem);
-        minitensor::Tensor<RealType, CP::MAX_SLIP> V_svd(size_problem);
+        minitensor::Tensor<RealType, NumSlipT> U_svd(size_problem);
+        minitensor::Tensor<RealType, NumSlipT> S_svd(size_problem);
+        minitensor::Tensor<RealType, NumSlipT> V_svd(size_problem);
 
         std::tie(U_svd, S_svd, V_svd) = minitensor::svd(dyad_matrix);
 
@@ -600,9 +619,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
           S_svd(s, s) = S_svd(s, s) > 1.0e-12 ? 1.0 / S_svd(s, s) : 0.0;
         }
 
-        minitensor::Tensor<RealType, CP::MAX_SLIP> const Pinv = V_svd * S_svd * S_svd * minitensor::transpose(V_svd);
+        minitensor::Tensor<RealType, NumSlipT> const Pinv = V_svd * S_svd * S_svd * minitensor::transpose(V_svd);
 
-        minitensor::Vector<RealType, CP::MAX_SLIP> L_vec(size_problem, minitensor::Filler::ZEROS);
+        minitensor::Vector<RealType, NumSlipT> L_vec(size_problem, minitensor::Filler::ZEROS);
 
         int const num_p = 100;
 
@@ -610,13 +629,13 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
         RealType min_diff = CP::HUGE_;
 
-        minitensor::Vector<RealType, CP::MAX_SLIP> rates_slip_trial(num_slip_, minitensor::Filler::ZEROS);
+        minitensor::Vector<RealType, NumSlipT> rates_slip_trial(num_slip_, minitensor::Filler::ZEROS);
 
-        minitensor::Vector<RealType, CP::MAX_SLIP> slip_np1_trial(num_slip_, minitensor::Filler::ZEROS);
+        minitensor::Vector<RealType, NumSlipT> slip_np1_trial(num_slip_, minitensor::Filler::ZEROS);
 
-        minitensor::Vector<RealType, CP::MAX_SLIP> hardening_np1_trial(num_slip_, minitensor::Filler::ZEROS);
+        minitensor::Vector<RealType, NumSlipT> hardening_np1_trial(num_slip_, minitensor::Filler::ZEROS);
 
-        minitensor::Vector<RealType, CP::MAX_SLIP> slip_resistance_trial(num_slip_, minitensor::Filler::ZEROS);
+        minitensor::Vector<RealType, NumSlipT> slip_resistance_trial(num_slip_, minitensor::Filler::ZEROS);
 
         for (int p = 1; p < num_p; ++p) {
           RealType const portion_L = p * inc_portion;
@@ -627,9 +646,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
             }
           }
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> const dm_lv = minitensor::transpose(dyad_matrix) * L_vec;
+          minitensor::Vector<RealType, NumSlipT> const dm_lv = minitensor::transpose(dyad_matrix) * L_vec;
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> rates_slip_trial = Pinv * dm_lv;
+          minitensor::Vector<RealType, NumSlipT> rates_slip_trial = Pinv * dm_lv;
 
           RealType const limit_rate = 1e-8 * minitensor::norm(rates_slip_trial);
 
@@ -661,7 +680,7 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
           minitensor::Tensor<RealType, CP::MAX_DIM> Lp_trial(num_dims_, minitensor::Filler::ZEROS);
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> Lp_vec = dyad_matrix * rates_slip_trial;
+          minitensor::Vector<RealType, NumSlipT> Lp_vec = dyad_matrix * rates_slip_trial;
 
           for (int i = 0; i < num_dims_; ++i) {
             for (int j = 0; j < num_dims_; ++j) {
@@ -683,20 +702,20 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
           minitensor::Tensor<RealType, CP::MAX_DIM> Fp_np1_trial(num_dims_, minitensor::Filler::ZEROS);
 
           // Compute Lp_trial, and Fp_np1_trial
-          CP::applySlipIncrement<CP::MAX_DIM, CP::MAX_SLIP, RealType>(element_slip_systems, dt_, slip_n, slip_np1_trial, Fp_n, Lp_trial, Fp_np1_trial);
+          CP::applySlipIncrement<CP::MAX_DIM, NumSlipT, RealType>(element_slip_systems, dt_, slip_n, slip_np1_trial, Fp_n, Lp_trial, Fp_np1_trial);
 
           if (verbosity_ == CP::Verbosity::DEBUG) {
             std::cout << "Lp_trial" << std::endl;
             std::cout << std::setprecision(4) << Lp_trial << std::endl;
           }
 
-          // minitensor::Vector<RealType, CP::MAX_SLIP>
+          // minitensor::Vector<RealType, NumSlipT>
           // rates_hardening(num_slip_, minitensor::Filler::ZEROS);
 
-          CP::updateHardness<CP::MAX_DIM, CP::MAX_SLIP, RealType>(
+          CP::updateHardness<CP::MAX_DIM, NumSlipT, RealType>(
               slip_systems_, slip_families_, dt_, rates_slip_trial, state_hardening_n, hardening_np1_trial, slip_resistance_trial, failed);
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> shear_np1_trial_2(num_slip_);
+          minitensor::Vector<RealType, NumSlipT> shear_np1_trial_2(num_slip_);
 
           for (int s{0}; s < num_slip_; ++s) {
             auto const slip_family = slip_families_[element_slip_systems.at(s).slip_family_index_];
@@ -749,9 +768,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
           minitensor::Tensor<RealType, CP::MAX_DIM> S_np1(num_dims_);
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> shear_np1_trial(num_slip_);
+          minitensor::Vector<RealType, NumSlipT> shear_np1_trial(num_slip_);
 
-          CP::computeStress<CP::MAX_DIM, CP::MAX_SLIP, RealType>(
+          CP::computeStress<CP::MAX_DIM, NumSlipT, RealType>(
               element_slip_systems, C_peeled, F_np1_peeled, Fp_np1_trial, sigma_np1, S_np1, shear_np1_trial, failed);
 
           if (verbosity_ == CP::Verbosity::DEBUG) {
@@ -765,8 +784,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
           // Ensure that the stress was calculated properly
           if (failed == true) {
-            forceGlobalLoadStepReduction("Failed on initial guess");
-            return;
+            status_point->status_         = NOX::StatusTest::Failed;
+            status_point->status_message_ = "Failed on initial guess";
+            break;
           }
 
           minitensor::Tensor<RealType, CP::MAX_DIM> const F_e = F_np1_peeled * minitensor::inverse(Fp_np1_trial);
@@ -783,11 +803,12 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
           }
 
           if (failed) {
-            this->forceGlobalLoadStepReduction("Failed on hardness");
-            return;
+            status_point->status_         = NOX::StatusTest::Failed;
+            status_point->status_message_ = "Failed on hardness";
+            break;
           }
 
-          minitensor::Vector<RealType, CP::MAX_SLIP> correction_hardening(num_slip_, minitensor::Filler::ONES);
+          minitensor::Vector<RealType, NumSlipT> correction_hardening(num_slip_, minitensor::Filler::ONES);
 
           // for (int s(0); s < num_slip_; ++s) {
           //   correction_hardening[s] = 1.0 - 1.0 / hardening_np1_trial[s];
@@ -842,7 +863,7 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
   CP::StateMechanical<ScalarT, CP::MAX_DIM> state_mechanical(num_dims_, F_n, Fp_n, F_np1);
 
-  CP::StateInternal<ScalarT, CP::MAX_SLIP> state_internal(index_element_, pt, num_slip_, state_hardening_n, slip_n);
+  CP::StateInternal<ScalarT, NumSlipT> state_internal(index_element_, pt, num_slip_, state_hardening_n, slip_n);
 
   for (int s(0); s < num_slip_; ++s) {
     state_internal.rates_slip_[s]    = rates_slip[s];
@@ -866,23 +887,27 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     }
   }
 
-  auto integratorFactory = CP::IntegratorFactory<EvalT, CP::MAX_DIM, CP::MAX_SLIP>(
-      allocator,
-      minimizer_,
-      rol_minimizer_,
-      step_type_,
-      nox_status_test_,
-      element_slip_systems,
-      slip_families_,
-      state_mechanical,
-      state_internal,
-      C,
-      dt_,
-      verbosity_);
-
-  utility::StaticPointer<CP::Integrator<EvalT, CP::MAX_DIM, CP::MAX_SLIP>> integrator = integratorFactory(integration_scheme_, residual_type_);
+  RealType norm_residual{0.0};
 
-  integrator->update();
+  int num_iters{0};
+
+  bool converged = status_point->status_ != NOX::StatusTest::Failed;
+
+  if (converged == true) {
+    converged = integrateStep(allocator, element_slip_systems, C, state_mechanical, state_internal, dt_, status_point, norm_residual, num_iters);
+  }
+
+  // Reject an inaccurate full step only if it can be subdivided
+  if (converged == true && max_num_substeps_ > 1 && substep_tolerance_ > 0.0 && dt_ > 0.0) {
+    converged = estimateSlipError(slip_n, slip_dot_n, state_internal.slip_np1_, dt_) <= 1.0;
+  }
+
+  if (converged == false && max_num_substeps_ > 1 && dt_ > 0.0) {
+    if (verbosity_ >= CP::Verbosity::HIGH) {
+      std::cout << "Substepping cell " << cell << " point " << pt << ": " << status_point->status_message_ << std::endl;
+    }
+    converged = integrateSubsteps(allocator, element_slip_systems, C, slip_dot_n, state_mechanical, state_internal, status_point, norm_residual, num_iters);
+  }
 
   if (verbosity_ >= CP::Verbosity::MEDIUM) {
     std::cout << "Fp_{n+1}" << std::endl;
@@ -893,15 +918,13 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     std::cout << state_internal.hardening_np1_ << std::endl;
   }
 
-  // Check to make sure there is only one status test
-  ALBANY_ASSERT(integrator->getStatus() == nox_status_test_->status_);
-
   // Exit early if update state is not successful
-  if (nox_status_test_->status_ == NOX::StatusTest::Failed) {
+  if (converged == false) {
+    forceGlobalLoadStepReduction(status_point->status_message_);
     return;
   }
 
-  finalize(state_mechanical, state_internal, integrator, cell, pt);
+  finalize(state_mechanical, state_internal, norm_residual, num_iters, cell, pt);
 
   if (write_data_file_) {
     if (cell == 0 && pt == 0) {
@@ -979,14 +1002,15 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 ///
 /// Return calculated quantities to Albany
 ///
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 void
-CrystalPlasticityKernel<EvalT, Traits>::finalize(
-    CP::StateMechanical<ScalarT, CP::MAX_DIM> const&                                state_mechanical,
-    CP::StateInternal<ScalarT, CP::MAX_SLIP> const&                                 state_internal,
-    utility::StaticPointer<CP::Integrator<EvalT, CP::MAX_DIM, CP::MAX_SLIP>> const& integrator,
-    int const                                                                       cell,
-    int const                                                                       pt) const
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::finalize(
+    CP::StateMechanical<ScalarT, CP::MAX_DIM> const& state_mechanical,
+    CP::StateInternal<ScalarT, NumSlipT> const&      state_internal,
+    RealType const                                   norm_residual,
+    int const                                        num_iters,
+    int const                                        cell,
+    int const                                        pt) const
 {
   ///
   /// Mechanical state
@@ -1004,13 +1028,13 @@ CrystalPlasticityKernel<EvalT, Traits>::finalize(
   ///
   /// Internal state
   ///
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> const state_hardening_np1 = state_internal.hardening_np1_;
+  minitensor::Vector<ScalarT, NumSlipT> const state_hardening_np1 = state_internal.hardening_np1_;
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> const slip_np1 = state_internal.slip_np1_;
+  minitensor::Vector<ScalarT, NumSlipT> const slip_np1 = state_internal.slip_np1_;
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> const shear_np1 = state_internal.shear_np1_;
+  minitensor::Vector<ScalarT, NumSlipT> const shear_np1 = state_internal.shear_np1_;
 
-  minitensor::Vector<ScalarT, CP::MAX_SLIP> const rates_slip = state_internal.rates_slip_;
+  minitensor::Vector<ScalarT, NumSlipT> const rates_slip = state_internal.rates_slip_;
 
   ///
   /// Mechanical heat source
@@ -1045,8 +1069,8 @@ CrystalPlasticityKernel<EvalT, Traits>::finalize(
   ///
 
   // residual norm
-  cp_residual_(cell, pt)      = integrator->getNormResidual();
-  cp_residual_iter_(cell, pt) = integrator->getNumIters();
+  cp_residual_(cell, pt)      = norm_residual;
+  cp_residual_iter_(cell, pt) = num_iters;
 
   minitensor::Tensor<RealType, CP::MAX_DIM> const inv_F = minitensor::inverse(F_n);
 
@@ -1080,4 +1104,192 @@ CrystalPlasticityKernel<EvalT, Traits>::finalize(
   return;
 }  // void finalize
 
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+bool
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::integrateStep(
+    utility::StaticAllocator&                                allocator,
+    std::vector<CP::SlipSystem<CP::MAX_DIM>> const&          element_slip_systems,
+    minitensor::Tensor4<ScalarT, CP::MAX_DIM> const&         C,
+    CP::StateMechanical<ScalarT, CP::MAX_DIM>&               state_mechanical,
+    CP::StateInternal<ScalarT, NumSlipT>&                    state_internal,
+    RealType const                                           dt,
+    Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> const& status,
+    RealType&                                                norm_residual,
+    int&                                                     num_iters) const
+{
+  status->status_         = NOX::StatusTest::Unevaluated;
+  status->status_message_ = "";
+
+  // The integrator of a previous attempt at this point is no longer needed
+  allocator.clear();
+
+  auto integratorFactory = CP::IntegratorFactory<EvalT, CP::MAX_DIM, NumSlipT>(
+      allocator, minimizer_, rol_minimizer_, step_type_, status, element_slip_systems, slip_families_, state_mechanical, state_internal, C, dt, verbosity_);
+
+  utility::StaticPointer<CP::Integrator<EvalT, CP::MAX_DIM, NumSlipT>> integrator = integratorFactory(integration_scheme_, residual_type_);
+
+  integrator->update();
+
+  norm_residual = integrator->getNormResidual();
+  num_iters     = integrator->getNumIters();
+
+  return integrator->getStatus() != NOX::StatusTest::Failed;
+}
+
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+bool
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::integrateSubsteps(
+    utility::StaticAllocator&                                allocator,
+    std::vector<CP::SlipSystem<CP::MAX_DIM>> const&          element_slip_systems,
+    minitensor::Tensor4<ScalarT, CP::MAX_DIM> const&         C,
+    minitensor::Vector<RealType, NumSlipT> const&            slip_dot_n,
+    CP::StateMechanical<ScalarT, CP::MAX_DIM>&               state_mechanical,
+    CP::StateInternal<ScalarT, NumSlipT>&                    state_internal,
+    Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> const& status,
+    RealType&                                                norm_residual,
+    int&                                                     num_iters) const
+{
+  // Step size controller for a first order method with a second order
+  // error estimate
+  RealType const safety{0.9};
+
+  RealType const factor_min{0.2};
+
+  RealType const factor_max{4.0};
+
+  // State at the start of the current substep. Only values are carried over,
+  // so the sensitivities returned are those of the last substep and the
+  // tangent is approximate. The decisions to accept or reject depend on
+  // values only, so every evaluation type takes the same substeps.
+  minitensor::Tensor<RealType, CP::MAX_DIM> F_k = state_mechanical.F_n_;
+
+  minitensor::Tensor<RealType, CP::MAX_DIM> Fp_k = state_mechanical.Fp_n_;
+
+  minitensor::Vector<RealType, NumSlipT> slip_k = state_internal.slip_n_;
+
+  minitensor::Vector<RealType, NumSlipT> hardening_k = state_internal.hardening_n_;
+
+  minitensor::Vector<RealType, NumSlipT> rates_k = slip_dot_n;
+
+  minitensor::Tensor<ScalarT, CP::MAX_DIM> const F_increment = state_mechanical.F_np1_ - state_mechanical.F_n_;
+
+  minitensor::Tensor<ScalarT, CP::MAX_DIM> Lp_integral(num_dims_, minitensor::Filler::ZEROS);
+
+  RealType time{0.0};
+
+  RealType step{0.5 * dt_};
+
+  // The full step has already used one attempt of the budget
+  for (int num_substeps = 1; num_substeps < max_num_substeps_; ++num_substeps) {
+    bool const last = time + step >= (1.0 - CP::MIN_TOL) * dt_;
+
+    if (last == true) {
+      step = dt_ - time;
+    }
+
+    minitensor::Tensor<ScalarT, CP::MAX_DIM> F_k1 = state_mechanical.F_np1_;
+
+    if (last == false) {
+      F_k1 = state_mechanical.F_n_ + (time + step) / dt_ * F_increment;
+    }
+
+    CP::StateMechanical<ScalarT, CP::MAX_DIM> substate_mechanical(num_dims_, F_k, Fp_k, F_k1);
+
+    CP::StateInternal<ScalarT, NumSlipT> substate_internal(state_internal.cell_, state_internal.pt_, num_slip_, hardening_k, slip_k);
+
+    // Warm start from the slip rates at the start of the substep
+    for (int s(0); s < num_slip_; ++s) {
+      substate_internal.rates_slip_[s] = rates_k[s];
+      substate_internal.slip_np1_[s]   = slip_k[s] + step * rates_k[s];
+    }
+
+    bool failed{false};
+
+    CP::updateHardness<CP::MAX_DIM, NumSlipT, ScalarT>(
+        element_slip_systems,
+        slip_families_,
+        step,
+        substate_internal.rates_slip_,
+        hardening_k,
+        substate_internal.hardening_np1_,
+        substate_internal.resistance_,
+        failed);
+
+    // A hardness update that fails rejects the substep like a failed solve
+    bool converged = failed == false;
+
+    if (converged == true) {
+      converged = integrateStep(allocator, element_slip_systems, C, substate_mechanical, substate_internal, step, status, norm_residual, num_iters);
+    }
+
+    RealType error{0.0};
+
+    if (converged == true && substep_tolerance_ > 0.0) {
+      error = estimateSlipError(slip_k, rates_k, substate_internal.slip_np1_, step);
+    }
+
+    if (verbosity_ >= CP::Verbosity::HIGH) {
+      std::cout << "Substep " << num_substeps << " t: " << time << " dt: " << step;
+      std::cout << " converged: " << converged << " error: " << error << std::endl;
+    }
+
+    // Reject the substep and retry with a smaller one
+    if (converged == false || error > 1.0) {
+      step *= converged == true ? std::max(factor_min, safety / std::sqrt(error)) : factor_min;
+      continue;
+    }
+
+    time += step;
+
+    Lp_integral += step * substate_mechanical.Lp_np1_;
+
+    if (last == true) {
+      state_mechanical.Fp_np1_    = substate_mechanical.Fp_np1_;
+      state_mechanical.Lp_np1_    = Lp_integral / dt_;
+      state_mechanical.sigma_np1_ = substate_mechanical.sigma_np1_;
+      state_mechanical.S_np1_     = substate_mechanical.S_np1_;
+
+      state_internal.rates_slip_    = substate_internal.rates_slip_;
+      state_internal.hardening_np1_ = substate_internal.hardening_np1_;
+      state_internal.slip_np1_      = substate_internal.slip_np1_;
+      state_internal.shear_np1_     = substate_internal.shear_np1_;
+      state_internal.resistance_    = substate_internal.resistance_;
+
+      return true;
+    }
+
+    F_k         = LCM::peel_tensor<EvalT, RealType, CP::MAX_DIM, CP::MAX_DIM>()(F_k1);
+    Fp_k        = LCM::peel_tensor<EvalT, RealType, CP::MAX_DIM, CP::MAX_DIM>()(substate_mechanical.Fp_np1_);
+    slip_k      = LCM::peel_vector<EvalT, RealType, CP::MAX_DIM, NumSlipT>()(substate_internal.slip_np1_);
+    hardening_k = LCM::peel_vector<EvalT, RealType, CP::MAX_DIM, NumSlipT>()(substate_internal.hardening_np1_);
+    rates_k     = LCM::peel_vector<EvalT, RealType, CP::MAX_DIM, NumSlipT>()(substate_internal.rates_slip_);
+
+    step *= error > 0.0 ? std::min(factor_max, safety / std::sqrt(error)) : factor_max;
+  }
+
+  status->status_         = NOX::StatusTest::Failed;
+  status->status_message_ = "Crystal plasticity substep budget exhausted";
+
+  return false;
+}
+
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+RealType
+CrystalPlasticityKernel<EvalT, Traits, NumSlipT>::estimateSlipError(
+    minitensor::Vector<RealType, NumSlipT> const& slip_start,
+    minitensor::Vector<RealType, NumSlipT> const& rates_start,
+    minitensor::Vector<ScalarT, NumSlipT> const&  slip_end,
+    RealType const                                dt) const
+{
+  RealType error{0.0};
+
+  for (int s(0); s < num_slip_; ++s) {
+    RealType const slip_explicit = slip_start[s] + dt * rates_start[s];
+
+    error = std::max(error, std::abs(SSV::eval(slip_end[s]) - slip_explicit));
+  }
+
+  return 0.5 * error / substep_tolerance_;
+}
+
 }  // namespace LCM
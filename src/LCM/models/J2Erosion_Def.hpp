@@ -1,6 +1,8 @@
 // Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
+#include <algorithm>
+
 #include "ACEcommon.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "J2Erosion.hpp"
@@ -44,6 +46,7 @@ J2ErosionKernel<EvalT, Traits>::J2ErosionKernel(ConstitutiveModel<EvalT, Traits>
   if (p->isParameter("ACE Time File") == true) {
     auto const filename = p->get<std::string>("ACE Time File");
     time_               = vectorFromFile(filename);
+    ALBANY_ASSERT(std::is_sorted(time_.begin(), time_.end()) == true, "*** ERROR: Times in ACE Time File must be increasing.");
   }
   ALBANY_ASSERT(
       time_.size() == sea_level_.size(),
@@ -52,6 +55,9 @@ J2ErosionKernel<EvalT, Traits>::J2ErosionKernel(ConstitutiveModel<EvalT, Traits>
   if (p->isParameter("ACE Z Depth File") == true) {
     auto const filename     = p->get<std::string>("ACE Z Depth File");
     z_above_mean_sea_level_ = vectorFromFile(filename);
+    ALBANY_ASSERT(
+        std::is_sorted(z_above_mean_sea_level_.begin(), z_above_mean_sea_level_.end()) == true,
+        "*** ERROR: Z values in ACE Z Depth File must be increasing.");
   }
   if (p->isParameter("ACE_Porosity File") == true) {
     auto const filename = p->get<std::string>("ACE_Porosity File");
@@ -71,6 +71,11 @@ class J2Model : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   RealType sat_mod_, sat_exp_;
 
+  ///
+  /// Cached handles of the old Fp and eqps states
+  ///
+  Albany::StateHandle Fp_old_handle_{-1}, eqps_old_handle_{-1};
+
   // Kokkos
   virtual void
   computeStateParallel(typename Traits::EvalData workset, DepFieldMap dep_fields, FieldMap eval_fields);
@@ -119,8 +119,8 @@ J2Model<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepField
   }
 
   // get State Variables
-  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fpold   = workset.getStateArray(Fp_string + "_old", Fp_old_handle_);
+  Albany::MDArray eqpsold = workset.getStateArray(eqps_string + "_old", eqps_old_handle_);
 
   ScalarT kappa, mu, mubar, K, Y;
   ScalarT Jm23, trace, smag2, smag, f, p, dgam;
@@ -190,11 +190,11 @@ J2Model<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepField
 
         int const num_max_iter = 30;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F;
+        std::array<ScalarT, 1> dFdX;
+        std::array<ScalarT, 1> X;
 
         F[0] = f;
         X[0] = 0.0;
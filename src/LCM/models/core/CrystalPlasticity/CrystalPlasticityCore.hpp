@@ -32,6 +32,63 @@ struct SlipSystem
   RealType state_hardening_initial_;
 };
 
+// Latent hardening interaction operator. The structure of the interaction
+// matrix is detected once when the slip family is set up, and apply() then
+// uses the cheapest exact product for it instead of a dense one.
+template <minitensor::Index NumSlipT>
+class LatentOperator
+{
+ public:
+  LatentOperator() {}
+
+  void
+  setMatrix(minitensor::Tensor<RealType, NumSlipT> const& matrix);
+
+  template <typename ArgT>
+  minitensor::Vector<ArgT, NumSlipT>
+  apply(minitensor::Vector<ArgT, NumSlipT> const& x) const;
+
+  LatentStructure
+  getStructure() const
+  {
+    return structure_;
+  }
+
+  std::string
+  getStructureName() const;
+
+ private:
+  LatentStructure structure_{LatentStructure::ZERO};
+
+  minitensor::Index dimension_{0};
+
+  // Rank one: A = u v^T
+  minitensor::Vector<RealType, NumSlipT> u_;
+
+  minitensor::Vector<RealType, NumSlipT> v_;
+
+  // Block diagonal up to a permutation: the rows and columns of block b are
+  // block_indices_[block_offsets_[b], block_offsets_[b + 1]) and its dense
+  // entries start at block_values_offsets_[b], stored by rows.
+  std::vector<minitensor::Index> block_indices_;
+
+  std::vector<minitensor::Index> block_offsets_;
+
+  std::vector<minitensor::Index> block_values_offsets_;
+
+  std::vector<RealType> block_values_;
+
+  // Sparse in compressed row storage
+  std::vector<minitensor::Index> row_offsets_;
+
+  std::vector<minitensor::Index> column_indices_;
+
+  std::vector<RealType> values_;
+
+  // Dense
+  minitensor::Tensor<RealType, NumSlipT> matrix_;
+};
+
 // Slip system family - collection of slip systems grouped by flow and
 // hardening characteristics
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
@@ -57,6 +114,10 @@ class SlipFamily
     return type_flow_rule_;
   }
 
+  // Build the structured operators from the latent and auxiliary matrices.
+  void
+  setLatentOperators();
+
   minitensor::Index num_slip_sys_{0};
 
   minitensor::Vector<minitensor::Index, NumSlipT> slip_system_indices_;
@@ -69,6 +130,10 @@ class SlipFamily
 
   minitensor::Tensor<RealType, NumSlipT> aux_matrix_;
 
+  LatentOperator<NumSlipT> latent_operator_;
+
+  LatentOperator<NumSlipT> aux_operator_;
+
  private:
   HardeningLawType type_hardening_law_{HardeningLawType::UNDEFINED};
 
@@ -17,7 +17,7 @@ CP::SlipFamily<NumDimT, NumSlipT>::setHardeningLawType(CP::HardeningLawType law)
 {
   type_hardening_law_ = law;
 
-  phardening_parameters_ = CP::hardeningParameterFactory<CP::MAX_DIM, CP::MAX_SLIP>(type_hardening_law_);
+  phardening_parameters_ = CP::hardeningParameterFactory<NumDimT, NumSlipT>(type_hardening_law_);
 }
 
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
@@ -29,6 +29,241 @@ CP::SlipFamily<NumDimT, NumSlipT>::setFlowRuleType(CP::FlowRuleType rule)
   pflow_parameters_ = CP::flowParameterFactory(type_flow_rule_);
 }
 
+template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
+void
+CP::SlipFamily<NumDimT, NumSlipT>::setLatentOperators()
+{
+  latent_operator_.setMatrix(latent_matrix_);
+
+  // Only the dislocation density law defines the auxiliary matrix
+  if (type_hardening_law_ == HardeningLawType::DISLOCATION_DENSITY) {
+    aux_operator_.setMatrix(aux_matrix_);
+  }
+}
+
+template <minitensor::Index NumSlipT>
+void
+CP::LatentOperator<NumSlipT>::setMatrix(minitensor::Tensor<RealType, NumSlipT> const& matrix)
+{
+  minitensor::Index const n = matrix.get_dimension();
+
+  dimension_ = n;
+  block_indices_.clear();
+  block_offsets_.clear();
+  block_values_offsets_.clear();
+  block_values_.clear();
+  row_offsets_.clear();
+  column_indices_.clear();
+  values_.clear();
+
+  RealType          max_abs{0.0};
+  minitensor::Index pivot_row{0};
+  minitensor::Index pivot_col{0};
+
+  for (minitensor::Index i(0); i < n; ++i) {
+    for (minitensor::Index j(0); j < n; ++j) {
+      if (std::abs(matrix(i, j)) > max_abs) {
+        max_abs   = std::abs(matrix(i, j));
+        pivot_row = i;
+        pivot_col = j;
+      }
+    }
+  }
+
+  if (max_abs == 0.0) {
+    structure_ = LatentStructure::ZERO;
+    return;
+  }
+
+  // Entries below this are rounding noise of the geometric constructions.
+  RealType const tol = CP::MIN_TOL * max_abs;
+
+  // Rank one: every row is a multiple of the pivot row.
+  u_.set_dimension(n);
+  v_.set_dimension(n);
+
+  for (minitensor::Index i(0); i < n; ++i) {
+    u_(i) = matrix(i, pivot_col) / matrix(pivot_row, pivot_col);
+    v_(i) = matrix(pivot_row, i);
+  }
+
+  bool is_rank_one{true};
+
+  for (minitensor::Index i(0); i < n && is_rank_one == true; ++i) {
+    for (minitensor::Index j(0); j < n; ++j) {
+      if (std::abs(matrix(i, j) - u_(i) * v_(j)) > tol) {
+        is_rank_one = false;
+        break;
+      }
+    }
+  }
+
+  if (is_rank_one == true) {
+    structure_ = LatentStructure::RANK_ONE;
+    return;
+  }
+
+  // Group the slip systems that interact, e.g. those on a common slip plane,
+  // into the diagonal blocks of a symmetric permutation of the matrix.
+  std::vector<minitensor::Index> block_of(n, n);
+  minitensor::Index              num_blocks{0};
+  minitensor::Index              nnz{0};
+
+  for (minitensor::Index i(0); i < n; ++i) {
+    for (minitensor::Index j(0); j < n; ++j) {
+      if (std::abs(matrix(i, j)) > tol) ++nnz;
+    }
+  }
+
+  for (minitensor::Index seed(0); seed < n; ++seed) {
+    if (block_of[seed] != n) continue;
+
+    block_offsets_.push_back(block_indices_.size());
+    block_of[seed] = num_blocks;
+    block_indices_.push_back(seed);
+
+    for (minitensor::Index k = block_offsets_.back(); k < block_indices_.size(); ++k) {
+      minitensor::Index const i = block_indices_[k];
+
+      for (minitensor::Index j(0); j < n; ++j) {
+        if (block_of[j] != n) continue;
+        if (std::abs(matrix(i, j)) > tol || std::abs(matrix(j, i)) > tol) {
+          block_of[j] = num_blocks;
+          block_indices_.push_back(j);
+        }
+      }
+    }
+
+    ++num_blocks;
+  }
+
+  block_offsets_.push_back(block_indices_.size());
+
+  minitensor::Index block_cost{0};
+
+  for (minitensor::Index b(0); b < num_blocks; ++b) {
+    minitensor::Index const size = block_offsets_[b + 1] - block_offsets_[b];
+
+    block_cost += size * size;
+  }
+
+  // Indexed products cost roughly twice as much per entry as dense ones.
+  minitensor::Index const sparse_cost = 2 * nnz;
+  minitensor::Index const dense_cost  = n * n;
+
+  if (sparse_cost < dense_cost && sparse_cost < block_cost) {
+    structure_ = LatentStructure::SPARSE;
+
+    row_offsets_.reserve(n + 1);
+    column_indices_.reserve(nnz);
+    values_.reserve(nnz);
+
+    for (minitensor::Index i(0); i < n; ++i) {
+      row_offsets_.push_back(values_.size());
+      for (minitensor::Index j(0); j < n; ++j) {
+        if (std::abs(matrix(i, j)) > tol) {
+          column_indices_.push_back(j);
+          values_.push_back(matrix(i, j));
+        }
+      }
+    }
+    row_offsets_.push_back(values_.size());
+
+    block_indices_.clear();
+    block_offsets_.clear();
+  } else if (num_blocks > 1 && block_cost < dense_cost) {
+    structure_ = LatentStructure::BLOCK_DIAGONAL;
+
+    block_values_.reserve(block_cost);
+
+    for (minitensor::Index b(0); b < num_blocks; ++b) {
+      block_values_offsets_.push_back(block_values_.size());
+      for (minitensor::Index k = block_offsets_[b]; k < block_offsets_[b + 1]; ++k) {
+        for (minitensor::Index l = block_offsets_[b]; l < block_offsets_[b + 1]; ++l) {
+          block_values_.push_back(matrix(block_indices_[k], block_indices_[l]));
+        }
+      }
+    }
+  } else {
+    structure_ = LatentStructure::DENSE;
+    matrix_    = matrix;
+
+    block_indices_.clear();
+    block_offsets_.clear();
+  }
+}
+
+template <minitensor::Index NumSlipT>
+template <typename ArgT>
+minitensor::Vector<ArgT, NumSlipT>
+CP::LatentOperator<NumSlipT>::apply(minitensor::Vector<ArgT, NumSlipT> const& x) const
+{
+  minitensor::Index const n = dimension_;
+
+  ALBANY_EXPECT(x.get_dimension() == n);
+
+  minitensor::Vector<ArgT, NumSlipT> y(n, minitensor::Filler::ZEROS);
+
+  switch (structure_) {
+    default:
+    case LatentStructure::ZERO: break;
+
+    case LatentStructure::RANK_ONE: {
+      ArgT v_dot_x{0.0};
+      for (minitensor::Index j(0); j < n; ++j) {
+        v_dot_x += v_(j) * x(j);
+      }
+      for (minitensor::Index i(0); i < n; ++i) {
+        y(i) = u_(i) * v_dot_x;
+      }
+    } break;
+
+    case LatentStructure::BLOCK_DIAGONAL: {
+      minitensor::Index const num_blocks = block_values_offsets_.size();
+      for (minitensor::Index b(0); b < num_blocks; ++b) {
+        minitensor::Index const begin  = block_offsets_[b];
+        minitensor::Index const size   = block_offsets_[b + 1] - begin;
+        RealType const*         values = &block_values_[block_values_offsets_[b]];
+        for (minitensor::Index k(0); k < size; ++k) {
+          ArgT sum{0.0};
+          for (minitensor::Index l(0); l < size; ++l) {
+            sum += values[k * size + l] * x(block_indices_[begin + l]);
+          }
+          y(block_indices_[begin + k]) = sum;
+        }
+      }
+    } break;
+
+    case LatentStructure::SPARSE: {
+      for (minitensor::Index i(0); i < n; ++i) {
+        ArgT sum{0.0};
+        for (minitensor::Index k = row_offsets_[i]; k < row_offsets_[i + 1]; ++k) {
+          sum += values_[k] * x(column_indices_[k]);
+        }
+        y(i) = sum;
+      }
+    } break;
+
+    case LatentStructure::DENSE: y = matrix_ * x; break;
+  }
+
+  return y;
+}
+
+template <minitensor::Index NumSlipT>
+std::string
+CP::LatentOperator<NumSlipT>::getStructureName() const
+{
+  switch (structure_) {
+    case LatentStructure::ZERO: return "zero";
+    case LatentStructure::RANK_ONE: return "rank one";
+    case LatentStructure::BLOCK_DIAGONAL: return "block diagonal";
+    case LatentStructure::SPARSE: return "sparse";
+    case LatentStructure::DENSE: return "dense";
+  }
+  return "undefined";
+}
+
 // Verify that constitutive update has preserved finite values
 template <typename T, minitensor::Index N>
 void
@@ -53,6 +53,16 @@ enum class PredictorSlip
   SOLVE     = 3
 };
 
+//! Structure of a latent hardening interaction matrix.
+enum class LatentStructure
+{
+  ZERO           = 0,
+  RANK_ONE       = 1,
+  BLOCK_DIAGONAL = 2,
+  SPARSE         = 3,
+  DENSE          = 4
+};
+
 enum class Verbosity
 {
   UNDEFINED = 0,
@@ -72,6 +82,9 @@ struct HardeningParameterBase;
 template <minitensor::Index NumDimT>
 struct SlipSystem;
 
+template <minitensor::Index NumSlipT>
+class LatentOperator;
+
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 struct SlipFamily;
 }  // namespace CP
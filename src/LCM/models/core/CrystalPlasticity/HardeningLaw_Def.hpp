@@ -94,7 +94,7 @@ CP::LinearMinusRecoveryHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
     rate_slip_abs[ss_index] = std::fabs(rate_slip[ss_index_global]);
   }
 
-  minitensor::Vector<ArgT, NumSlipT> const driver_hardening = slip_family.latent_matrix_ * rate_slip_abs;
+  minitensor::Vector<ArgT, NumSlipT> const driver_hardening = slip_family.latent_operator_.apply(rate_slip_abs);
 
   auto const& phardening_params = slip_family.phardening_parameters_;
 
@@ -181,7 +181,7 @@ CP::SaturationHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
     rate_slip_abs(ss_index) = std::fabs(slip_rate);
   }
 
-  minitensor::Vector<ArgT, NumSlipT> const driver_hardening = 2.0 * slip_family.latent_matrix_ * rate_slip_abs;
+  minitensor::Vector<ArgT, NumSlipT> const driver_hardening = 2.0 * slip_family.latent_operator_.apply(rate_slip_abs);
 
   ArgT effective_slip_rate{minitensor::norm_1(rate_slip_abs)};
 
@@ -328,7 +328,7 @@ CP::DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
     std::cout << "Warning: Dislocation density at np1 is negative" << std::endl;
   }
 
-  minitensor::Vector<ArgT, NumSlipT> densities_forest = slip_family.latent_matrix_ * state_hardening_np1;
+  minitensor::Vector<ArgT, NumSlipT> densities_forest = slip_family.latent_operator_.apply(state_hardening_np1);
 
   // Update dislocation densities
   auto const phardening_params = slip_family.phardening_parameters_;
@@ -370,7 +370,7 @@ CP::DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
     state_hardening_np1[ss_index_global] = state_hardening_n[ss_index_global] + dt * driver_hardening * std::abs(rate_slip[ss_index_global]);
   }
 
-  minitensor::Vector<ArgT, NumSlipT> const densities_parallel = slip_family.aux_matrix_ * state_hardening_np1;
+  minitensor::Vector<ArgT, NumSlipT> const densities_parallel = slip_family.aux_operator_.apply(state_hardening_np1);
 
   for (minitensor::Index ss_index(0); ss_index < num_slip_sys; ++ss_index) {
     auto const ss_index_global = slip_family.slip_system_indices_[ss_index];
@@ -14,14 +14,14 @@
 #include "CrystalPlasticityFwd.hpp"
 
 namespace CP {
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT = CP::MAX_SLIP>
 class ParameterReader
 {
  public:
   using ScalarT      = typename EvalT::ScalarT;
   using ValueT       = typename Sacado::ValueType<ScalarT>::type;
-  using Minimizer    = minitensor::Minimizer<ValueT, CP::NLS_DIM>;
-  using RolMinimizer = ROL::MiniTensor_Minimizer<ValueT, CP::NLS_DIM>;
+  using Minimizer    = minitensor::Minimizer<ValueT, CP::NlsDim<NumSlipT>::value>;
+  using RolMinimizer = ROL::MiniTensor_Minimizer<ValueT, CP::NlsDim<NumSlipT>::value>;
 
   ParameterReader(Teuchos::ParameterList* p);
 
@@ -43,7 +43,7 @@ class ParameterReader
   RolMinimizer
   getRolMinimizer() const;
 
-  SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>
+  SlipFamily<CP::MAX_DIM, NumSlipT>
   getSlipFamily(int index);
 
   Verbosity
@@ -4,14 +4,14 @@
 
 #include <map>
 
-template <typename EvalT, typename Traits>
-CP::ParameterReader<EvalT, Traits>::ParameterReader(Teuchos::ParameterList* p) : p_(p)
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+CP::ParameterReader<EvalT, Traits, NumSlipT>::ParameterReader(Teuchos::ParameterList* p) : p_(p)
 {
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 CP::Verbosity
-CP::ParameterReader<EvalT, Traits>::getVerbosity() const
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getVerbosity() const
 {
   static utility::ParameterEnum<CP::Verbosity> const vmap(
       "Verbosity",
@@ -26,9 +26,9 @@ CP::ParameterReader<EvalT, Traits>::getVerbosity() const
   return vmap.get(p_);
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 CP::IntegrationScheme
-CP::ParameterReader<EvalT, Traits>::getIntegrationScheme() const
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getIntegrationScheme() const
 {
   static utility::ParameterEnum<CP::IntegrationScheme> const imap(
       "Integration Scheme", CP::IntegrationScheme::EXPLICIT, {{"Implicit", CP::IntegrationScheme::IMPLICIT}, {"Explicit", CP::IntegrationScheme::EXPLICIT}});
@@ -36,9 +36,9 @@ CP::ParameterReader<EvalT, Traits>::getIntegrationScheme() const
   return imap.get(p_);
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 CP::ResidualType
-CP::ParameterReader<EvalT, Traits>::getResidualType() const
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getResidualType() const
 {
   static utility::ParameterEnum<CP::ResidualType> const rmap(
       "Residual Type",
@@ -50,9 +50,9 @@ CP::ParameterReader<EvalT, Traits>::getResidualType() const
   return rmap.get(p_);
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 CP::PredictorSlip
-CP::ParameterReader<EvalT, Traits>::getPredictorSlip() const
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getPredictorSlip() const
 {
   static utility::ParameterEnum<CP::PredictorSlip> const pmap(
       "Slip Predictor", CP::PredictorSlip::RATE, {{"None", CP::PredictorSlip::NONE}, {"Rate", CP::PredictorSlip::RATE}, {"Solve", CP::PredictorSlip::SOLVE}});
@@ -60,9 +60,9 @@ CP::ParameterReader<EvalT, Traits>::getPredictorSlip() const
   return pmap.get(p_);
 }
 
-template <typename EvalT, typename Traits>
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
 minitensor::StepType
-CP::ParameterReader<EvalT, Traits>::getStepType() const
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getStepType() const
 {
   static utility::ParameterEnum<minitensor::StepType> const smap(
       "Nonlinear Solver Step Type",
@@ -76,9 +76,9 @@ CP::ParameterReader<EvalT, Traits>::getStepType() const
   return smap.get(p_);
 }
 
-template <typename EvalT, typename Traits>
-typename CP::ParameterReader<EvalT, Traits>::Minimizer
-CP::ParameterReader<EvalT, Traits>::getMinimizer() const
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+typename CP::ParameterReader<EvalT, Traits, NumSlipT>::Minimizer
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getMinimizer() const
 {
   // TODO: This code works differently from the previous. Is this preferable?
   Minimizer min;
@@ -95,20 +95,20 @@ CP::ParameterReader<EvalT, Traits>::getMinimizer() const
   return min;
 }
 
-template <typename EvalT, typename Traits>
-typename CP::ParameterReader<EvalT, Traits>::RolMinimizer
-CP::ParameterReader<EvalT, Traits>::getRolMinimizer() const
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+typename CP::ParameterReader<EvalT, Traits, NumSlipT>::RolMinimizer
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getRolMinimizer() const
 {
   RolMinimizer min;
 
   return min;
 }
 
-template <typename EvalT, typename Traits>
-CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>
-CP::ParameterReader<EvalT, Traits>::getSlipFamily(int index)
+template <typename EvalT, typename Traits, minitensor::Index NumSlipT>
+CP::SlipFamily<CP::MAX_DIM, NumSlipT>
+CP::ParameterReader<EvalT, Traits, NumSlipT>::getSlipFamily(int index)
 {
-  SlipFamily<MAX_DIM, MAX_SLIP> slip_family;
+  SlipFamily<MAX_DIM, NumSlipT> slip_family;
 
   auto family_plist = p_->sublist(Albany::strint("Slip System Family", index));
 
@@ -1821,6 +1821,10 @@ MechanicsProblem::constructEvaluators(
       p->set<Teuchos::ParameterList*>("Tritium Parameters", &tritium_param);
       p->set<Teuchos::ParameterList*>("Molar Volume", &molar_param);
 
+      // Substep failures request a global load step reduction
+      p->set<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>(
+          "NOX Status Test", Teuchos::rcp_dynamic_cast<NOX::StatusTest::ModelEvaluatorFlag>(nox_status_test_));
+
       // Input
       p->set<std::string>("Total Concentration Name", totalConcentration);
       p->set<std::string>("Delta Time Name", "Delta Time");
@@ -4,11 +4,17 @@
 #include "Schwarz_BoundaryJacobian.hpp"
 
 #include <Teuchos_ParameterListExceptions.hpp>
+#include <Thyra_MultiVectorStdOps.hpp>
 
+#include <set>
+
+#include "Albany_BCUtils.hpp"
 #include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_STKDiscretization.hpp"
+#include "Albany_ThyraUtils.hpp"
 #include "Albany_Utils.hpp"
+#include "SchwarzBC.hpp"
 
 namespace LCM {
 
@@ -30,23 +36,105 @@ Schwarz_BoundaryJacobian::Schwarz_BoundaryJacobian(
 void
 Schwarz_BoundaryJacobian::initialize()
 {
-  return;
+  Albany::Application const& this_app = getApplication(this_app_index_);
+
+  if (this_app_index_ == coupled_app_index_ || this_app.isCoupled(coupled_app_index_) == false) return;
+
+  std::string const& nodeset_name = this_app.getNodesetName(coupled_app_index_);
+
+  // Only the Schwarz BC couples the residual to the coupled application.
+  // The strong Schwarz BC prescribes the solution and leaves a zero residual.
+  Teuchos::RCP<Teuchos::ParameterList const> const problem_params = this_app.getProblemPL();
+  if (problem_params->isSublist("Dirichlet BCs") == false) return;
+  Teuchos::ParameterList const& dbc_params = problem_params->sublist("Dirichlet BCs");
+  if (dbc_params.isSublist(Albany::DirichletTraits::constructBCName(nodeset_name, "Schwarz")) == false) return;
+
+  Albany::Application const& coupled_app = getApplication(coupled_app_index_);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> this_disc    = this_app.getDiscretization();
+  Teuchos::RCP<Albany::AbstractDiscretization> coupled_disc = coupled_app.getDiscretization();
+
+  auto* coupled_stk_disc = static_cast<Albany::STKDiscretization*>(coupled_disc.get());
+
+  auto const num_dims = coupled_stk_disc->getNumDim();
+
+  Albany::NodeSetList const& ns_dofs = this_disc->getNodeSets();
+
+  // DOFs that other Dirichlet conditions prescribe take precedence over the
+  // Schwarz BC, so their rows are not coupled.
+  char const* const dof_names[] = {"X", "Y", "Z"};
+
+  std::set<LO> fixed_dofs;
+
+  for (auto const& ns : ns_dofs) {
+    for (int eq = 0; eq < num_dims; ++eq) {
+      bool const is_dbc  = dbc_params.isParameter(Albany::DirichletTraits::constructBCName(ns.first, dof_names[eq]));
+      bool const is_sdbc = dbc_params.isParameter(Albany::DirichletTraits::constructSDBCName(ns.first, dof_names[eq]));
+      if (is_dbc == false && is_sdbc == false) continue;
+      for (auto const& node_dofs : ns.second) fixed_dofs.insert(node_dofs[eq]);
+    }
+  }
+
+  Teuchos::RCP<Thyra_VectorSpace const> const coupled_overlap_vs = coupled_disc->getOverlapVectorSpace();
+
+  auto coupled_ov_indexer = Albany::createGlobalLocalIndexer(coupled_overlap_vs);
+
+  std::vector<std::vector<int>> const& ns_nodes = ns_dofs.find(nodeset_name)->second;
+
+  row_offsets_.assign(1, 0);
+
+  for (std::size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
+    SchwarzInterpolation const interpolation = findSchwarzInterpolation(this_app, coupled_app_index_, ns_node);
+
+    for (int eq = 0; eq < num_dims; ++eq) {
+      LO const row = ns_nodes[ns_node][eq];
+
+      if (fixed_dofs.find(row) != fixed_dofs.end()) continue;
+
+      rows_.push_back(row);
+
+      for (std::size_t node = 0; node < interpolation.node_gids.size(); ++node) {
+        GO const col_gid = coupled_stk_disc->getGlobalDOF(interpolation.node_gids[node], eq);
+        cols_.push_back(coupled_ov_indexer->getLocalElement(col_gid));
+        col_gids_.push_back(col_gid);
+        values_.push_back(-interpolation.basis_values[node]);
+      }
+      row_offsets_.push_back(cols_.size());
+    }
+  }
+
+  // IKT, note to self: cas_manager arguments are (owned, overlapped)
+  cas_manager_ = Albany::createCombineAndScatterManager(domain_vs_, coupled_overlap_vs);
+  is_coupled_  = true;
 }
 
 // Returns explicit matrix representation of operator if available.
 Teuchos::RCP<Thyra_LinearOp>
 Schwarz_BoundaryJacobian::getExplicitOperator() const
 {
-  auto const max_num_cols = Albany::getLocalSubdim(this->domain());
+  Teuchos::RCP<Albany::ThyraCrsMatrixFactory> jac_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(this->domain(), this->range()));
+
+  auto range_indexer = Albany::createGlobalLocalIndexer(this->range());
 
-  // IKT: there may be problems here in creating jac_factory - will need to
-  // check
-  Teuchos::RCP<Albany::ThyraCrsMatrixFactory> jac_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(this->range(), this->domain(), max_num_cols));
+  for (std::size_t r = 0; r < rows_.size(); ++r) {
+    auto const cols = Teuchos::arrayView(col_gids_.data() + row_offsets_[r], row_offsets_[r + 1] - row_offsets_[r]);
+    jac_factory->insertGlobalIndices(range_indexer->getGlobalElement(rows_[r]), cols);
+  }
 
   jac_factory->fillComplete();
 
   Teuchos::RCP<Thyra_LinearOp> K = jac_factory->createOp();
 
+  Albany::resumeFill(K);
+  for (std::size_t r = 0; r < rows_.size(); ++r) {
+    auto const         num_cols = row_offsets_[r + 1] - row_offsets_[r];
+    auto const         cols     = Teuchos::arrayView(col_gids_.data() + row_offsets_[r], num_cols);
+    Teuchos::Array<ST> vals(num_cols);
+    for (std::size_t k = 0; k < num_cols; ++k) vals[k] = j_coeff_ * values_[row_offsets_[r] + k];
+    Albany::addToGlobalRowValues(K, range_indexer->getGlobalElement(rows_[r]), cols, vals());
+  }
+  Albany::fillComplete(K);
+
   return K;
 }
 
@@ -54,15 +142,58 @@ Schwarz_BoundaryJacobian::getExplicitOperator() const
 // Thyra_MultiVector X in Y.
 void
 Schwarz_BoundaryJacobian::applyImpl(
-    const Thyra::EOpTransp /* M_trans */,
-    const Thyra_MultiVector& /* X */,
+    const Thyra::EOpTransp                 M_trans,
+    const Thyra_MultiVector&               X,
     const Teuchos::Ptr<Thyra_MultiVector>& Y,
-    const ST /* alpha */,
-    const ST /* beta */) const
+    const ST                               alpha,
+    const ST                               beta) const
 {
   auto const zero = Teuchos::ScalarTraits<ST>::zero();
 
-  Y->assign(zero);
+  if (beta == zero) {
+    Y->assign(zero);
+  } else {
+    Thyra::scale(beta, Y);
+  }
+
+  if (is_coupled_ == false) return;
+
+  int const  num_vecs  = X.domain()->dim();
+  ST const   scale     = alpha * j_coeff_;
+  bool const transpose = M_trans == Thyra::TRANS || M_trans == Thyra::CONJTRANS;
+
+  Teuchos::RCP<Thyra_MultiVector> ovl = Thyra::createMembers(cas_manager_->getOverlappedVectorSpace(), num_vecs);
+
+  if (transpose == false) {
+    // Y += alpha B X, with X gathered onto the coupled overlapped DOFs.
+    cas_manager_->scatter(X, *ovl, Albany::CombineMode::INSERT);
+    auto const x_view = Albany::getLocalData(*ovl);
+    auto       y_view = Albany::getNonconstLocalData(*Y);
+    for (int v = 0; v < num_vecs; ++v) {
+      for (std::size_t r = 0; r < rows_.size(); ++r) {
+        ST sum = zero;
+        for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) sum += values_[k] * x_view[v][cols_[k]];
+        y_view[v][rows_[r]] += scale * sum;
+      }
+    }
+  } else {
+    // Y += alpha B^T X, summed onto the coupled overlapped DOFs first.
+    ovl->assign(zero);
+    {
+      auto const x_view   = Albany::getLocalData(X);
+      auto       ovl_view = Albany::getNonconstLocalData(*ovl);
+      for (int v = 0; v < num_vecs; ++v) {
+        for (std::size_t r = 0; r < rows_.size(); ++r) {
+          ST const x_r = scale * x_view[v][rows_[r]];
+          for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) ovl_view[v][cols_[k]] += values_[k] * x_r;
+        }
+      }
+    }
+    Teuchos::RCP<Thyra_MultiVector> owned = Thyra::createMembers(Y->range(), num_vecs);
+    owned->assign(zero);
+    cas_manager_->combine(*ovl, *owned, Albany::CombineMode::ADD);
+    Thyra::update(Teuchos::ScalarTraits<ST>::one(), *owned, Y);
+  }
 }
 
 }  // namespace LCM
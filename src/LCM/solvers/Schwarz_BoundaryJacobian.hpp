@@ -6,8 +6,10 @@
 #define LCM_SchwarzBoundaryJacobian_hpp
 
 #include <iostream>
+#include <vector>
 
 #include "Albany_Application.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_DataTypes.hpp"
 #include "MiniTensor.h"
 #include "Teuchos_Comm.hpp"
@@ -20,6 +22,11 @@ namespace LCM {
 /// LCM coupled Schwarz Multiscale problem.
 /// Each Jacobian couples one single application to another.
 ///
+/// It is the derivative of the Schwarz BC residual x - sum_k N_k x^c_k of
+/// this application with respect to the solution x^c of the coupled
+/// application, i.e., minus the interpolation of the coupled solution at the
+/// Schwarz boundary nodes, scaled by the coefficient of df/dx of the fill.
+///
 
 class Schwarz_BoundaryJacobian : public Thyra_LinearOp
 {
@@ -34,10 +41,16 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   ~Schwarz_BoundaryJacobian() = default;
 
   /// Initialize the operator with everything needed to apply it
-  // FIXME: add arguments
   void
   initialize();
 
+  /// Set the coefficient of df/dx of the current Jacobian fill
+  void
+  setJacobianCoefficient(ST const j_coeff)
+  {
+    j_coeff_ = j_coeff;
+  }
+
   //! Overrides Thyra::LinearOpBase purely virtual method
   /// Returns the result of a Thyra_LinearOp applied to a
   /// Thyra_MultiVector X in Y.
@@ -130,6 +143,22 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   Teuchos::RCP<Teuchos_Comm const> comm_;
 
   int n_models_;
+
+  // Same on all ranks; false if the rows of this application do not depend
+  // on the coupled application.
+  bool is_coupled_{false};
+
+  // Interpolation in CSR form. Rows are local DOFs of range(), columns are
+  // local DOFs of the overlapped vector space of the coupled application.
+  std::vector<LO>          rows_;
+  std::vector<std::size_t> row_offsets_;
+  std::vector<LO>          cols_;
+  std::vector<GO>          col_gids_;
+  std::vector<ST>          values_;
+
+  Teuchos::RCP<const Albany::CombineAndScatterManager> cas_manager_;
+
+  ST j_coeff_{1.0};
 };
 
 }  // namespace LCM
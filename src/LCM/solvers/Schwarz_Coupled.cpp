@@ -629,7 +629,7 @@ SchwarzCoupled::create_W_prec() const
   for (auto m = 0; m < num_models_; m++) {
     if (Albany::isFillActive(precs_[m])) Albany::fillComplete(precs_[m]);
   }
-  Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op = jac.getThyraCoupledJacobian(precs_, apps_);
+  Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op = jac.getThyraCoupledJacobian(precs_, apps_, false);
   W_prec->initializeRight(W_op);
 
   return W_prec;
@@ -839,9 +839,9 @@ SchwarzCoupled::evalModelImpl(Thyra::ModelEvaluatorBase::InArgs<ST> const& in_ar
       apps_[m]->computeGlobalJacobian(alpha, beta, omega, curr_time, xs[m], x_dots[m], x_dotdot, sacado_param_vecs_[m], fs_out[m], jacs_[m]);
       fs_already_computed[m] = true;
     }
-    // FIXME: create coupled W matrix from array of model W matrices
-    Schwarz_CoupledJacobian jac(comm_);
-    W_op_out = jac.getThyraCoupledJacobian(jacs_, apps_);
+    // The coupled W operator refers to jacs_, which have just been filled.
+    // Only the coupling blocks need the coefficient of this fill.
+    Schwarz_CoupledJacobian::setJacobianCoefficient(W_op_out, beta);
   }
 
   for (auto m = 0; m < num_models_; ++m) {
@@ -938,7 +938,7 @@ SchwarzCoupled::evalModelImpl(Thyra::ModelEvaluatorBase::InArgs<ST> const& in_ar
         }
       }
       Schwarz_CoupledJacobian                        jac(comm_);
-      Teuchos::RCP<Thyra_LinearOp>                   W_op   = jac.getThyraCoupledJacobian(precs_, apps_);
+      Teuchos::RCP<Thyra_LinearOp>                   W_op   = jac.getThyraCoupledJacobian(precs_, apps_, false);
       Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec = Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
       W_prec->initializeRight(W_op);
       W_prec_out = W_prec;
@@ -960,6 +960,9 @@ SchwarzCoupled::evalModelImpl(Thyra::ModelEvaluatorBase::InArgs<ST> const& in_ar
       }
     }
   }
+
+  // The solutions may change in place before the next evaluation
+  for (auto m = 0; m < num_models_; ++m) apps_[m]->invalidateFusedResponses();
 }
 
 Thyra::ModelEvaluatorBase::InArgs<ST>
@@ -18,15 +18,13 @@ Schwarz_CoupledJacobian::Schwarz_CoupledJacobian(Teuchos::RCP<Teuchos_Comm const
 
 Schwarz_CoupledJacobian::~Schwarz_CoupledJacobian() { return; }
 
-// #define USE_OFF_DIAGONAL
-// #define EXPLICIT_OFF_DIAGONAL
-
 // getThyraCoupledJacobian method is similar to getThyraMatrix in panzer
 //(Panzer_BlockedTpetraLinearObjFactory_impl.hpp).
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Schwarz_CoupledJacobian::getThyraCoupledJacobian(
     Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>                jacs,
-    Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca) const
+    Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca,
+    bool const                                                  with_coupling) const
 {
   auto const block_dim = jacs.size();
 
@@ -42,26 +40,14 @@ Schwarz_CoupledJacobian::getThyraCoupledJacobian(
       // build (i,j) block matrix and add it to blocked operator
       if (i == j) {  // Diagonal blocks
         blocked_op->setNonconstBlock(i, j, jacs[i]);
-      } else {  // Off-diagonal blocks
-#if defined(USE_OFF_DIAGONAL)
-#if defined(EXPLICIT_OFF_DIAGONAL)
-
+      } else if (with_coupling == true && ca[i]->isCoupled(j) == true) {  // Off-diagonal blocks
         Teuchos::RCP<Schwarz_BoundaryJacobian> jac_boundary = Teuchos::rcp(new Schwarz_BoundaryJacobian(comm_, ca, jacs, i, j));
 
-        Teuchos::RCP<Thyra_LinearOp> exp_jac = jac_boundary->getExplicitOperator();
-
-        Teuchos::RCP<Thyra::LinearOpBase<ST>> block = exp_jac;
-
-#else
-
-        Teuchos::RCP<Thyra_LinearOp> jac_boundary = Teuchos::rcp(new Schwarz_BoundaryJacobian(comm_, ca, jacs, i, j));
+        jac_boundary->initialize();
 
         Teuchos::RCP<Thyra::LinearOpBase<ST>> block = jac_boundary;
 
-#endif  // EXPLICIT_OFF_DIAGONAL
-
         blocked_op->setNonconstBlock(i, j, block);
-#endif  // USE_OFF_DIAGONAL
       }
     }
   }
@@ -71,4 +57,20 @@ Schwarz_CoupledJacobian::getThyraCoupledJacobian(
   return blocked_op;
 }
 
+void
+Schwarz_CoupledJacobian::setJacobianCoefficient(Teuchos::RCP<Thyra_LinearOp> const& coupled_jac, ST const j_coeff)
+{
+  Teuchos::RCP<Thyra::BlockedLinearOpBase<ST>> blocked_op = Teuchos::rcp_dynamic_cast<Thyra::BlockedLinearOpBase<ST>>(coupled_jac, true);
+
+  auto const block_dim = blocked_op->productRange()->numBlocks();
+
+  for (auto i = 0; i < block_dim; i++) {
+    for (auto j = 0; j < block_dim; j++) {
+      if (i == j || blocked_op->blockExists(i, j) == false) continue;
+      Teuchos::RCP<Schwarz_BoundaryJacobian> jac_boundary = Teuchos::rcp_dynamic_cast<Schwarz_BoundaryJacobian>(blocked_op->getNonconstBlock(i, j), true);
+      jac_boundary->setJacobianCoefficient(j_coeff);
+    }
+  }
+}
+
 }  // namespace LCM
@@ -25,8 +25,20 @@ class Schwarz_CoupledJacobian
 
   ~Schwarz_CoupledJacobian();
 
+  /// Blocked operator with the Jacobians of the applications on the
+  /// diagonal. If with_coupling is true, the off-diagonal blocks are the
+  /// derivatives of the Schwarz BC residuals with respect to the solutions of
+  /// the coupled applications, otherwise they are zero.
   Teuchos::RCP<Thyra::LinearOpBase<ST>>
-  getThyraCoupledJacobian(Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>> jacs, Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca) const;
+  getThyraCoupledJacobian(
+      Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>                jacs,
+      Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca,
+      bool const                                                  with_coupling = true) const;
+
+  /// Set the coefficient of df/dx of the current fill in the off-diagonal
+  /// blocks of an operator built by getThyraCoupledJacobian.
+  static void
+  setJacobianCoefficient(Teuchos::RCP<Thyra_LinearOp> const& coupled_jac, ST const j_coeff);
 
  private:
   Teuchos::RCP<Teuchos_Comm const> comm_;
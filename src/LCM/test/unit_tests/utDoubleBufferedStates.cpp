@@ -0,0 +1,221 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <vector>
+
+#include "Albany_Layouts.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_StateManager.hpp"
+#include "Albany_TmplSTKMeshStruct.hpp"
+#include "Albany_Utils.hpp"
+#include "Albany_config.h"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+std::string const element_block_name = "Block0";
+
+std::string const state_name = "Equivalent Plastic Strain";
+
+std::string const state_name_old = state_name + "_old";
+
+// One hexahedron with one quadrature point. Without Exodus output
+// updateStates is free to swap the current and old slots; with it, only when
+// the next write is not an output step.
+RCP<Albany::AbstractDiscretization>
+createDiscretization(Albany::StateManager& state_mgr, bool const copy_old_state, bool const exodus_output = false)
+{
+  RCP<Teuchos_Comm const> comm = Albany::createTeuchosCommFromMpiComm(MPI_COMM_WORLD);
+
+  int const                  workset_size = 1;
+  int const                  num_pts      = 1;
+  int const                  num_dims     = 3;
+  int const                  num_vertices = 8;
+  int const                  num_nodes    = 8;
+  const RCP<Albany::Layouts> dl           = rcp(new Albany::Layouts(workset_size, num_vertices, num_nodes, num_pts, num_dims));
+
+  state_mgr.setDoubleBufferedStates(true);
+  state_mgr.registerStateVariable(
+      state_name,
+      dl->qp_scalar,
+      element_block_name,
+      "scalar",
+      0.0,
+      true,    // old state
+      false);  // output
+  if (copy_old_state == true) state_mgr.requireOldStateCopy(state_name);
+
+  RCP<Teuchos::ParameterList> disc_params = rcp(new Teuchos::ParameterList("Discretization"));
+  disc_params->set<int>("1D Elements", workset_size);
+  disc_params->set<int>("2D Elements", 1);
+  disc_params->set<int>("3D Elements", 1);
+  disc_params->set<std::string>("Method", "STK3D");
+  disc_params->set<int>("Number Of Time Derivatives", 0);
+  if (exodus_output == true) {
+    disc_params->set<std::string>("Exodus Output File Name", "utDoubleBufferedStates.exo");
+    disc_params->set<int>("Exodus Write Interval", 2);
+  }
+
+  int const                                                  num_eqs = 3;
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+
+  RCP<Albany::AbstractSTKMeshStruct> stk_mesh_struct = rcp(new Albany::TmplSTKMeshStruct<3>(disc_params, Teuchos::null, comm));
+  stk_mesh_struct->setFieldAndBulkData(comm, disc_params, num_eqs, req, state_mgr.getStateInfoStruct(), stk_mesh_struct->getMeshSpecs()[0]->worksetSize);
+
+  RCP<Albany::AbstractDiscretization> disc     = rcp(new Albany::STKDiscretization(disc_params, stk_mesh_struct, comm));
+  auto&                               stk_disc = static_cast<Albany::STKDiscretization&>(*disc);
+  stk_disc.updateMesh();
+
+  state_mgr.setupStateArrays(disc);
+  return disc;
+}
+
+TEUCHOS_UNIT_TEST(DoubleBufferedStates, SwapReadsOld)
+{
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  Albany::StateManager                state_mgr;
+  RCP<Albany::AbstractDiscretization> disc = createDiscretization(state_mgr, false);
+
+  Albany::StateArray& sa = state_mgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  double* const named_data = sa[state_name].contiguous_data();
+  double* const old_data   = sa[state_name_old].contiguous_data();
+
+  // Evaluators write the current slot and read the old one through the
+  // state array; after each update the old slot must hold the last write.
+  for (int step = 1; step <= 3; ++step) {
+    double const value = 1.0 * step;
+
+    sa[state_name](0, 0) = value;
+    state_mgr.updateStates();
+
+    TEST_EQUALITY(sa[state_name_old](0, 0), value);
+
+    // An odd number of updates leaves the slots swapped.
+    double* const expected_old = step % 2 == 1 ? named_data : old_data;
+    TEST_EQUALITY(sa[state_name_old].contiguous_data(), expected_old);
+
+    // The handle-indexed arrays follow the swap.
+    Albany::StateHandle const handle_old = state_mgr.getStateHandle(state_name_old);
+    TEST_EQUALITY(state_mgr.getStateHandleArray(0)[handle_old].contiguous_data(), expected_old);
+  }
+
+  // Resolving puts the arrays back into the mesh fields named after the
+  // states, without changing the values the evaluators see.
+  state_mgr.resolveStateSlots();
+
+  TEST_EQUALITY(sa[state_name].contiguous_data(), named_data);
+  TEST_EQUALITY(sa[state_name_old].contiguous_data(), old_data);
+  TEST_EQUALITY(sa[state_name](0, 0), 3.0);
+  TEST_EQUALITY(sa[state_name_old](0, 0), 3.0);
+
+  // And the next update starts from the canonical storage again.
+  sa[state_name](0, 0) = 4.0;
+  state_mgr.updateStates();
+  TEST_EQUALITY(sa[state_name_old](0, 0), 4.0);
+  TEST_EQUALITY(sa[state_name_old].contiguous_data(), named_data);
+}
+
+TEUCHOS_UNIT_TEST(DoubleBufferedStates, RequiredCopy)
+{
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  Albany::StateManager                state_mgr;
+  RCP<Albany::AbstractDiscretization> disc = createDiscretization(state_mgr, true);
+
+  Albany::StateArray& sa = state_mgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  double* const named_data = sa[state_name].contiguous_data();
+
+  // A state that requires a copy keeps its storage and its current value.
+  for (int step = 1; step <= 2; ++step) {
+    double const value = 1.0 * step;
+
+    sa[state_name](0, 0) = value;
+    state_mgr.updateStates();
+
+    TEST_EQUALITY(sa[state_name_old](0, 0), value);
+    TEST_EQUALITY(sa[state_name](0, 0), value);
+    TEST_EQUALITY(sa[state_name].contiguous_data(), named_data);
+  }
+}
+
+TEUCHOS_UNIT_TEST(DoubleBufferedStates, SetStateArrays)
+{
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  Albany::StateManager                state_mgr;
+  RCP<Albany::AbstractDiscretization> disc = createDiscretization(state_mgr, false);
+
+  // Replace the old slot with new storage.
+  Albany::StateArrays replacement = state_mgr.getStateArrays();
+  Albany::MDArray&    old_array   = replacement.elemStateArrays[0][state_name_old];
+  std::vector<double> storage(old_array.size(), 7.0);
+  old_array = Albany::MDArray(storage.data(), old_array.dimension(0), old_array.dimension(1));
+  state_mgr.setStateArrays(replacement);
+
+  // The handle-indexed arrays see the new storage.
+  Albany::StateHandle const handle_old = state_mgr.getStateHandle(state_name_old);
+  TEST_EQUALITY(state_mgr.getStateHandleArray(0)[handle_old].contiguous_data(), storage.data());
+  TEST_EQUALITY(state_mgr.getStateHandleArray(0)[handle_old](0, 0), 7.0);
+}
+
+TEUCHOS_UNIT_TEST(DoubleBufferedStates, ReadAfterWrite)
+{
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  Albany::StateManager                state_mgr;
+  RCP<Albany::AbstractDiscretization> disc     = createDiscretization(state_mgr, false, true);
+  auto&                               stk_disc = static_cast<Albany::STKDiscretization&>(*disc);
+
+  // Writes with an even count are output steps.
+  stk_disc.outputExodusSolutionInitialTime(false);
+  stk_disc.setOutputInterval(1);
+
+  Albany::StateArray& sa = state_mgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  double* const named_data = sa[state_name].contiguous_data();
+  double* const old_data   = sa[state_name_old].contiguous_data();
+
+  RCP<Thyra_Vector> x = Thyra::createMember(disc->getVectorSpace());
+  x->assign(0.0);
+
+  // Not followed by an output step, so the slots are swapped.
+  sa[state_name](0, 0) = 1.0;
+  state_mgr.updateStates();
+  TEST_EQUALITY(sa[state_name_old].contiguous_data(), named_data);
+
+  disc->writeSolution(*x, 1.0);
+
+  // An output step without an update in between, as when iterates are
+  // written, after the evaluators have written the current slot.
+  sa[state_name](0, 0) = 5.0;
+  disc->writeSolution(*x, 1.5);
+
+  // The mesh fields hold the accepted values under their own names and the
+  // old value seen by the evaluators is unchanged.
+  TEST_EQUALITY(sa[state_name].contiguous_data(), named_data);
+  TEST_EQUALITY(sa[state_name_old].contiguous_data(), old_data);
+  TEST_EQUALITY(sa[state_name](0, 0), 1.0);
+  TEST_EQUALITY(sa[state_name_old](0, 0), 1.0);
+
+  Albany::StateHandle const handle_old = state_mgr.getStateHandle(state_name_old);
+  TEST_EQUALITY(state_mgr.getStateHandleArray(0)[handle_old](0, 0), 1.0);
+
+  // The next step reads the last accepted value.
+  sa[state_name](0, 0) = 2.0;
+  state_mgr.updateStates();
+  TEST_EQUALITY(sa[state_name_old](0, 0), 2.0);
+
+  disc->writeSolution(*x, 2.0);
+  TEST_EQUALITY(sa[state_name_old](0, 0), 2.0);
+}
+
+}  // namespace
@@ -0,0 +1,234 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Albany_config.h"
+#include "MiniTensor.h"
+#include "PHAL_AlbanyTraits.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "core/CrystalPlasticity/CrystalPlasticityCore.hpp"
+
+namespace {
+
+using Matrix = minitensor::Tensor<RealType, CP::MAX_SLIP>;
+
+minitensor::Index const num_slip = 12;
+
+RealType const tolerance = 1.0e-12;
+
+// The 12 {111}<110> systems of an FCC crystal.
+std::vector<CP::SlipSystem<CP::MAX_DIM>>
+createFCCSlipSystems()
+{
+  RealType const normals[4][3] = {{1, 1, 1}, {-1, 1, 1}, {1, -1, 1}, {1, 1, -1}};
+
+  RealType const directions[12][3] = {
+      {0, 1, -1}, {1, 0, -1}, {1, -1, 0}, {0, 1, -1}, {1, 0, 1}, {1, 1, 0}, {0, 1, 1}, {1, 0, -1}, {1, 1, 0}, {0, 1, 1}, {1, 0, 1}, {1, -1, 0}};
+
+  std::vector<CP::SlipSystem<CP::MAX_DIM>> slip_systems(num_slip);
+
+  for (minitensor::Index i(0); i < num_slip; ++i) {
+    auto& slip_system = slip_systems[i];
+
+    slip_system.s_.set_dimension(CP::MAX_DIM);
+    slip_system.n_.set_dimension(CP::MAX_DIM);
+    for (minitensor::Index j(0); j < CP::MAX_DIM; ++j) {
+      slip_system.s_(j) = directions[i][j];
+      slip_system.n_(j) = normals[i / 3][j];
+    }
+    slip_system.s_ = minitensor::unit(slip_system.s_);
+    slip_system.n_ = minitensor::unit(slip_system.n_);
+
+    slip_system.projector_.set_dimension(CP::MAX_DIM);
+    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+  }
+  return slip_systems;
+}
+
+// One family with all the FCC systems and the matrices of the given law.
+CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>
+createSlipFamily(CP::HardeningLawType const law)
+{
+  std::vector<CP::SlipSystem<CP::MAX_DIM>> const slip_systems = createFCCSlipSystems();
+
+  CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP> slip_family;
+
+  slip_family.setHardeningLawType(law);
+  slip_family.num_slip_sys_ = num_slip;
+  for (minitensor::Index i(0); i < num_slip; ++i) slip_family.slip_system_indices_[i] = i;
+
+  slip_family.phardening_parameters_->createLatentMatrix(slip_family, slip_systems);
+  slip_family.setLatentOperators();
+  return slip_family;
+}
+
+RealType
+difference(RealType const a, RealType const b)
+{
+  return std::abs(a - b);
+}
+
+RealType
+difference(FadType const& a, FadType const& b)
+{
+  RealType error = std::abs(a.val() - b.val());
+  int const size = std::max(a.size(), b.size());
+  for (int k = 0; k < size; ++k) {
+    RealType const a_k = k < a.size() ? a.dx(k) : 0.0;
+    RealType const b_k = k < b.size() ? b.dx(k) : 0.0;
+    error              = std::max(error, std::abs(a_k - b_k));
+  }
+  return error;
+}
+
+RealType
+value(RealType const a)
+{
+  return a;
+}
+
+RealType
+value(FadType const& a)
+{
+  return a.val();
+}
+
+// x with distinct entries; a FAD x carries the identity as derivatives.
+template <typename ArgT>
+minitensor::Vector<ArgT, CP::MAX_SLIP>
+createArgument()
+{
+  minitensor::Vector<ArgT, CP::MAX_SLIP> x(num_slip);
+  for (minitensor::Index i(0); i < num_slip; ++i) x(i) = std::sin(1.0 + i);
+  return x;
+}
+
+template <>
+minitensor::Vector<FadType, CP::MAX_SLIP>
+createArgument<FadType>()
+{
+  minitensor::Vector<FadType, CP::MAX_SLIP> x(num_slip);
+  for (minitensor::Index i(0); i < num_slip; ++i) x(i) = FadType(num_slip, i, std::sin(1.0 + i));
+  return x;
+}
+
+// The operator must reproduce the dense product, values and derivatives.
+template <typename ArgT>
+void
+checkApply(CP::LatentOperator<CP::MAX_SLIP> const& latent_operator, Matrix const& matrix, Teuchos::FancyOStream& out, bool& success)
+{
+  minitensor::Vector<ArgT, CP::MAX_SLIP> const x = createArgument<ArgT>();
+
+  minitensor::Vector<ArgT, CP::MAX_SLIP> const y     = latent_operator.apply(x);
+  minitensor::Vector<ArgT, CP::MAX_SLIP> const y_ref = matrix * x;
+
+  TEST_EQUALITY(y.get_dimension(), num_slip);
+
+  for (minitensor::Index i(0); i < num_slip; ++i) {
+    RealType const scale = 1.0 + std::abs(value(y_ref(i)));
+    TEST_COMPARE(difference(y(i), y_ref(i)), <=, tolerance * scale);
+  }
+}
+
+void
+checkMatrix(Matrix const& matrix, CP::LatentStructure const structure, Teuchos::FancyOStream& out, bool& success)
+{
+  CP::LatentOperator<CP::MAX_SLIP> latent_operator;
+  latent_operator.setMatrix(matrix);
+
+  TEST_EQUALITY(static_cast<int>(latent_operator.getStructure()), static_cast<int>(structure));
+
+  checkApply<RealType>(latent_operator, matrix, out, success);
+  checkApply<FadType>(latent_operator, matrix, out, success);
+}
+
+TEUCHOS_UNIT_TEST(LatentOperator, LinearMinusRecovery)
+{
+  auto const slip_family = createSlipFamily(CP::HardeningLawType::LINEAR_MINUS_RECOVERY);
+
+  // All ones: u v^T
+  TEST_EQUALITY(static_cast<int>(slip_family.latent_operator_.getStructure()), static_cast<int>(CP::LatentStructure::RANK_ONE));
+
+  checkApply<RealType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+  checkApply<FadType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+}
+
+TEUCHOS_UNIT_TEST(LatentOperator, Saturation)
+{
+  auto const slip_family = createSlipFamily(CP::HardeningLawType::SATURATION);
+
+  checkApply<RealType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+  checkApply<FadType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+}
+
+TEUCHOS_UNIT_TEST(LatentOperator, DislocationDensity)
+{
+  auto const slip_family = createSlipFamily(CP::HardeningLawType::DISLOCATION_DENSITY);
+
+  checkApply<RealType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+  checkApply<FadType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+
+  // Only this law uses the auxiliary matrix.
+  TEST_INEQUALITY(static_cast<int>(slip_family.aux_operator_.getStructure()), static_cast<int>(CP::LatentStructure::ZERO));
+
+  checkApply<RealType>(slip_family.aux_operator_, slip_family.aux_matrix_, out, success);
+  checkApply<FadType>(slip_family.aux_operator_, slip_family.aux_matrix_, out, success);
+}
+
+TEUCHOS_UNIT_TEST(LatentOperator, NoHardening)
+{
+  auto const slip_family = createSlipFamily(CP::HardeningLawType::UNDEFINED);
+
+  TEST_EQUALITY(static_cast<int>(slip_family.latent_operator_.getStructure()), static_cast<int>(CP::LatentStructure::ZERO));
+
+  checkApply<RealType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+  checkApply<FadType>(slip_family.latent_operator_, slip_family.latent_matrix_, out, success);
+}
+
+// Each representation on a matrix chosen to select it.
+TEUCHOS_UNIT_TEST(LatentOperator, Structures)
+{
+  Matrix matrix(num_slip, minitensor::Filler::ZEROS);
+
+  checkMatrix(matrix, CP::LatentStructure::ZERO, out, success);
+
+  // Rank one with varying factors
+  for (minitensor::Index i(0); i < num_slip; ++i) {
+    for (minitensor::Index j(0); j < num_slip; ++j) matrix(i, j) = (1.0 + i) / (2.0 + j);
+  }
+  checkMatrix(matrix, CP::LatentStructure::RANK_ONE, out, success);
+
+  // Full 2 x 2 blocks coupling i and i + 6, i.e., block diagonal only up to a
+  // permutation
+  matrix.fill(minitensor::Filler::ZEROS);
+  for (minitensor::Index i(0); i < num_slip / 2; ++i) {
+    minitensor::Index const k = i + num_slip / 2;
+
+    matrix(i, i) = 2.0 + i;
+    matrix(i, k) = -1.0;
+    matrix(k, i) = 0.5;
+    matrix(k, k) = 3.0 - i;
+  }
+  checkMatrix(matrix, CP::LatentStructure::BLOCK_DIAGONAL, out, success);
+
+  // Tridiagonal: one block, but few entries
+  matrix.fill(minitensor::Filler::ZEROS);
+  for (minitensor::Index i(0); i < num_slip; ++i) {
+    matrix(i, i) = 2.0 + i;
+    if (i > 0) matrix(i, i - 1) = -1.0;
+    if (i + 1 < num_slip) matrix(i, i + 1) = 0.5 * i - 1.0;
+  }
+  checkMatrix(matrix, CP::LatentStructure::SPARSE, out, success);
+
+  // Hilbert matrix
+  for (minitensor::Index i(0); i < num_slip; ++i) {
+    for (minitensor::Index j(0); j < num_slip; ++j) matrix(i, j) = 1.0 / (1.0 + i + j);
+  }
+  checkMatrix(matrix, CP::LatentStructure::DENSE, out, success);
+}
+
+}  // namespace
@@ -117,4 +117,70 @@ TEUCHOS_UNIT_TEST(LocalNonlinearSolver, Jacobian)
   TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
 }
 
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedDenseSolve)
+{
+  // same system as the LAPACK test, plus a 4 x 4 one for the LU path
+  RealType A2[] = {1.1, 0.1, .01, 0.9};
+  RealType B2[] = {0.1, 0.2};
+
+  LCM::LocalDenseSolver<2> solver2;
+  solver2.factor(A2);
+  solver2.solve(B2);
+
+  TEST_COMPARE(fabs(B2[0] - 0.088978766430738), <=, 1.0e-14);
+  TEST_COMPARE(fabs(B2[1] - 0.212335692618807), <=, 1.0e-14);
+
+  RealType A4[] = {0.0, 2.0, 1.0, 0.0, 1.0, 0.0, 0.0, 3.0, 2.0, 1.0, 4.0, 0.0, 0.0, 1.0, 0.0, 5.0};
+  RealType X4[] = {1.0, -2.0, 3.0, -4.0};
+  RealType B4[4];
+  for (int i = 0; i < 4; ++i) {
+    B4[i] = 0.0;
+    for (int j = 0; j < 4; ++j) B4[i] += A4[i + 4 * j] * X4[j];
+  }
+
+  LCM::LocalDenseSolver<4> solver4;
+  solver4.factor(A4);
+  solver4.solve(B4);
+
+  for (int i = 0; i < 4; ++i) TEST_COMPARE(fabs(B4[i] - X4[i]), <=, 1.0e-14);
+}
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedJacobian)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Jacobian          EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  std::array<ScalarT, 1>                           F;
+  std::array<ScalarT, 1>                           dFdX;
+  std::array<ScalarT, 1>                           X;
+  LCM::FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
+
+  // initialize X
+  X[0] = 1.0;
+
+  ScalarT two(1, 0, 2.0);
+  int     count(0);
+  bool    converged = false;
+  while (!converged && count < 10) {
+    // objective function --> x^2 - 2 == 0
+    F[0]    = X[0] * X[0] - two;
+    dFdX[0] = 2.0 * X[0];
+
+    solver.solve(dFdX, X, F);
+
+    if (fabs(F[0]) <= 1.0E-15) converged = true;
+
+    count++;
+  }
+
+  F[0] = X[0] * X[0] - two;
+  solver.computeFadInfo(dFdX, X, F);
+
+  // d(sqrt(p))/dp at p = 2
+  const RealType refX[] = {std::sqrt(2)};
+  TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
+  TEST_COMPARE(fabs(X[0].dx(0) - 0.5 / refX[0]), <=, 1.0e-14);
+}
+
 }  // namespace
@@ -0,0 +1,146 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <Thyra_LinearOpBase.hpp>
+#include <Thyra_VectorStdOps.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "Albany_Application.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_Utils.hpp"
+#include "Albany_config.h"
+#include "Schwarz_BoundaryJacobian.hpp"
+#include "Schwarz_Coupled.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+// The bars of the CrystalPlasticity/SchwarzBar test, coupled by the Schwarz
+// BC. The inputs refer to each other from a run directory one level below
+// them, which is where this test runs.
+Teuchos::Array<std::string> const model_files = Teuchos::tuple<std::string>("../lower_bar.yaml", "../gauge.yaml", "../upper_bar.yaml");
+
+// Residual of app this_index with its own solution at zero and the given
+// solution for the coupled app.
+RCP<Thyra_Vector>
+computeResidual(
+    Teuchos::ArrayRCP<RCP<Albany::Application>> const& apps,
+    int const                                          this_index,
+    int const                                          coupled_index,
+    RCP<Thyra_Vector const> const&                     coupled_x)
+{
+  RCP<Thyra_Vector> x = Thyra::createMember(apps[this_index]->getVectorSpace());
+  x->assign(0.0);
+
+  apps[coupled_index]->setX(coupled_x);
+
+  RCP<Thyra_Vector> f = Thyra::createMember(apps[this_index]->getVectorSpace());
+
+  Teuchos::Array<ParamVec> p;
+  apps[this_index]->computeGlobalResidual(0.0, x, Teuchos::null, Teuchos::null, p, f);
+  return f;
+}
+
+TEUCHOS_UNIT_TEST(SchwarzBoundaryJacobian, FiniteDifference)
+{
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  RCP<Teuchos_Comm const> comm = Albany::createTeuchosCommFromMpiComm(MPI_COMM_WORLD);
+
+  RCP<Teuchos::ParameterList> params = rcp(new Teuchos::ParameterList("Coupled Schwarz"));
+  params->sublist("Coupled System").set("Model Input Files", model_files);
+  params->sublist("Problem").set<std::string>("Solution Method", "Coupled Schwarz");
+
+  RCP<LCM::SchwarzCoupled> coupled = rcp(new LCM::SchwarzCoupled(params, comm, Teuchos::null, Teuchos::null));
+
+  Teuchos::ArrayRCP<RCP<Albany::Application>> apps = coupled->getApps();
+
+  int const num_apps = apps.size();
+
+  // The Schwarz BC reads the solution the coupled apps last saw.
+  for (int m = 0; m < num_apps; ++m) {
+    RCP<Thyra_Vector> x = Thyra::createMember(apps[m]->getVectorSpace());
+    x->assign(0.0);
+    apps[m]->setX(x);
+  }
+
+  Teuchos::Array<RCP<Thyra_LinearOp>> jacs(num_apps);
+
+  // The Schwarz residual is linear in the coupled solution, so the
+  // difference quotient is exact up to round-off.
+  ST const eps       = 1.0e-2;
+  ST const tolerance = 1.0e-10;
+
+  int num_coupled = 0;
+
+  for (int i = 0; i < num_apps; ++i) {
+    for (int j = 0; j < num_apps; ++j) {
+      if (i == j) continue;
+
+      LCM::Schwarz_BoundaryJacobian jac(comm, apps, jacs, i, j);
+      jac.initialize();
+
+      if (apps[i]->isCoupled(j) == true) ++num_coupled;
+
+      RCP<Thyra_Vector> v = Thyra::createMember(jac.domain());
+      Thyra::randomize(-1.0, 1.0, v.ptr());
+
+      RCP<Thyra_Vector> w = Thyra::createMember(jac.range());
+      Thyra::randomize(-1.0, 1.0, w.ptr());
+
+      RCP<Thyra_Vector> x_j = Thyra::createMember(jac.domain());
+      x_j->assign(0.0);
+
+      RCP<Thyra_Vector> f_0 = computeResidual(apps, i, j, x_j);
+
+      Thyra::Vp_StV(x_j.ptr(), eps, *v);
+
+      RCP<Thyra_Vector> f_eps = computeResidual(apps, i, j, x_j);
+
+      // fd = (f(eps v) - f(0)) / eps
+      RCP<Thyra_Vector> fd = Thyra::createMember(jac.range());
+      Thyra::V_StVpStV(fd.ptr(), 1.0 / eps, *f_eps, -1.0 / eps, *f_0);
+
+      ST const scale = std::max(Thyra::norm_2(*fd), 1.0);
+
+      // B v
+      RCP<Thyra_Vector> Bv = Thyra::createMember(jac.range());
+      Thyra::apply(jac, Thyra::NOTRANS, *v, Bv.ptr());
+
+      RCP<Thyra_Vector> error = Thyra::createMember(jac.range());
+      Thyra::V_VmV(error.ptr(), *Bv, *fd);
+      TEST_COMPARE(Thyra::norm_2(*error), <=, tolerance * scale);
+
+      // w . B v = B^T w . v
+      RCP<Thyra_Vector> BTw = Thyra::createMember(jac.domain());
+      Thyra::apply(jac, Thyra::TRANS, *w, BTw.ptr());
+      TEST_COMPARE(std::abs(Thyra::dot(*BTw, *v) - Thyra::dot(*w, *fd)), <=, tolerance * scale * Thyra::norm_2(*w));
+
+      // The assembled operator
+      RCP<Thyra_LinearOp> K = jac.getExplicitOperator();
+
+      RCP<Thyra_Vector> Kv = Thyra::createMember(jac.range());
+      Thyra::apply(*K, Thyra::NOTRANS, *v, Kv.ptr());
+
+      Thyra::V_VmV(error.ptr(), *Kv, *fd);
+      TEST_COMPARE(Thyra::norm_2(*error), <=, tolerance * scale);
+
+      // The coupling is not trivial.
+      if (apps[i]->isCoupled(j) == true) TEST_COMPARE(Thyra::norm_2(*fd), >, 0.0);
+
+      // Leave the coupled app at zero for the next pair.
+      x_j->assign(0.0);
+    }
+  }
+
+  // Both bars are coupled to the gauge and the gauge to both bars.
+  TEST_EQUALITY(num_coupled, 4);
+}
+
+}  // namespace
@@ -0,0 +1,193 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Teuchos_UnitTestHarness.hpp"
+#include "topology/Topology_Search.hpp"
+
+namespace {
+
+using Point = LCM::PointKdTree::Point;
+
+// Index of the closest point by a linear scan, ties to the lowest index.
+std::size_t
+bruteForceNearest(std::vector<Point> const& points, Point const& query)
+{
+  std::size_t best       = 0;
+  double      best_dist2 = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    double dist2 = 0.0;
+    for (int j = 0; j < 3; ++j) dist2 += (points[i][j] - query[j]) * (points[i][j] - query[j]);
+    if (dist2 < best_dist2) {
+      best       = i;
+      best_dist2 = dist2;
+    }
+  }
+  return best;
+}
+
+std::vector<Point>
+randomPoints(std::size_t const number, std::mt19937& generator)
+{
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  std::vector<Point> points(number);
+  for (auto& point : points) {
+    for (auto& x : point) x = distribution(generator);
+  }
+  return points;
+}
+
+// Length of a path returned by shortestPath, -1 if two consecutive vertices
+// are not joined by an edge.
+float
+pathLength(std::vector<int> const& path, std::vector<std::array<int, 2>> const& edges, std::vector<float> const& weights)
+{
+  float length = 0.0;
+  for (std::size_t k = 1; k < path.size(); ++k) {
+    float weight = -1.0;
+    for (std::size_t e = 0; e < edges.size(); ++e) {
+      bool const joined = (edges[e][0] == path[k - 1] && edges[e][1] == path[k]) || (edges[e][1] == path[k - 1] && edges[e][0] == path[k]);
+      if (joined == true && (weight < 0.0 || weights[e] < weight)) weight = weights[e];
+    }
+    if (weight < 0.0) return -1.0;
+    length += weight;
+  }
+  return length;
+}
+
+TEUCHOS_UNIT_TEST(PointKdTree, RandomPoints)
+{
+  std::mt19937 generator(1);
+
+  std::vector<Point> const points  = randomPoints(500, generator);
+  std::vector<Point> const queries = randomPoints(200, generator);
+
+  LCM::PointKdTree const tree(points);
+
+  TEST_EQUALITY(tree.empty(), false);
+
+  for (auto const& query : queries) {
+    TEST_EQUALITY(tree.nearest(query), bruteForceNearest(points, query));
+  }
+
+  // The points themselves
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    TEST_EQUALITY(tree.nearest(points[i]), i);
+  }
+}
+
+// A lattice with every point twice, queried at the lattice points and
+// halfway between them, where the distances tie.
+TEUCHOS_UNIT_TEST(PointKdTree, Ties)
+{
+  std::vector<Point> points;
+  for (int copy = 0; copy < 2; ++copy) {
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        for (int k = 0; k < 4; ++k) points.push_back(Point{{double(i), double(j), double(k)}});
+      }
+    }
+  }
+
+  LCM::PointKdTree const tree(points);
+
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        Point const query{{0.5 * i, 0.5 * j, 0.5 * k}};
+        TEST_EQUALITY(tree.nearest(query), bruteForceNearest(points, query));
+      }
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(PointKdTree, SinglePoint)
+{
+  LCM::PointKdTree const tree(std::vector<Point>(1, Point{{1.0, 2.0, 3.0}}));
+
+  TEST_EQUALITY(tree.nearest(Point{{-5.0, 0.0, 5.0}}), std::size_t(0));
+  TEST_EQUALITY(LCM::PointKdTree().empty(), true);
+}
+
+//
+//   0 --1-- 1 --1-- 2
+//   |       |       |
+//   2       5       1
+//   |       |       |
+//   3 -0.5- 4 -.25- 5
+//
+TEUCHOS_UNIT_TEST(WeightedGraph, ShortestPath)
+{
+  std::vector<std::array<int, 2>> const edges{{{0, 1}}, {{1, 2}}, {{2, 5}}, {{0, 3}}, {{3, 4}}, {{4, 5}}, {{1, 4}}};
+  std::vector<float> const              weights{1.0, 1.0, 1.0, 2.0, 0.5, 0.25, 5.0};
+
+  LCM::WeightedGraph const graph(6, edges, weights);
+
+  TEST_EQUALITY(graph.num_vertices(), std::size_t(6));
+
+  // Paths run from goal to source.
+  TEST_COMPARE_ARRAYS(graph.shortestPath(0, 5), std::vector<int>({5, 4, 3, 0}));
+  TEST_COMPARE_ARRAYS(graph.shortestPath(2, 3), std::vector<int>({3, 4, 5, 2}));
+  TEST_COMPARE_ARRAYS(graph.shortestPath(1, 4), std::vector<int>({4, 5, 2, 1}));
+  TEST_COMPARE_ARRAYS(graph.shortestPath(1, 1), std::vector<int>({1}));
+
+  // The work arrays are reset between queries.
+  TEST_COMPARE_ARRAYS(graph.shortestPath(0, 5), std::vector<int>({5, 4, 3, 0}));
+  TEST_COMPARE_ARRAYS(graph.shortestPath(5, 0), std::vector<int>({0, 3, 4, 5}));
+}
+
+// Path lengths on a grid with diagonals and varied weights against the
+// distances of Floyd-Warshall.
+TEUCHOS_UNIT_TEST(WeightedGraph, Grid)
+{
+  int const n   = 5;
+  auto      vtx = [](int i, int j) { return n * i + j; };
+
+  std::vector<std::array<int, 2>> edges;
+  std::vector<float>              weights;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (i + 1 < n) edges.push_back({{vtx(i, j), vtx(i + 1, j)}});
+      if (j + 1 < n) edges.push_back({{vtx(i, j), vtx(i, j + 1)}});
+      if (i + 1 < n && j + 1 < n) edges.push_back({{vtx(i, j), vtx(i + 1, j + 1)}});
+    }
+  }
+  for (std::size_t e = 0; e < edges.size(); ++e) weights.push_back(1.0 + (7 * e) % 5);
+
+  int const num_vertices = n * n;
+
+  float const                     infinity = std::numeric_limits<float>::max();
+  std::vector<std::vector<float>> distances(num_vertices, std::vector<float>(num_vertices, infinity));
+  for (int v = 0; v < num_vertices; ++v) distances[v][v] = 0.0;
+  for (std::size_t e = 0; e < edges.size(); ++e) {
+    distances[edges[e][0]][edges[e][1]] = weights[e];
+    distances[edges[e][1]][edges[e][0]] = weights[e];
+  }
+  for (int k = 0; k < num_vertices; ++k) {
+    for (int i = 0; i < num_vertices; ++i) {
+      for (int j = 0; j < num_vertices; ++j) {
+        if (distances[i][k] + distances[k][j] < distances[i][j]) distances[i][j] = distances[i][k] + distances[k][j];
+      }
+    }
+  }
+
+  LCM::WeightedGraph const graph(num_vertices, edges, weights);
+
+  for (int source = 0; source < num_vertices; ++source) {
+    for (int goal = 0; goal < num_vertices; ++goal) {
+      std::vector<int> const path = graph.shortestPath(source, goal);
+      TEST_EQUALITY(path.front(), goal);
+      TEST_EQUALITY(path.back(), source);
+      TEST_EQUALITY(pathLength(path, edges, weights), distances[source][goal]);
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,505 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Throughput benchmark for LCM constitutive models.
+// Drives the material model of every element block in a materials file
+// through prescribed loading paths for a sweep of evaluation types and
+// workset sizes, and writes the results as JSON. The sweep is over the blocks
+// of the materials file, not over every model known to
+// ConstitutiveModelInterface: most models need parameters that only an input
+// deck provides. tests/LCM/ConstitutiveModelBenchmark has a deck with one
+// block per benchmarked model. The thread count is fixed by Kokkos at startup
+// (e.g. --kokkos-threads=N), so a thread sweep is one run per count.
+
+#include <MiniTensor.h>
+
+#include <Albany_Layouts.hpp>
+#include <Albany_STKDiscretization.hpp>
+#include <Albany_StateManager.hpp>
+#include <Albany_TmplSTKMeshStruct.hpp>
+#include <Albany_Utils.hpp>
+#include <PHAL_AlbanyTraits.hpp>
+#include <PHAL_SaveStateField.hpp>
+#include <Phalanx_DataLayout_MDALayout.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+#include "Albany_MaterialDatabase.hpp"
+#include "ConstitutiveModelInterface.hpp"
+#include "ConstitutiveModelParameters.hpp"
+#include "FieldNameMap.hpp"
+#include "Kokkos_Core.hpp"
+#include "LocalNonlinearSolver.hpp"
+#include "SetField.hpp"
+
+namespace {
+
+using Traits   = PHAL::AlbanyTraits;
+using Residual = PHAL::AlbanyTraits::Residual;
+using Jacobian = PHAL::AlbanyTraits::Jacobian;
+
+int const num_dims     = 3;
+int const num_vertices = 8;
+int const num_nodes    = 8;
+
+struct BenchmarkResult
+{
+  std::string block;
+  std::string model;
+  std::string evaluation;
+  std::string loading;
+  int         workset_size{0};
+  double      compute_seconds{0.0};
+  long long   point_updates{0};
+  long long   local_iterations{0};
+  bool        have_local_iterations{false};
+  std::size_t state_bytes{0};
+};
+
+std::vector<std::string>
+splitList(std::string const& list)
+{
+  std::vector<std::string> items;
+  std::stringstream        ss(list);
+  std::string              item;
+  while (std::getline(ss, item, ',')) {
+    if (item.empty() == false) items.push_back(item);
+  }
+  return items;
+}
+
+// Deformation gradient at pseudo time alpha in [0, 1]; magnitude is the
+// peak strain of the path.
+minitensor::Tensor<RealType>
+loadingPathF(std::string const& loading, RealType alpha, RealType magnitude)
+{
+  minitensor::Tensor<RealType> F = minitensor::eye<RealType>(num_dims);
+  if (loading == "uniaxial") {
+    F(0, 0) += magnitude * alpha;
+  } else if (loading == "shear") {
+    F(0, 1) = magnitude * alpha;
+  } else if (loading == "cyclic") {
+    // one full tension-compression cycle
+    RealType const pi = std::acos(-1.0);
+    F(0, 0) += magnitude * std::sin(2.0 * pi * alpha);
+  } else {
+    ALBANY_ABORT("Unknown loading path \"" << loading << "\", expected uniaxial, shear or cyclic");
+  }
+  return F;
+}
+
+inline void
+setSeededValue(RealType& x, RealType value, int, int)
+{
+  x = value;
+}
+
+inline void
+setSeededValue(FadType& x, RealType value, int deriv_dim, int index)
+{
+  x = FadType(deriv_dim, index, value);
+}
+
+// Kinematic fields fed to the model through SetField evaluators.
+template <typename EvalT>
+struct DriverFields
+{
+  using ScalarT = typename EvalT::ScalarT;
+
+  DriverFields(int num_cells, int num_pts, int deriv_dim)
+      : num_cells_(num_cells),
+        num_pts_(num_pts),
+        deriv_dim_(deriv_dim),
+        def_grad(num_cells * num_pts * 9),
+        det_def_grad(num_cells * num_pts),
+        strain(num_cells * num_pts * 9),
+        temperature(num_cells * num_pts),
+        delta_time(1)
+  {
+  }
+
+  // Set F, J and the small strain at every point; for derivative types the
+  // nine components of F are the independent variables, and J and the small
+  // strain are computed from them so that they carry their derivatives too.
+  void
+  set(minitensor::Tensor<RealType> const& F)
+  {
+    minitensor::Tensor<ScalarT> Fs(num_dims);
+    for (int k = 0; k < 9; ++k) setSeededValue(Fs(k / 3, k % 3), F(k / 3, k % 3), deriv_dim_, k);
+
+    minitensor::Tensor<ScalarT> const eps = 0.5 * (Fs + minitensor::transpose(Fs)) - minitensor::eye<ScalarT>(num_dims);
+    ScalarT const                     J   = minitensor::det(Fs);
+    for (int i = 0; i < num_cells_ * num_pts_; ++i) {
+      for (int k = 0; k < 9; ++k) {
+        def_grad[9 * i + k] = Fs(k / 3, k % 3);
+        strain[9 * i + k]   = eps(k / 3, k % 3);
+      }
+      det_def_grad[i] = J;
+    }
+  }
+
+  int                        num_cells_;
+  int                        num_pts_;
+  int                        deriv_dim_;
+  Teuchos::ArrayRCP<ScalarT> def_grad;
+  Teuchos::ArrayRCP<ScalarT> det_def_grad;
+  Teuchos::ArrayRCP<ScalarT> strain;
+  Teuchos::ArrayRCP<ScalarT> temperature;
+  Teuchos::ArrayRCP<ScalarT> delta_time;
+};
+
+template <typename EvalT>
+void
+registerSetField(
+    PHX::FieldManager<Traits>&                fm,
+    std::string const&                        name,
+    Teuchos::RCP<PHX::DataLayout> const&      layout,
+    Teuchos::ArrayRCP<typename EvalT::ScalarT> values)
+{
+  Teuchos::ParameterList p("SetField" + name);
+  p.set<std::string>("Evaluated Field Name", name);
+  p.set<Teuchos::RCP<PHX::DataLayout>>("Evaluated Field Data Layout", layout);
+  p.set<Teuchos::ArrayRCP<typename EvalT::ScalarT>>("Field Values", values);
+  fm.registerEvaluator<EvalT>(Teuchos::rcp(new LCM::SetField<EvalT, Traits>(p)));
+}
+
+// Register the kinematic drivers, the parameters and the model itself.
+template <typename EvalT>
+Teuchos::RCP<LCM::ConstitutiveModelInterface<EvalT, Traits>>
+registerModel(
+    PHX::FieldManager<Traits>&           fm,
+    DriverFields<EvalT>&                 fields,
+    Teuchos::ParameterList&              material,
+    Teuchos::RCP<Albany::Layouts> const& dl,
+    bool                                 have_temperature)
+{
+  registerSetField<EvalT>(fm, "F", dl->qp_tensor, fields.def_grad);
+  registerSetField<EvalT>(fm, "J", dl->qp_scalar, fields.det_def_grad);
+  registerSetField<EvalT>(fm, "Strain", dl->qp_tensor, fields.strain);
+  registerSetField<EvalT>(fm, "Delta Time", dl->workset_scalar, fields.delta_time);
+  if (have_temperature) registerSetField<EvalT>(fm, "Temperature", dl->qp_scalar, fields.temperature);
+
+  Teuchos::ParameterList cmpPL;
+  cmpPL.set<Teuchos::ParameterList*>("Material Parameters", &material);
+  if (have_temperature) cmpPL.set<std::string>("Temperature Name", "Temperature");
+  fm.registerEvaluator<EvalT>(Teuchos::rcp(new LCM::ConstitutiveModelParameters<EvalT, Traits>(cmpPL, dl)));
+
+  Teuchos::ParameterList cmiPL;
+  cmiPL.set<Teuchos::ParameterList*>("Material Parameters", &material);
+  if (have_temperature) cmiPL.set<std::string>("Temperature Name", "Temperature");
+  auto CMI = Teuchos::rcp(new LCM::ConstitutiveModelInterface<EvalT, Traits>(cmiPL, dl));
+  fm.registerEvaluator<EvalT>(CMI);
+  return CMI;
+}
+
+template <typename EvalT>
+int
+derivativeDimension()
+{
+  // F is the independent variable, padded to the hex8 nodal DOF count so
+  // that the FAD cost matches a finite element Jacobian fill.
+  return std::is_same<EvalT, Jacobian>::value == true ? num_nodes * num_dims : 0;
+}
+
+template <typename EvalT>
+BenchmarkResult
+runCase(
+    Albany::MaterialDatabase&               material_db,
+    std::string const&                      block,
+    std::string const&                      evaluation,
+    std::string const&                      loading,
+    int                                     workset_size,
+    int                                     num_pts,
+    int                                     num_steps,
+    RealType                                step_size,
+    Teuchos::RCP<Teuchos_Comm const> const& commT)
+{
+  using ScalarT = typename EvalT::ScalarT;
+
+  BenchmarkResult result;
+  result.block        = block;
+  result.evaluation   = evaluation;
+  result.loading      = loading;
+  result.workset_size = workset_size;
+
+  // Each case works on its own copy, models may write into the list.
+  std::string const      material_name = material_db.getElementBlockParam<std::string>(block, "material");
+  Teuchos::ParameterList material      = material_db.getElementBlockSublist(block, material_name);
+  result.model                         = material_db.getElementBlockSublist(block, "Material Model").get<std::string>("Model Name");
+
+  Teuchos::ParameterList& mpsParams        = material.sublist("Material Point Simulator");
+  bool const              have_temperature = mpsParams.get<bool>("Use Temperature", false);
+
+  auto const dl = Teuchos::rcp(new Albany::Layouts(workset_size, num_vertices, num_nodes, num_pts, num_dims));
+
+  LCM::FieldNameMap field_name_map(false);
+  material.set<Teuchos::RCP<std::map<std::string, std::string>>>("Name Map", field_name_map.getMap());
+  material.set<bool>("Compute Tangent", false);
+  if (have_temperature) material.set<bool>("Have Temperature", true);
+
+  int const deriv_dim = derivativeDimension<EvalT>();
+
+  DriverFields<EvalT>    fields(workset_size, num_pts, deriv_dim);
+  DriverFields<Residual> state_fields(workset_size, num_pts, 0);
+  fields.delta_time[0]       = step_size;
+  state_fields.delta_time[0] = step_size;
+  RealType const temperature = mpsParams.get<double>("Temperature", 1.0);
+  for (int i = 0; i < workset_size * num_pts; ++i) {
+    fields.temperature[i]       = temperature;
+    state_fields.temperature[i] = temperature;
+  }
+
+  // Timed field manager for EvalT
+  PHX::FieldManager<Traits> fm;
+  auto                      CMI = registerModel<EvalT>(fm, fields, material, dl, have_temperature);
+  for (auto const& tag : CMI->evaluatedFields()) fm.requireField<EvalT>(*tag);
+
+  // Untimed residual field manager that advances the state variables
+  PHX::FieldManager<Traits> sfm;
+  Albany::StateManager      stateMgr;
+  std::string const         eb_name = "Block0";
+  auto                      state_CMI = registerModel<Residual>(sfm, state_fields, material, dl, have_temperature);
+
+  Teuchos::RCP<Teuchos::ParameterList> p;
+  for (int sv(0); sv < state_CMI->getNumStateVars(); ++sv) {
+    state_CMI->fillStateVariableStruct(sv);
+    p = stateMgr.registerStateVariable(
+        state_CMI->getName(),
+        state_CMI->getLayout(),
+        dl->dummy,
+        eb_name,
+        state_CMI->getInitType(),
+        state_CMI->getInitValue(),
+        state_CMI->getStateFlag(),
+        state_CMI->getOutputFlag());
+    sfm.registerEvaluator<Residual>(Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p)));
+  }
+  p = stateMgr.registerStateVariable("F", dl->qp_tensor, dl->dummy, eb_name, "identity", 1.0, true, false);
+  sfm.registerEvaluator<Residual>(Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p)));
+
+  PHAL::Setup setupData;
+  if (deriv_dim > 0) {
+    std::vector<PHX::index_size_type> derivative_dimensions{static_cast<PHX::index_size_type>(deriv_dim)};
+    fm.setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+  }
+  fm.postRegistrationSetup(setupData);
+
+  Teuchos::RCP<PHX::DataLayout> dummy = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  for (auto const& responseID : stateMgr.getResidResponseIDsToRequire(eb_name)) {
+    PHX::Tag<Residual::ScalarT> res_response_tag(responseID, dummy);
+    sfm.requireField<Residual>(res_response_tag);
+  }
+  sfm.postRegistrationSetup(setupData);
+
+  // Discretization, as required by the StateManager
+  Teuchos::RCP<Teuchos::ParameterList> discretizationParameterList = Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<int>("Workset Size", workset_size);
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct = Teuchos::rcp(new Albany::TmplSTKMeshStruct<3>(discretizationParameterList, Teuchos::null, commT));
+  stkMeshStruct->setFieldAndBulkData(
+      commT, discretizationParameterList, num_dims, req, stateMgr.getStateInfoStruct(), stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization = Teuchos::rcp(new Albany::STKDiscretization(discretizationParameterList, stkMeshStruct, commT));
+  static_cast<Albany::STKDiscretization&>(*discretization).updateMesh();
+  stateMgr.setupStateArrays(discretization);
+
+  PHAL::Workset workset;
+  workset.numCells            = workset_size;
+  workset.stateArrayPtr       = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+  workset.stateHandleArrayPtr = &stateMgr.getStateHandleArray(0);
+  workset.stateHandlesPtr     = &stateMgr.getStateHandles();
+
+  for (auto const& st : *workset.stateArrayPtr) result.state_bytes += st.second.size() * sizeof(double);
+
+  // Crystal plasticity reports its own local iteration counts
+  std::string const                             cp_iter_name = (*field_name_map.getMap())["CP_Residual_Iter"];
+  bool                                          have_cp_iter = false;
+  PHX::MDField<ScalarT, Cell, QuadPoint>        cp_iter(cp_iter_name, dl->qp_scalar);
+  for (auto const& tag : CMI->evaluatedFields()) have_cp_iter = have_cp_iter || tag->name() == cp_iter_name;
+  if (have_cp_iter) fm.getFieldData<EvalT>(cp_iter);
+
+  RealType const  magnitude = num_steps * step_size;
+  Teuchos::Time   compute_time("Compute Time");
+  long long const iterations_before = LCM::LocalSolverCounter::iterations();
+
+  for (int istep(0); istep <= num_steps; ++istep) {
+    RealType const                     alpha = RealType(istep) / num_steps;
+    minitensor::Tensor<RealType> const F     = loadingPathF(loading, alpha, magnitude);
+
+    fields.set(F);
+    state_fields.set(F);
+
+    LCM::LocalSolverCounter::enable(true);
+    compute_time.start();
+    fm.preEvaluate<EvalT>(workset);
+    fm.evaluateFields<EvalT>(workset);
+    fm.postEvaluate<EvalT>(workset);
+    compute_time.stop();
+    LCM::LocalSolverCounter::enable(false);
+
+    if (have_cp_iter) {
+      for (int cell = 0; cell < workset_size; ++cell) {
+        for (int pt = 0; pt < num_pts; ++pt) result.local_iterations += Sacado::ScalarValue<ScalarT>::eval(cp_iter(cell, pt));
+      }
+    }
+
+    sfm.preEvaluate<Residual>(workset);
+    sfm.evaluateFields<Residual>(workset);
+    sfm.postEvaluate<Residual>(workset);
+    stateMgr.updateStates();
+  }
+
+  result.compute_seconds = compute_time.totalElapsedTime();
+  result.point_updates   = static_cast<long long>(num_steps + 1) * workset_size * num_pts;
+  result.local_iterations += LCM::LocalSolverCounter::iterations() - iterations_before;
+  result.have_local_iterations = have_cp_iter || result.local_iterations > 0;
+
+  return result;
+}
+
+void
+writeJson(std::ostream& os, std::vector<BenchmarkResult> const& results, int num_pts, int num_steps, RealType step_size)
+{
+  os << std::setprecision(9);
+  os << "{\n";
+  os << "  \"benchmark\": \"ConstitutiveModelBenchmark\",\n";
+  os << "  \"concurrency\": " << Kokkos::DefaultExecutionSpace::concurrency() << ",\n";
+  os << "  \"num_points\": " << num_pts << ",\n";
+  os << "  \"num_steps\": " << num_steps << ",\n";
+  os << "  \"step_size\": " << step_size << ",\n";
+  os << "  \"cases\": [";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    auto const&  r    = results[i];
+    double const rate = r.compute_seconds > 0.0 ? r.point_updates / r.compute_seconds : 0.0;
+    os << (i == 0 ? "\n" : ",\n");
+    os << "    {\n";
+    os << "      \"block\": \"" << r.block << "\",\n";
+    os << "      \"model\": \"" << r.model << "\",\n";
+    os << "      \"evaluation\": \"" << r.evaluation << "\",\n";
+    os << "      \"loading\": \"" << r.loading << "\",\n";
+    os << "      \"workset_size\": " << r.workset_size << ",\n";
+    os << "      \"point_updates\": " << r.point_updates << ",\n";
+    os << "      \"compute_seconds\": " << r.compute_seconds << ",\n";
+    os << "      \"updates_per_second\": " << rate << ",\n";
+    os << "      \"local_iterations\": ";
+    if (r.have_local_iterations == true) {
+      os << r.local_iterations;
+    } else {
+      os << "null";
+    }
+    os << ",\n";
+    os << "      \"state_bytes\": " << r.state_bytes << "\n";
+    os << "    }";
+  }
+  os << "\n  ]\n";
+  os << "}\n";
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  // MPI must outlive Kokkos, which may use it during finalize
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  Kokkos::initialize(ac, av);
+
+  int status = 0;
+  {
+    Teuchos::CommandLineProcessor command_line_processor;
+
+    command_line_processor.setDocString(
+        "Constitutive Model Benchmark.\n"
+        "Measures material point update throughput of LCM models.\n");
+
+    std::string input_file = "materials.xml";
+    command_line_processor.setOption("input", &input_file, "Input File Name");
+
+    std::string output_file = "benchmark.json";
+    command_line_processor.setOption("output", &output_file, "JSON Output File Name");
+
+    std::string blocks = "";
+    command_line_processor.setOption("blocks", &blocks, "Comma-separated element blocks, all if empty");
+
+    std::string evaluations = "Residual,Jacobian";
+    command_line_processor.setOption("eval", &evaluations, "Comma-separated evaluation types");
+
+    std::string workset_sizes = "1,16,128";
+    command_line_processor.setOption("wsizes", &workset_sizes, "Comma-separated workset sizes");
+
+    std::string loadings = "uniaxial,shear,cyclic";
+    command_line_processor.setOption("loading", &loadings, "Comma-separated loading paths");
+
+    int num_pts = 8;
+    command_line_processor.setOption("npoints", &num_pts, "Number of Gaussian Points");
+
+    int num_steps = 20;
+    command_line_processor.setOption("steps", &num_steps, "Number of Load Steps");
+
+    double step_size = 1.0e-3;
+    command_line_processor.setOption("step-size", &step_size, "Strain Increment per Step");
+
+    command_line_processor.recogniseAllOptions(true);
+    command_line_processor.throwExceptions(false);
+
+    Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+    if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+      status = 0;
+    } else if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+      status = 1;
+    } else {
+      Teuchos::RCP<Teuchos_Comm const> commT = Albany::createTeuchosCommFromMpiComm(MPI_COMM_WORLD);
+
+      Albany::MaterialDatabase material_db(input_file, commT);
+
+      std::vector<std::string> block_names = blocks.empty() ? material_db.getElementBlockNames() : splitList(blocks);
+
+      std::vector<BenchmarkResult> results;
+      for (auto const& block : block_names) {
+        for (auto const& evaluation : splitList(evaluations)) {
+          for (auto const& wsize : splitList(workset_sizes)) {
+            for (auto const& loading : splitList(loadings)) {
+              int const workset_size = std::stoi(wsize);
+              if (evaluation == "Residual") {
+                results.push_back(runCase<Residual>(material_db, block, evaluation, loading, workset_size, num_pts, num_steps, step_size, commT));
+              } else if (evaluation == "Jacobian") {
+                results.push_back(runCase<Jacobian>(material_db, block, evaluation, loading, workset_size, num_pts, num_steps, step_size, commT));
+              } else {
+                ALBANY_ABORT("Unknown evaluation type \"" << evaluation << "\", expected Residual or Jacobian");
+              }
+              auto const& r = results.back();
+              std::cout << r.block << " " << r.model << " " << r.evaluation << " wsize " << r.workset_size << " " << r.loading << ": "
+                        << r.point_updates / std::max(r.compute_seconds, 1.0e-300) << " updates/s" << std::endl;
+            }
+          }
+        }
+      }
+
+      if (commT->getRank() == 0) {
+        std::ofstream jout(output_file.c_str());
+        writeJson(jout, results, num_pts, num_steps, step_size);
+      }
+    }
+  }
+  Kokkos::finalize();
+  return status;
+}
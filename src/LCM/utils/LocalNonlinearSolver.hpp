@@ -7,11 +7,97 @@
 
 #include <Sacado.hpp>
 #include <Teuchos_LAPACK.hpp>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <mutex>
+#include <utility>
 
 #include "PHAL_AlbanyTraits.hpp"
 
 namespace LCM {
 
+///
+/// Count of local Newton iterations (solve calls) across all local solvers.
+/// Counting is off by default and is meant for benchmarking only.
+///
+/// Each thread counts in its own slot, which only that thread writes, so an
+/// increment is a plain load and store. The slots are summed when the count
+/// is read. Reset and read between evaluations, not during them.
+///
+class LocalSolverCounter
+{
+ public:
+  static void
+  enable(bool enabled)
+  {
+    flag().store(enabled, std::memory_order_relaxed);
+  }
+
+  static void
+  reset()
+  {
+    Registry&                   r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (auto& c : r.slots) c.store(0, std::memory_order_relaxed);
+  }
+
+  static long long
+  iterations()
+  {
+    Registry&                   r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    long long                   sum{0};
+    for (auto const& c : r.slots) sum += c.load(std::memory_order_relaxed);
+    return sum;
+  }
+
+  static void
+  increment()
+  {
+    if (flag().load(std::memory_order_relaxed) == true) {
+      std::atomic<long long>& c = slot();
+      c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  // The slots outlive their threads, a deque keeps them in place.
+  struct Registry
+  {
+    std::mutex                         mutex;
+    std::deque<std::atomic<long long>> slots;
+  };
+
+  static std::atomic<bool>&
+  flag()
+  {
+    static std::atomic<bool> f{false};
+    return f;
+  }
+
+  static Registry&
+  registry()
+  {
+    static Registry r;
+    return r;
+  }
+
+  static std::atomic<long long>&
+  slot()
+  {
+    thread_local std::atomic<long long>* s{nullptr};
+    if (s == nullptr) {
+      Registry&                   r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      r.slots.emplace_back(0);
+      s = &r.slots.back();
+    }
+    return *s;
+  }
+};
+
 ///
 /// Local Nonlinear Solver Base class
 ///
@@ -66,6 +152,99 @@ class LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits> : public LocalN
   computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
 };
 
+// -----------------------------------------------------------------------------
+// Fixed-size variants
+// -----------------------------------------------------------------------------
+
+///
+/// Dense solver for a small N x N column-major system whose storage lives on
+/// the stack. N = 1, 2, 3 use the explicit inverse, larger N use LU with
+/// partial pivoting. The factorization is reused across right-hand sides.
+///
+template <int N>
+class LocalDenseSolver
+{
+ public:
+  void
+  factor(RealType const* A);
+  void
+  solve(RealType* b) const;
+
+ private:
+  RealType LU[N * N];
+  int      piv[N];
+};
+
+template <>
+class LocalDenseSolver<1>
+{
+ public:
+  void
+  factor(RealType const* A);
+  void
+  solve(RealType* b) const;
+
+ private:
+  RealType inv;
+};
+
+template <>
+class LocalDenseSolver<2>
+{
+ public:
+  void
+  factor(RealType const* A);
+  void
+  solve(RealType* b) const;
+
+ private:
+  RealType inv[4];
+};
+
+template <>
+class LocalDenseSolver<3>
+{
+ public:
+  void
+  factor(RealType const* A);
+  void
+  solve(RealType* b) const;
+
+ private:
+  RealType inv[9];
+};
+
+///
+/// Allocation-free counterpart of LocalNonlinearSolver for a local system of
+/// compile-time size N. Same calling convention, with std::array in place of
+/// std::vector: A is the column-major N x N Jacobian, B the residual and X
+/// the unknowns. Neither A nor B is modified.
+///
+template <typename EvalT, typename Traits, int N>
+class FixedLocalNonlinearSolver;
+
+template <typename Traits, int N>
+class FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>
+{
+ public:
+  using ScalarT = typename PHAL::AlbanyTraits::Residual::ScalarT;
+  void
+  solve(std::array<ScalarT, N * N> const& A, std::array<ScalarT, N>& X, std::array<ScalarT, N> const& B);
+  void
+  computeFadInfo(std::array<ScalarT, N * N> const& A, std::array<ScalarT, N>& X, std::array<ScalarT, N> const& B);
+};
+
+template <typename Traits, int N>
+class FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>
+{
+ public:
+  using ScalarT = typename PHAL::AlbanyTraits::Jacobian::ScalarT;
+  void
+  solve(std::array<ScalarT, N * N> const& A, std::array<ScalarT, N>& X, std::array<ScalarT, N> const& B);
+  void
+  computeFadInfo(std::array<ScalarT, N * N> const& A, std::array<ScalarT, N>& X, std::array<ScalarT, N> const& B);
+};
+
 }  // namespace LCM
 
 #include "LocalNonlinearSolver_Def.hpp"
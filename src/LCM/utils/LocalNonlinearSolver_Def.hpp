@@ -24,6 +24,8 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::LocalNonlinearSolver
 template <typename Traits>
 void inline LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::solve(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B)
 {
+  LocalSolverCounter::increment();
+
   // system size
   int numLocalVars = B.size();
 
@@ -57,6 +59,8 @@ template <typename Traits>
 void
 LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::solve(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B)
 {
+  LocalSolverCounter::increment();
+
   // system size
   int numLocalVars = B.size();
 
@@ -124,4 +128,209 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::computeFadInfo(std::
   }
 }
 
+// -----------------------------------------------------------------------------
+// Fixed-size variants
+// -----------------------------------------------------------------------------
+template <int N>
+void
+LocalDenseSolver<N>::factor(RealType const* A)
+{
+  for (int i(0); i < N * N; ++i) LU[i] = A[i];
+
+  for (int k(0); k < N; ++k) {
+    // partial pivoting on column k
+    int      p    = k;
+    RealType pmax = std::abs(LU[k + N * k]);
+    for (int i(k + 1); i < N; ++i) {
+      RealType const a = std::abs(LU[i + N * k]);
+      if (a > pmax) {
+        pmax = a;
+        p    = i;
+      }
+    }
+    piv[k] = p;
+    if (p != k) {
+      for (int j(0); j < N; ++j) std::swap(LU[k + N * j], LU[p + N * j]);
+    }
+
+    RealType const inv_pivot = 1.0 / LU[k + N * k];
+    for (int i(k + 1); i < N; ++i) {
+      LU[i + N * k] *= inv_pivot;
+      RealType const l = LU[i + N * k];
+      for (int j(k + 1); j < N; ++j) LU[i + N * j] -= l * LU[k + N * j];
+    }
+  }
+}
+
+template <int N>
+void
+LocalDenseSolver<N>::solve(RealType* b) const
+{
+  for (int k(0); k < N; ++k) {
+    if (piv[k] != k) std::swap(b[k], b[piv[k]]);
+  }
+  // forward substitution with unit lower triangle
+  for (int i(1); i < N; ++i) {
+    for (int j(0); j < i; ++j) b[i] -= LU[i + N * j] * b[j];
+  }
+  // backward substitution with upper triangle
+  for (int i(N - 1); i >= 0; --i) {
+    for (int j(i + 1); j < N; ++j) b[i] -= LU[i + N * j] * b[j];
+    b[i] /= LU[i + N * i];
+  }
+}
+
+inline void
+LocalDenseSolver<1>::factor(RealType const* A)
+{
+  inv = 1.0 / A[0];
+}
+
+inline void
+LocalDenseSolver<1>::solve(RealType* b) const
+{
+  b[0] *= inv;
+}
+
+inline void
+LocalDenseSolver<2>::factor(RealType const* A)
+{
+  RealType const d = 1.0 / (A[0] * A[3] - A[2] * A[1]);
+  inv[0]           = A[3] * d;
+  inv[1]           = -A[1] * d;
+  inv[2]           = -A[2] * d;
+  inv[3]           = A[0] * d;
+}
+
+inline void
+LocalDenseSolver<2>::solve(RealType* b) const
+{
+  RealType const b0 = b[0];
+  RealType const b1 = b[1];
+  b[0]              = inv[0] * b0 + inv[2] * b1;
+  b[1]              = inv[1] * b0 + inv[3] * b1;
+}
+
+inline void
+LocalDenseSolver<3>::factor(RealType const* A)
+{
+  // cofactors, column-major: A(i,j) = A[i + 3 * j]
+  RealType const c00 = A[4] * A[8] - A[7] * A[5];
+  RealType const c01 = A[7] * A[2] - A[1] * A[8];
+  RealType const c02 = A[1] * A[5] - A[4] * A[2];
+  RealType const d   = 1.0 / (A[0] * c00 + A[3] * c01 + A[6] * c02);
+
+  inv[0] = c00 * d;
+  inv[1] = c01 * d;
+  inv[2] = c02 * d;
+  inv[3] = (A[6] * A[5] - A[3] * A[8]) * d;
+  inv[4] = (A[0] * A[8] - A[6] * A[2]) * d;
+  inv[5] = (A[3] * A[2] - A[0] * A[5]) * d;
+  inv[6] = (A[3] * A[7] - A[6] * A[4]) * d;
+  inv[7] = (A[6] * A[1] - A[0] * A[7]) * d;
+  inv[8] = (A[0] * A[4] - A[3] * A[1]) * d;
+}
+
+inline void
+LocalDenseSolver<3>::solve(RealType* b) const
+{
+  RealType const b0 = b[0];
+  RealType const b1 = b[1];
+  RealType const b2 = b[2];
+  b[0]              = inv[0] * b0 + inv[3] * b1 + inv[6] * b2;
+  b[1]              = inv[1] * b0 + inv[4] * b1 + inv[7] * b2;
+  b[2]              = inv[2] * b0 + inv[5] * b1 + inv[8] * b2;
+}
+
+// -----------------------------------------------------------------------------
+// Residual
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+inline void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::solve(
+    std::array<ScalarT, N * N> const& A,
+    std::array<ScalarT, N>&           X,
+    std::array<ScalarT, N> const&     B)
+{
+  LocalSolverCounter::increment();
+
+  LocalDenseSolver<N> dense;
+  dense.factor(A.data());
+
+  RealType dX[N];
+  for (int i(0); i < N; ++i) dX[i] = B[i];
+  dense.solve(dX);
+
+  // increment the solution
+  for (int i(0); i < N; ++i) X[i] -= dX[i];
+}
+
+template <typename Traits, int N>
+inline void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::computeFadInfo(
+    std::array<ScalarT, N * N> const& A,
+    std::array<ScalarT, N>&           X,
+    std::array<ScalarT, N> const&     B)
+{
+  // no-op
+}
+
+// -----------------------------------------------------------------------------
+// Jacobian
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+inline void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::solve(
+    std::array<ScalarT, N * N> const& A,
+    std::array<ScalarT, N>&           X,
+    std::array<ScalarT, N> const&     B)
+{
+  LocalSolverCounter::increment();
+
+  RealType dFdX[N * N];
+  for (int i(0); i < N * N; ++i) dFdX[i] = A[i].val();
+
+  LocalDenseSolver<N> dense;
+  dense.factor(dFdX);
+
+  RealType dX[N];
+  for (int i(0); i < N; ++i) dX[i] = B[i].val();
+  dense.solve(dX);
+
+  // increment the solution
+  for (int i(0); i < N; ++i) X[i].val() -= dX[i];
+}
+
+template <typename Traits, int N>
+inline void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::computeFadInfo(
+    std::array<ScalarT, N * N> const& A,
+    std::array<ScalarT, N>&           X,
+    std::array<ScalarT, N> const&     B)
+{
+  int const numGlobalVars = B[0].size();
+  ALBANY_PANIC(
+      numGlobalVars == 0,
+      "In FixedLocalNonlinearSolver<Jacobian> the numGLobalVars is zero where it "
+      "should be positive\n");
+
+  // factor the converged local jacobian once
+  RealType dBdX[N * N];
+  for (int i(0); i < N * N; ++i) dBdX[i] = A[i].val();
+
+  LocalDenseSolver<N> dense;
+  dense.factor(dBdX);
+
+  for (int i(0); i < N; ++i) X[i].resize(numGlobalVars);
+
+  // implicit function theorem, one global derivative at a time:
+  // dX/dp = -(dB/dX)^{-1} dB/dp
+  RealType dXdP[N];
+  for (int j(0); j < numGlobalVars; ++j) {
+    for (int i(0); i < N; ++i) dXdP[i] = B[i].dx(j);
+    dense.solve(dXdP);
+    for (int i(0); i < N; ++i) X[i].fastAccessDx(j) = -dXdP[i];
+  }
+}
+
 }  // namespace LCM
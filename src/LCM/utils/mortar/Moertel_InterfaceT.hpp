@@ -17,6 +17,7 @@
 // mrtr includes
 #include "Moertel_NodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
+#include "Moertel_SearchT.hpp"
 #include "Moertel_SegmentT.hpp"
 
 /*!
@@ -830,6 +831,19 @@ class InterfaceT
   bool
   BuildNormals();
 
+  /*!
+  \brief Move nodes of this interface and prepare it for re-integration
+
+  Sets the coordinates of the nodes given in x by node id and resets all
+  nodes, keeping their Lagrange multiplier dofs, so the interface can be
+  integrated again in the deformed configuration by \ref Mortar_Integrate()
+  without rebuilding the Lagrange multiplier maps. Nodes not in x keep their
+  coordinates.
+
+  */
+  bool
+  MoveNodes(std::map<int, std::array<double, 3>> const& x);
+
   /*!
   \brief Choose degrees of freedom for Lagrange multipliers
 
@@ -929,6 +943,15 @@ class InterfaceT
   bool
   BuildNodeSegmentTopology();
 
+  // (re)build the bounding box trees over the redundant nodes and segments
+  bool
+  BuildSearchTrees();
+
+  // find the node of a side closest to x using the node tree of that side
+  // returns null if the side has no nodes
+  Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>
+  ClosestNode(int side, double const* x, bool last_on_tie) const;
+
   // detect end segments and reduce order of lagrange mutliplier shape functions
   bool
   DetectEndSegmentsandReduceOrder_2D();
@@ -1002,6 +1025,13 @@ class InterfaceT
   std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>> rnode_[2];  // global nodes of interface (both sides)
   std::map<int, int>                                                   nodePID_;   // maps all global node ids to process holding the node
 
+  std::vector<Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>     rnodevec_[2];  // redundant nodes in map order (both sides)
+  std::vector<Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>> rsegvec_[2];   // redundant segments in map order (both sides)
+  std::vector<double>                                                    rsegdiam_[2];  // bounding box diagonal of each redundant segment
+  double                                                                 maxsegdiam_[2];  // largest bounding box diagonal of a side
+  MoertelT::BoundingBoxTree                                              nodetree_[2];  // search tree over redundant nodes
+  MoertelT::BoundingBoxTree                                              segtree_[2];   // search tree over redundant segments
+
   MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::FunctionType primal_;  // the type of functions to be set as trace space function
   MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::FunctionType dual_;    // the type of functions to be set as LM space function
 };
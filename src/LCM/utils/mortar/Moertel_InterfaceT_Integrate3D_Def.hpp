@@ -2,6 +2,7 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <Kokkos_Core.hpp>
 #include <ctime>
 #include <vector>
 
@@ -11,6 +12,7 @@
 #include "Moertel_PnodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
 #include "Moertel_SegmentT.hpp"
+#include "Moertel_Tolerances.hpp"
 #include "Moertel_UtilsT.hpp"
 
 double const CONSTRAINT_MATRIX_ZERO = 1.0e-11;
@@ -125,54 +127,57 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D()
   int mside = MortarSide();
   int sside = OtherSide(mside);
 
-  // loop over all segments of slave side
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
-
-  for (scurr = rseg_[sside].begin(); scurr != rseg_[sside].end(); ++scurr) {
-    // the segment to be integrated
-    Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actsseg = scurr->second;
-
-#if 0
-    std::cout << "\n\nActive sseg id " << actsseg->Id() << "\n";
-#endif
-
-    // check whether I own at least one of the nodes on this slave segment
-    int const nnode                                 = actsseg->Nnode();
-    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = actsseg->Nodes();
-    bool foundone                                   = false;
-
+  // collect the segments of slave side with at least one node owned by me
+  std::vector<Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>> ssegs;
+  for (int k = 0; k < (int)rsegvec_[sside].size(); ++k) {
+    int const nnode                                 = rsegvec_[sside][k]->Nnode();
+    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = rsegvec_[sside][k]->Nodes();
     for (int i = 0; i < nnode; ++i)
       if (NodePID(nodes[i]->Id()) == lcomm_->getRank()) {
-        foundone = true;
+        ssegs.push_back(rsegvec_[sside][k]);
         break;
       }
+  }
 
-    // if none of the nodes belongs to me, do nothing on this segment
-    if (!foundone) continue;
-
-    // time this process
-    // Teuchos::Time time(*lComm());
-    // time.ResetStartTime();
-
-    // loop over all segments on the master side
-    std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator mcurr;
-
-    for (mcurr = rseg_[mside].begin(); mcurr != rseg_[mside].end(); ++mcurr) {
-      Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actmseg = mcurr->second;
-#if 0
-      std::cout << "Active mseg id " << actmseg->Id() << std::endl;
-#endif
+  // find the candidate master segments of each slave segment in parallel.
+  // A pair is a candidate only if it can pass the quick overlap test of
+  // MoertelT::OverlapT, which rejects pairs whose closest nodes are further
+  // apart than Rough_Search_Radius times the sum of the segment diameters.
+  // The segment diameters are bounded by their bounding box diagonals.
+  int const                     nsseg = (int)ssegs.size();
+  std::vector<std::vector<int>> candidates(nsseg);
+
+  Kokkos::parallel_for(
+      "MoertelT::InterfaceT::Integrate_3D", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nsseg), [&](int const k) {
+        int const                                 nnode = ssegs[k]->Nnode();
+        MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = ssegs[k]->Nodes();
+        std::vector<double const*>                x(nnode);
+        for (int i = 0; i < nnode; ++i) x[i] = nodes[i]->XCoords().data();
+        MoertelT::BoundingBoxTree::Box const sbox  = MoertelT::BoundingBoxTree::Enclose(x.data(), nnode);
+        double const                         sdiam = MoertelT::BoundingBoxTree::Diagonal(sbox);
+
+        std::vector<int> near;
+        segtree_[mside].Near(sbox, MOERTEL::Rough_Search_Radius * (sdiam + maxsegdiam_[mside]), near);
+
+        for (int const m : near) {
+          int const                                 mnnode = rsegvec_[mside][m]->Nnode();
+          MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** mnodes = rsegvec_[mside][m]->Nodes();
+          x.resize(mnnode);
+          for (int i = 0; i < mnnode; ++i) x[i] = mnodes[i]->XCoords().data();
+          MoertelT::BoundingBoxTree::Box const mbox = MoertelT::BoundingBoxTree::Enclose(x.data(), mnnode);
+          if (MoertelT::BoundingBoxTree::Distance(sbox, mbox) <= MOERTEL::Rough_Search_Radius * (sdiam + rsegdiam_[mside][m])) candidates[k].push_back(m);
+        }
+      });
 
+  // integration assembles into the nodes and is done in serial, in the
+  // order of the segment ids
+  for (int k = 0; k < nsseg; ++k) {
+    for (int const m : candidates[k]) {
       // if there is an overlap, integrate the pair
       // (whether there is an overlap or not will be checked inside)
-      Integrate_3D_Section(*actsseg, *actmseg);
-
-    }  // for (mcurr=rseg_[mside].begin(); mcurr!=rseg_[mside].end(); ++mcurr)
-
-    // std::cout << "time for this slave segment: " << time.ElapsedTime() <<
-    // std::endl;
-
-  }  // for (scurr=rseg_[sside].begin(); scurr!=rseg_[sside].end(); ++scurr)
+      Integrate_3D_Section(*ssegs[k], *rsegvec_[mside][m]);
+    }
+  }
 
   return true;
 }
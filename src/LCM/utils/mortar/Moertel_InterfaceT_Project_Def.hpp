@@ -179,26 +179,8 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_NormalF
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
     if (NodePID(snode->Id()) != lcomm_->getRank()) continue;
 
-    double const*                                         sx        = snode->XCoords();
-    double                                                mindist   = 1.0e+20;
-    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
-
     // find a node on the master side, that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
-    for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
-      Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
-      double const*                                         mx    = mnode->XCoords();
-
-      // build distance | mnode->XCoords() - snode->XCoords() |
-      double dist = 0.0;
-      for (int i = 0; i < 3; ++i) dist += (mx[i] - sx[i]) * (mx[i] - sx[i]);
-      dist = sqrt(dist);
-      if (dist <= mindist) {
-        mindist   = dist;
-        closenode = mnode;
-      }
-      std::cout << "snode " << snode->Id() << " mnode " << mnode->Id() << " mindist " << mindist << " dist " << dist << std::endl;
-    }
+    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = ClosestNode(mside, snode->XCoords().data(), true);
     if (closenode == Teuchos::null) {
       std::stringstream oss;
       oss << "***ERR*** "
@@ -446,25 +428,8 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_NormalF
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
     if (NodePID(mnode->Id()) != lcomm_->getRank()) continue;
 
-    double const*                   mx        = mnode->XCoords();
-    double                          mindist   = 1.0e+20;
-    Teuchos::RCP<MoertelT::(NodeT)> closenode = Teuchos::null;
-
     // find a node on the slave side that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
-    for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
-      Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
-      double const*                                         sx    = snode->XCoords();
-
-      // build distance | snode->XCoords() - mnode->XCoords() |
-      double dist = 0.0;
-      for (int i = 0; i < 3; ++i) dist += (mx[i] - sx[i]) * (mx[i] - sx[i]);
-      dist = sqrt(dist);
-      if (dist < mindist) {
-        mindist   = dist;
-        closenode = snode;
-      }
-    }
+    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = ClosestNode(sside, mnode->XCoords().data(), false);
     if (closenode == Teuchos::null) {
       std::stringstream oss;
       oss << "***ERR*** "
@@ -714,25 +679,8 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Orthogo
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
     if (NodePID(mnode->Id()) != lcomm_->getRank()) continue;
 
-    double const*                                         mx        = mnode->XCoords();
-    double                                                mindist   = 1.0e+20;
-    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
-
     // find a node on the slave side that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
-    for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
-      Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
-      double const*                                         sx    = snode->XCoords();
-
-      // build distance | snode->XCoords() - mnode->XCoords() |
-      double dist = 0.0;
-      for (int i = 0; i < 3; ++i) dist += (mx[i] - sx[i]) * (mx[i] - sx[i]);
-      dist = sqrt(dist);
-      if (dist < mindist) {
-        mindist   = dist;
-        closenode = snode;
-      }
-    }
+    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = ClosestNode(sside, mnode->XCoords().data(), false);
     if (closenode == Teuchos::null) {
       std::stringstream oss;
       oss << "***ERR*** "
@@ -912,27 +860,8 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Orthogo
 
     if (NodePID(snode->Id()) != lcomm_->getRank()) continue;
 
-    double const*                                         sx        = snode->XCoords();
-    double                                                mindist   = 1.0e+20;
-    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
-
     // find a node on the master side, that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
-    for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
-      Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
-      double const*                                         mx    = mnode->XCoords();
-
-      // build distance | mnode->XCoords() - snode->XCoords() |
-      double dist = 0.0;
-      for (int i = 0; i < 3; ++i) dist += (mx[i] - sx[i]) * (mx[i] - sx[i]);
-      dist = sqrt(dist);
-      if (dist <= mindist) {
-        mindist   = dist;
-        closenode = mnode;
-      }
-      // std::cout << "snode " << snode->Id() << " mnode " << mnode->Id() << "
-      // mindist " << mindist  << " dist " << dist << std::endl;
-    }
+    Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = ClosestNode(mside, snode->XCoords().data(), true);
     if (closenode == Teuchos::null) {
       std::stringstream oss;
       oss << "***ERR*** "
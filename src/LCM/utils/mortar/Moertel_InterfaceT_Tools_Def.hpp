@@ -25,6 +25,7 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::InterfaceT(int Id, bool oneD, cons
       primal_(MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::func_none),
       dual_(MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::func_none)
 {
+  maxsegdiam_[0] = maxsegdiam_[1] = 0.0;
   return;
 }
 
@@ -1056,9 +1057,112 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BuildNodeSegmentTopology()
   for (int side = 0; side < 2; ++side) {
     for (scurr = rseg_[side].begin(); scurr != rseg_[side].end(); ++scurr) scurr->second->GetPtrstoNodes(*this);
   }
+
+  // the search trees need the node pointers of the segments
+  BuildSearchTrees();
+
   return true;
 }
 
+/*----------------------------------------------------------------------*
+ | (re)build the bounding box trees over redundant nodes and segments   |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool
+MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BuildSearchTrees()
+{
+  for (int side = 0; side < 2; ++side) {
+    // nodes are boxes of zero extent
+    rnodevec_[side].clear();
+    std::vector<MoertelT::BoundingBoxTree::Box>                                     nodeboxes;
+    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+    for (ncurr = rnode_[side].begin(); ncurr != rnode_[side].end(); ++ncurr) {
+      double const* x = ncurr->second->XCoords().data();
+      rnodevec_[side].push_back(ncurr->second);
+      nodeboxes.push_back(MoertelT::BoundingBoxTree::Enclose(&x, 1));
+    }
+    nodetree_[side] = MoertelT::BoundingBoxTree(nodeboxes);
+
+    // segments are enclosed by the box of their nodes
+    rsegvec_[side].clear();
+    rsegdiam_[side].clear();
+    maxsegdiam_[side] = 0.0;
+    std::vector<MoertelT::BoundingBoxTree::Box>                                       segboxes;
+    std::vector<double const*>                                                        x;
+    std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
+    for (scurr = rseg_[side].begin(); scurr != rseg_[side].end(); ++scurr) {
+      int const nnode                                 = scurr->second->Nnode();
+      MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = scurr->second->Nodes();
+      x.resize(nnode);
+      for (int i = 0; i < nnode; ++i) x[i] = nodes[i]->XCoords().data();
+      MoertelT::BoundingBoxTree::Box const box  = MoertelT::BoundingBoxTree::Enclose(x.data(), nnode);
+      double const                         diam = MoertelT::BoundingBoxTree::Diagonal(box);
+      rsegvec_[side].push_back(scurr->second);
+      rsegdiam_[side].push_back(diam);
+      maxsegdiam_[side] = std::max(maxsegdiam_[side], diam);
+      segboxes.push_back(box);
+    }
+    segtree_[side] = MoertelT::BoundingBoxTree(segboxes);
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | move nodes and reset them for re-integration                         |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool
+MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::MoveNodes(std::map<int, std::array<double, 3>> const& x)
+{
+  if (!IsComplete()) {
+    std::stringstream oss;
+    oss << "***ERR*** MoertelT::InterfaceT::MoveNodes:\n"
+        << "***ERR*** Interface " << Id() << ": Complete() not called\n"
+        << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+    throw MoertelT::ReportError(oss);
+  }
+  if (lcomm_ == Teuchos::null) return true;
+
+  // local and redundant nodes may be distinct objects, move both
+  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>* nodemaps[4] = {&node_[0], &node_[1], &rnode_[0], &rnode_[1]};
+  for (int i = 0; i < 4; ++i) {
+    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+    for (ncurr = nodemaps[i]->begin(); ncurr != nodemaps[i]->end(); ++ncurr) {
+      Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> node = ncurr->second;
+
+      // the Lagrange multiplier dofs do not depend on the configuration
+      std::vector<int> lmdofs;
+      if (node->Nlmdof() > 0) lmdofs.assign(node->LMDof(), node->LMDof() + node->Nlmdof());
+      node->Reset();
+      for (int k = 0; k < (int)lmdofs.size(); ++k) node->SetLagrangeMultiplierId(lmdofs[k]);
+
+      std::map<int, std::array<double, 3>>::const_iterator xcurr = x.find(node->Id());
+      if (xcurr == x.end()) continue;
+      auto coords = node->XCoords();
+      for (int d = 0; d < (int)coords.size(); ++d) coords[d] = xcurr->second[d];
+      node->SetX(coords);
+    }
+  }
+
+  // the search trees hold the coordinates of nodes and segments
+  BuildSearchTrees();
+
+  isIntegrated_ = false;
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | find the node of a side closest to x                                 |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>
+MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ClosestNode(int side, double const* x, bool last_on_tie) const
+{
+  int const pos = nodetree_[side].Nearest(x, last_on_tie);
+  if (pos < 0) return Teuchos::null;
+  return rnodevec_[side][pos];
+}
+
 /*----------------------------------------------------------------------*
  | set lagrange multiplier dofs starting from minLMGID                  |
  | to all slave nodes or segments that have a projection                |
@@ -160,6 +160,22 @@ class ManagerT
     return interface_.size();
   }
 
+  /*!
+  \brief Returns a view of the interface with id Id
+
+  The view is of the copy stored in this class, so nodes moved through it are
+  seen by subsequent integrations. Returns Teuchos::null if there is no such
+  interface.
+
+  */
+  Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)>
+  GetInterface(int Id)
+  {
+    typename std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)>>::iterator curr = interface_.find(Id);
+    if (curr == interface_.end()) return Teuchos::null;
+    return curr->second;
+  }
+
   /*!
   \brief Print all information stored in this class to stdout
 
@@ -141,7 +141,7 @@ class NodeT
   this node
 
   */
-  inline const std::array<ST, DIM>
+  inline const std::array<ST, DIM>&
   XCoords() const
   {
     return x_;
@@ -0,0 +1,231 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef MOERTEL_SEARCHT_HPP
+#define MOERTEL_SEARCHT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/*!
+\brief MoertelT: namespace of the Moertel package
+*/
+namespace MoertelT {
+
+/*!
+\class BoundingBoxTree
+
+\brief <b> A bounding volume hierarchy of axis-aligned boxes </b>
+
+The tree is built once over a set of boxes identified by their position in
+the input vector. Nodes are stored as boxes of zero extent. It answers two
+kinds of queries:
+- all boxes that overlap a given box, in ascending order of their position
+- the box closest to a given point, which for nodes is the closest node
+
+It replaces the linear searches over all nodes or segments of an interface
+side by a search that visits only the branches close to the query.
+
+*/
+class BoundingBoxTree
+{
+ public:
+  struct Box
+  {
+    double min[3];
+    double max[3];
+  };
+
+  BoundingBoxTree() {}
+
+  explicit BoundingBoxTree(std::vector<Box> const& boxes) : boxes_(boxes), index_(boxes.size())
+  {
+    for (int i = 0; i < (int)index_.size(); ++i) index_[i] = i;
+    if (!boxes_.empty()) Build(0, (int)index_.size());
+  }
+
+  //! Returns true if the tree holds no boxes
+  bool
+  Empty() const
+  {
+    return boxes_.empty();
+  }
+
+  //! Box enclosing the points x[0], ..., x[n-1], each of dimension 3
+  static Box
+  Enclose(double const* const* x, int n)
+  {
+    Box box;
+    for (int d = 0; d < 3; ++d) {
+      box.min[d] = std::numeric_limits<double>::max();
+      box.max[d] = -std::numeric_limits<double>::max();
+    }
+    for (int i = 0; i < n; ++i)
+      for (int d = 0; d < 3; ++d) {
+        box.min[d] = std::min(box.min[d], x[i][d]);
+        box.max[d] = std::max(box.max[d], x[i][d]);
+      }
+    return box;
+  }
+
+  //! Length of the diagonal of a box
+  static double
+  Diagonal(Box const& box)
+  {
+    double diag = 0.0;
+    for (int d = 0; d < 3; ++d) diag += (box.max[d] - box.min[d]) * (box.max[d] - box.min[d]);
+    return std::sqrt(diag);
+  }
+
+  //! Distance between two boxes, zero if they overlap
+  static double
+  Distance(Box const& a, Box const& b)
+  {
+    double dist = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      double const gap = std::max(0.0, std::max(a.min[d] - b.max[d], b.min[d] - a.max[d]));
+      dist += gap * gap;
+    }
+    return std::sqrt(dist);
+  }
+
+  /*!
+  \brief Collect the boxes within distance dist of box
+
+  The positions of the boxes found are appended to found in ascending order.
+  */
+  void
+  Near(Box const& box, double dist, std::vector<int>& found) const
+  {
+    std::size_t const first = found.size();
+    if (!boxes_.empty()) Near(0, box, dist, found);
+    std::sort(found.begin() + first, found.end());
+  }
+
+  /*!
+  \brief Position of the box closest to point x
+
+  Ties are resolved in favor of the last box if last_on_tie is true and in
+  favor of the first box otherwise, which mimics a linear search with
+  '<=' or '<' respectively. Returns -1 if the tree is empty.
+  */
+  int
+  Nearest(double const* x, bool last_on_tie) const
+  {
+    int    best      = -1;
+    double bestdist2 = std::numeric_limits<double>::max();
+    if (!boxes_.empty()) Nearest(0, x, last_on_tie, best, bestdist2);
+    return best;
+  }
+
+ private:
+  struct TreeNode
+  {
+    Box box;
+    int begin;
+    int end;
+    int left;
+    int right;
+  };
+
+  static int const leaf_size_ = 4;
+
+  static double
+  Distance2(Box const& box, double const* x)
+  {
+    double dist2 = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      double const gap = std::max(0.0, std::max(box.min[d] - x[d], x[d] - box.max[d]));
+      dist2 += gap * gap;
+    }
+    return dist2;
+  }
+
+  // build the subtree over index_[begin, end) and return its position
+  int
+  Build(int begin, int end)
+  {
+    int const node = (int)nodes_.size();
+    nodes_.push_back(TreeNode());
+
+    Box box;
+    for (int d = 0; d < 3; ++d) {
+      box.min[d] = std::numeric_limits<double>::max();
+      box.max[d] = -std::numeric_limits<double>::max();
+    }
+    for (int i = begin; i < end; ++i)
+      for (int d = 0; d < 3; ++d) {
+        box.min[d] = std::min(box.min[d], boxes_[index_[i]].min[d]);
+        box.max[d] = std::max(box.max[d], boxes_[index_[i]].max[d]);
+      }
+
+    int left = -1, right = -1;
+    if (end - begin > leaf_size_) {
+      // split at the median of the box centers along the longest axis
+      int axis = 0;
+      for (int d = 1; d < 3; ++d)
+        if (box.max[d] - box.min[d] > box.max[axis] - box.min[axis]) axis = d;
+      int const middle = begin + (end - begin) / 2;
+      std::nth_element(index_.begin() + begin, index_.begin() + middle, index_.begin() + end, [&](int a, int b) {
+        return boxes_[a].min[axis] + boxes_[a].max[axis] < boxes_[b].min[axis] + boxes_[b].max[axis];
+      });
+      left  = Build(begin, middle);
+      right = Build(middle, end);
+    }
+
+    nodes_[node].box   = box;
+    nodes_[node].begin = begin;
+    nodes_[node].end   = end;
+    nodes_[node].left  = left;
+    nodes_[node].right = right;
+    return node;
+  }
+
+  void
+  Near(int node, Box const& box, double dist, std::vector<int>& found) const
+  {
+    TreeNode const& tnode = nodes_[node];
+    if (Distance(tnode.box, box) > dist) return;
+    if (tnode.left < 0) {
+      for (int i = tnode.begin; i < tnode.end; ++i)
+        if (Distance(boxes_[index_[i]], box) <= dist) found.push_back(index_[i]);
+      return;
+    }
+    Near(tnode.left, box, dist, found);
+    Near(tnode.right, box, dist, found);
+  }
+
+  void
+  Nearest(int node, double const* x, bool last_on_tie, int& best, double& bestdist2) const
+  {
+    TreeNode const& tnode = nodes_[node];
+    if (Distance2(tnode.box, x) > bestdist2) return;
+    if (tnode.left < 0) {
+      for (int i = tnode.begin; i < tnode.end; ++i) {
+        int const    pos   = index_[i];
+        double const dist2 = Distance2(boxes_[pos], x);
+        if (dist2 < bestdist2 || (dist2 == bestdist2 && (last_on_tie ? pos > best : pos < best))) {
+          best      = pos;
+          bestdist2 = dist2;
+        }
+      }
+      return;
+    }
+    // visit the closer child first
+    int first = tnode.left, second = tnode.right;
+    if (Distance2(nodes_[second].box, x) < Distance2(nodes_[first].box, x)) std::swap(first, second);
+    Nearest(first, x, last_on_tie, best, bestdist2);
+    Nearest(second, x, last_on_tie, best, bestdist2);
+  }
+
+  std::vector<Box>      boxes_;
+  std::vector<int>      index_;
+  std::vector<TreeNode> nodes_;
+};
+
+}  // namespace MoertelT
+
+#endif  // MOERTEL_SEARCHT_HPP
@@ -12,15 +12,8 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 
-#include <boost/config.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/iteration_macros.hpp>
-#include <boost/graph/properties.hpp>
-#include <boost/lexical_cast.hpp>
-#include <boost/numeric/conversion/cast.hpp>
-#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <fstream>
 #include <iostream>
@@ -32,63 +25,44 @@
 
 namespace LCM {
 
+namespace {
+
+PointKdTree
+buildPointTree(Topology& topology, stk::mesh::EntityVector const& nodes)
+{
+  std::vector<PointKdTree::Point> points(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    double const* const xyz = topology.getEntityCoordinates(nodes[i]);
+    points[i]               = {{xyz[0], xyz[1], xyz[2]}};
+  }
+  return PointKdTree(points);
+}
+
+std::vector<stk::mesh::Entity>
+closestNodes(PointKdTree const& tree, stk::mesh::EntityVector const& nodes, std::vector<std::vector<double>> const& points)
+{
+  std::vector<stk::mesh::Entity> closest;
+  for (int i = 0; i < 3; ++i) {
+    closest.push_back(nodes[tree.nearest({{points[i][0], points[i][1], points[i][2]}})]);
+  }
+  return closest;
+}
+
+}  // anonymous namespace
+
 // \brief Finds the closest nodes(Entities of rank 0) to each of the
 // three points in the input vector
 std::vector<stk::mesh::Entity>
 Topology::getClosestNodes(std::vector<std::vector<double>> points)
 {
-  std::vector<stk::mesh::Entity> closestNodes;
-  stk::mesh::Entity              nodeA;
-  stk::mesh::Entity              nodeB;
-  stk::mesh::Entity              nodeC;
-  std::vector<double>            pointA, pointB, pointC;
-  double                         minDA, minDB, minDC;
-
-  std::vector<stk::mesh::Entity> entities_D0 = get_rank_entities(get_bulk_data(),
-                                                                 stk::topology::NODE_RANK);  // get all the nodes
-
-  // iterator for the nodes
-  std::vector<stk::mesh::Entity>::const_iterator i_entities_d0;
-
-  // Before iterate, it is necessary to have a distance with which it
-  // is possible to compare the new distances to.
-  nodeA = entities_D0[0];
-  minDA = getDistanceNodeAndPoint(entities_D0[0], points[0]);
-
-  nodeB = entities_D0[0];
-  minDB = getDistanceNodeAndPoint(entities_D0[0], points[1]);
-
-  nodeC = entities_D0[0];
-  minDC = getDistanceNodeAndPoint(entities_D0[0], points[2]);
-
-  // For each of the nodes calculate distance from point1, point 2,
-  // point 3 if any distance is less than the min distance to that
-  // point update the min distance and the closest node for that point
-  for (i_entities_d0 = entities_D0.begin(); i_entities_d0 != entities_D0.end(); ++i_entities_d0) {
-    // adist is the distance between the current node and the first
-    // point, point A.
-    double aDist = getDistanceNodeAndPoint(*i_entities_d0, points[0]);
-    if (aDist < minDA) {
-      nodeA = *i_entities_d0;
-      minDA = aDist;
-    }
-
-    double bDist = getDistanceNodeAndPoint(*i_entities_d0, points[1]);
-    if (bDist < minDB) {
-      nodeB = *i_entities_d0;
-      minDB = bDist;
-    }
-
-    double cDist = getDistanceNodeAndPoint(*i_entities_d0, points[2]);
-    if (cDist < minDC) {
-      nodeC = *i_entities_d0;
-      minDC = cDist;
-    }
+  // The k-d tree over all the nodes is built on first use and kept until
+  // the mesh is modified.
+  if (node_tree_.empty() == true) {
+    search_nodes_ = get_rank_entities(get_bulk_data(), stk::topology::NODE_RANK);
+    node_tree_    = buildPointTree(*this, search_nodes_);
   }
-  closestNodes.push_back(nodeA);
-  closestNodes.push_back(nodeB);
-  closestNodes.push_back(nodeC);
-  return closestNodes;
+
+  return closestNodes(node_tree_, search_nodes_, points);
 }
 
 // \brief Finds the closest nodes(Entities of rank 0) to each
@@ -97,102 +71,14 @@ Topology::getClosestNodes(std::vector<std::vector<double>> points)
 std::vector<stk::mesh::Entity>
 Topology::getClosestNodesOnSurface(std::vector<std::vector<double>> points)
 {
-  // Obtain all the nodes that lie over the surface
-  // Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = get_rank_entities(get_bulk_data(), stk::topology::FACE_RANK);
-
-  // Find the faces (Entities of rank 2) that build the boundary of
-  // the given mesh
-  std::vector<stk::mesh::Entity>                 BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    // If the number of boundary entities of rank 3 is 1 then, this is
-    // a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
-  }
-
-  // Obtain the Edges that belong to the Boundary Faces delete the
-  // repeated edges
-  std::vector<stk::mesh::Entity>                 MeshEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin(); I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(*I_BoundaryFaces, stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end(); I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
-        MeshEdges.push_back(*I_Edges);
-      }
-    }
-  }
-
-  // Obtain the nodes that lie on the surface
-  // This vector contains all the nodes that lie on the surface
-  std::vector<stk::mesh::Entity> entities_D0;
-  for (unsigned int i = 0; i < MeshEdges.size(); ++i) {
-    std::vector<stk::mesh::Entity> EdgeBoundaryNodes;
-    EdgeBoundaryNodes = getDirectlyConnectedEntities(MeshEdges[i], stk::topology::NODE_RANK);
-    for (unsigned int i = 0; i < EdgeBoundaryNodes.size(); i++) {
-      if (findEntityInVector(entities_D0, EdgeBoundaryNodes[i]) == false) {
-        entities_D0.push_back(EdgeBoundaryNodes[i]);
-      }
-    }
+  // The surface nodes, their k-d tree and the surface edge graph are
+  // built on first use and kept until the mesh is modified.
+  if (surface_tree_.empty() == true) {
+    buildEdgeGraph(meshEdgesShortestPath(), surface_nodes_, surface_graph_);
+    surface_tree_ = buildPointTree(*this, surface_nodes_);
   }
 
-  std::vector<stk::mesh::Entity> closestNodes;
-  stk::mesh::Entity              nodeA;
-  stk::mesh::Entity              nodeB;
-  stk::mesh::Entity              nodeC;
-  std::vector<double>            pointA, pointB, pointC;
-  double                         minDA, minDB, minDC;
-
-  // iterator for the nodes
-  std::vector<stk::mesh::Entity>::const_iterator i_entities_d0;
-
-  // Before iterate, it is necessary to have a distance with which it
-  // is possible to compare the new distances to.
-  nodeA = entities_D0[0];
-  minDA = getDistanceNodeAndPoint(entities_D0[0], points[0]);
-
-  nodeB = entities_D0[0];
-  minDB = getDistanceNodeAndPoint(entities_D0[0], points[1]);
-
-  nodeC = entities_D0[0];
-  minDC = getDistanceNodeAndPoint(entities_D0[0], points[2]);
-
-  // For each of the nodes
-  // calculate distance from point1, point 2, point 3
-  // if any distance is less than the min distance to that point
-  // update the min distance and the closest node for that point
-  for (i_entities_d0 = entities_D0.begin(); i_entities_d0 != entities_D0.end(); ++i_entities_d0) {
-    // adist is the distance between the current node and the first
-    // point, point A.
-    double aDist = getDistanceNodeAndPoint(*i_entities_d0, points[0]);
-    if (aDist < minDA) {
-      nodeA = *i_entities_d0;
-      minDA = aDist;
-    }
-
-    double bDist = getDistanceNodeAndPoint(*i_entities_d0, points[1]);
-    if (bDist < minDB) {
-      nodeB = *i_entities_d0;
-      minDB = bDist;
-    }
-
-    double cDist = getDistanceNodeAndPoint(*i_entities_d0, points[2]);
-    if (cDist < minDC) {
-      nodeC = *i_entities_d0;
-      minDC = cDist;
-    }
-  }
-  closestNodes.push_back(nodeA);
-  closestNodes.push_back(nodeB);
-  closestNodes.push_back(nodeC);
-
-  return closestNodes;
+  return closestNodes(surface_tree_, surface_nodes_, points);
 }
 
 // \brief calculates the distance between a node and a point
@@ -484,352 +370,101 @@ Topology::getCoordinatesOfMaxAndMin()
 std::vector<stk::mesh::Entity>
 Topology::meshEdgesShortestPath()
 {
-  // Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = get_rank_entities(get_bulk_data(), stk::topology::FACE_RANK);
+  stk::mesh::BulkData& bulk_data = get_bulk_data();
 
-  // Find the faces (Entities of rank 2) that build the boundary of the
-  // given mesh
-  std::vector<stk::mesh::Entity>                 BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    // If the number of boundary entities of rank 3 is 1
-    // then, this is a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
-  }
+  // Obtain all the faces of the mesh
+  std::vector<stk::mesh::Entity> MeshFaces = get_rank_entities(bulk_data, stk::topology::FACE_RANK);
 
-  // Obtain the Edges that belong to the Boundary Faces
-  // delete the repeated edges
-  std::vector<stk::mesh::Entity>                 MeshEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin(); I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(*I_BoundaryFaces, stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end(); I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
-        MeshEdges.push_back(*I_Edges);
-      }
-    }
+  // Obtain the Edges that belong to the Boundary Faces, i.e. faces
+  // connected to a single element. Repeated edges are removed at the end.
+  std::vector<stk::mesh::Entity> MeshEdges;
+  for (auto const face : MeshFaces) {
+    if (bulk_data.num_elements(face) != 1) continue;
+    stk::mesh::Entity const* edges = bulk_data.begin_edges(face);
+    MeshEdges.insert(MeshEdges.end(), edges, edges + bulk_data.num_edges(face));
   }
+  std::sort(MeshEdges.begin(), MeshEdges.end());
+  MeshEdges.erase(std::unique(MeshEdges.begin(), MeshEdges.end()), MeshEdges.end());
 
   return MeshEdges;
 }
 
-// \brief Returns the shortest path over the boundary faces given
-//        three input nodes and the edges that belong to the outer
-//        surface
-std::vector<std::vector<int>>
-Topology::shortestpathOnBoundaryFaces(std::vector<stk::mesh::Entity> const& nodes, std::vector<stk::mesh::Entity> const& MeshEdgesShortestPath)
+// \brief Builds the graph of the given mesh edges
+void
+Topology::buildEdgeGraph(stk::mesh::EntityVector const& edges, stk::mesh::EntityVector& vertices, WeightedGraph& graph)
 {
-  typedef float                                              Weight;
-  typedef boost::property<boost::edge_weight_t, Weight>      WeightProperty;
-  typedef boost::property<boost::vertex_name_t, std::string> NameProperty;
-
-  typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS, NameProperty, WeightProperty> Graph;
+  stk::mesh::BulkData& bulk_data = get_bulk_data();
 
-  typedef boost::graph_traits<Graph>::vertex_descriptor Vertex;
-
-  typedef boost::property_map<Graph, boost::vertex_index_t>::type IndexMap;
-  typedef boost::property_map<Graph, boost::vertex_name_t>::type  NameMap;
-
-  typedef boost::iterator_property_map<Vertex*, IndexMap, Vertex, Vertex&> PredecessorMap;
-
-  typedef boost::iterator_property_map<Weight*, IndexMap, Weight, Weight&> DistanceMap;
-
-  // Define the input graph
-  Graph g;
-
-  // Add the edges weights to the graph
-  for (unsigned int i = 0; i < MeshEdgesShortestPath.size(); ++i) {
-    std::vector<stk::mesh::Entity> EdgeBoundaryNodes;
-    EdgeBoundaryNodes = getDirectlyConnectedEntities(MeshEdgesShortestPath[i], stk::topology::NODE_RANK);
-    Weight weight(getDistanceBetweenNodes(EdgeBoundaryNodes[0], EdgeBoundaryNodes[1]));
-    boost::add_edge(get_entity_id(EdgeBoundaryNodes[0]) - 1, get_entity_id(EdgeBoundaryNodes[1]) - 1, weight, g);
+  vertices.clear();
+  for (auto const edge : edges) {
+    stk::mesh::Entity const* nodes = bulk_data.begin_nodes(edge);
+    vertices.insert(vertices.end(), nodes, nodes + 2);
   }
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
 
-  // Create predecessors and distances vectors
-  // Defined to save parents
-  std::vector<Vertex> predecessors(boost::num_vertices(g));
-  // Defined to save distances
-  std::vector<Weight> distances(boost::num_vertices(g));
-
-  IndexMap       indexMap = boost::get(boost::vertex_index, g);
-  PredecessorMap predecessorMap(&predecessors[0], indexMap);
-  DistanceMap    distanceMap(&distances[0], indexMap);
+  auto vertex_of = [&](stk::mesh::Entity node) { return static_cast<int>(std::lower_bound(vertices.begin(), vertices.end(), node) - vertices.begin()); };
 
-  // NOTE: The dijkstra_shortest_paths function returns the nodes
-  // corresponding to the shortest path starting from the end node to
-  // the start node
-  // Compute the  shortest path between nodes[0] and nodes[1]
-
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_0 = get_entity_id(nodes[1]) - 1;
-  Vertex goalVertex_0   = get_entity_id(nodes[0]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_0, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_0;
-
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_0 = goalVertex_0;
-  while (currentVertex_0 != sourceVertex_0) {
-    ShortestPath_0.push_back(currentVertex_0);
-    currentVertex_0 = predecessorMap[currentVertex_0];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_0.push_back(sourceVertex_0);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_0;
-  std::vector<unsigned long int>::const_iterator I_points0;
-  for (I_points0 = ShortestPath_0.begin(); I_points0 != ShortestPath_0.end(); ++I_points0) {
-    int i = boost::numeric_cast<int>(*I_points0);
-    FV_0.push_back(i);
-  }
-  // Define the vector that holds the shortest path
-  std::vector<std::vector<int>> ShortestPathFinal;
-  ShortestPathFinal.push_back(FV_0);
-
-  // Compute the  shortest path between nodes[1] and nodes[2]
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_1 = get_entity_id(nodes[2]) - 1;
-  Vertex goalVertex_1   = get_entity_id(nodes[1]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_1, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_1;
-
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_1 = goalVertex_1;
-  while (currentVertex_1 != sourceVertex_1) {
-    ShortestPath_1.push_back(currentVertex_1);
-    currentVertex_1 = predecessorMap[currentVertex_1];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_1.push_back(sourceVertex_1);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_1;
-  std::vector<unsigned long int>::const_iterator I_points1;
-  for (I_points1 = ShortestPath_1.begin(); I_points1 != ShortestPath_1.end(); ++I_points1) {
-    int i = boost::numeric_cast<int>(*I_points1);
-    FV_1.push_back(i);
+  std::vector<std::array<int, 2>> graph_edges(edges.size());
+  std::vector<float>              weights(edges.size());
+  for (size_t i = 0; i < edges.size(); ++i) {
+    stk::mesh::Entity const* nodes = bulk_data.begin_nodes(edges[i]);
+    graph_edges[i]                 = {{vertex_of(nodes[0]), vertex_of(nodes[1])}};
+    weights[i]                     = getDistanceBetweenNodes(nodes[0], nodes[1]);
   }
-  ShortestPathFinal.push_back(FV_1);
 
-  // Compute the  shortest path between nodes[2] and nodes[0]
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_2 = get_entity_id(nodes[0]) - 1;
-  Vertex goalVertex_2   = get_entity_id(nodes[2]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_2, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_2;
+  graph = WeightedGraph(vertices.size(), graph_edges, weights);
+}
 
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_2 = goalVertex_2;
-  while (currentVertex_2 != sourceVertex_2) {
-    ShortestPath_2.push_back(currentVertex_2);
-    currentVertex_2 = predecessorMap[currentVertex_2];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_2.push_back(sourceVertex_2);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_2;
-  std::vector<unsigned long int>::const_iterator I_points2;
-  for (I_points2 = ShortestPath_2.begin(); I_points2 != ShortestPath_2.end(); ++I_points2) {
-    int i = boost::numeric_cast<int>(*I_points2);
-    FV_2.push_back(i);
-  }
-  ShortestPathFinal.push_back(FV_2);
+// \brief Shortest paths between the three input nodes on an edge graph
+std::vector<std::vector<int>>
+Topology::shortestPathSegments(WeightedGraph const& graph, stk::mesh::EntityVector const& vertices, std::vector<stk::mesh::Entity> const& nodes)
+{
+  auto vertex_of = [&](stk::mesh::Entity node) {
+    auto it = std::lower_bound(vertices.begin(), vertices.end(), node);
+    ALBANY_ASSERT(it != vertices.end() && *it == node, "Node " << get_entity_id(node) << " is not on the edge graph");
+    return static_cast<int>(it - vertices.begin());
+  };
 
   std::vector<std::vector<int>> ShortestPathOutput;
 
+  // Paths nodes[1] -> nodes[0], nodes[2] -> nodes[1] and nodes[0] ->
+  // nodes[2]. Vertices of each path go from goal to source.
   for (int j = 0; j < 3; j++) {
-    for (unsigned int k = 0; k < (ShortestPathFinal[j].size() - 1); k++) {
+    std::vector<int> const path = graph.shortestPath(vertex_of(nodes[(j + 1) % 3]), vertex_of(nodes[j]));
+    for (size_t k = 0; k + 1 < path.size(); k++) {
       std::vector<int> temp;
-      temp.push_back((ShortestPathFinal[j][k]) + 1);
-      temp.push_back((ShortestPathFinal[j][k + 1]) + 1);
+      temp.push_back(get_entity_id(vertices[path[k]]));
+      temp.push_back(get_entity_id(vertices[path[k + 1]]));
       ShortestPathOutput.push_back(temp);
     }
   }
   return ShortestPathOutput;
 }
 
+// \brief Returns the shortest path over the boundary faces given
+//        three input nodes and the edges that belong to the outer
+//        surface
+std::vector<std::vector<int>>
+Topology::shortestpathOnBoundaryFaces(std::vector<stk::mesh::Entity> const& nodes, std::vector<stk::mesh::Entity> const& MeshEdgesShortestPath)
+{
+  stk::mesh::EntityVector vertices;
+  WeightedGraph           graph;
+  buildEdgeGraph(MeshEdgesShortestPath, vertices, graph);
+  return shortestPathSegments(graph, vertices, nodes);
+}
+
 // \brief Returns the shortest path between three input nodes
 std::vector<std::vector<int>>
 Topology::shortestpath(std::vector<stk::mesh::Entity> const& nodes)
 {
-  typedef float                                              Weight;
-  typedef boost::property<boost::edge_weight_t, Weight>      WeightProperty;
-  typedef boost::property<boost::vertex_name_t, std::string> NameProperty;
-
-  typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS, NameProperty, WeightProperty> Graph;
-
-  typedef boost::graph_traits<Graph>::vertex_descriptor Vertex;
-
-  typedef boost::property_map<Graph, boost::vertex_index_t>::type IndexMap;
-  typedef boost::property_map<Graph, boost::vertex_name_t>::type  NameMap;
-
-  typedef boost::iterator_property_map<Vertex*, IndexMap, Vertex, Vertex&> PredecessorMap;
-
-  typedef boost::iterator_property_map<Weight*, IndexMap, Weight, Weight&> DistanceMap;
-
-  // Define the input graph
-  Graph g;
-
-  // Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = get_rank_entities(get_bulk_data(), stk::topology::FACE_RANK);
-
-  // Find the faces (Entities of rank 2) that build the boundary of the
-  // given mesh
-  std::vector<stk::mesh::Entity>                 BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    // If the number of boundary entities of rank 3 is 1
-    // then, this is a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
+  // The graph of the boundary edges is built on first use and reused by
+  // subsequent queries until the mesh is modified.
+  if (surface_graph_.num_vertices() == 0) {
+    buildEdgeGraph(meshEdgesShortestPath(), surface_nodes_, surface_graph_);
+    surface_tree_ = buildPointTree(*this, surface_nodes_);
   }
-
-  // Obtain the Edges that belong to the Boundary Faces
-  // delete the repeated edges
-  std::vector<stk::mesh::Entity>                 MeshEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin(); I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(*I_BoundaryFaces, stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end(); I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
-        MeshEdges.push_back(*I_Edges);
-      }
-    }
-  }
-
-  // Add the edges weights to the graph
-  for (unsigned int i = 0; i < MeshEdges.size(); ++i) {
-    std::vector<stk::mesh::Entity> EdgeBoundaryNodes;
-    EdgeBoundaryNodes = getDirectlyConnectedEntities(MeshEdges[i], stk::topology::NODE_RANK);
-    Weight weight(getDistanceBetweenNodes(EdgeBoundaryNodes[0], EdgeBoundaryNodes[1]));
-    boost::add_edge(get_entity_id(EdgeBoundaryNodes[0]) - 1, get_entity_id(EdgeBoundaryNodes[1]) - 1, weight,
-                    g);  //
-  }
-
-  // Create predecessors and distances vectors
-  // Defined to save parents
-  std::vector<Vertex> predecessors(boost::num_vertices(g));
-  // Defined to save distances
-  std::vector<Weight> distances(boost::num_vertices(g));
-
-  IndexMap       indexMap = boost::get(boost::vertex_index, g);
-  PredecessorMap predecessorMap(&predecessors[0], indexMap);
-  DistanceMap    distanceMap(&distances[0], indexMap);
-
-  // NOTE: The dijkstra_shortest_paths function returns the nodes
-  // corresponding to the shortest path starting from the end node to
-  // the start node
-  // Compute the  shortest path between nodes[0] and nodes[1]
-
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_0 = get_entity_id(nodes[1]) - 1;
-  Vertex goalVertex_0   = get_entity_id(nodes[0]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_0, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_0;
-
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_0 = goalVertex_0;
-  while (currentVertex_0 != sourceVertex_0) {
-    ShortestPath_0.push_back(currentVertex_0);
-    currentVertex_0 = predecessorMap[currentVertex_0];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_0.push_back(sourceVertex_0);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_0;
-  std::vector<unsigned long int>::const_iterator I_points0;
-  for (I_points0 = ShortestPath_0.begin(); I_points0 != ShortestPath_0.end(); ++I_points0) {
-    int i = boost::numeric_cast<int>(*I_points0);
-    FV_0.push_back(i);
-  }
-  // Define the vector that holds the shortest path
-  std::vector<std::vector<int>> ShortestPathFinal;
-  ShortestPathFinal.push_back(FV_0);
-
-  // Compute the  shortest path between nodes[1] and nodes[2]
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_1 = get_entity_id(nodes[2]) - 1;
-  Vertex goalVertex_1   = get_entity_id(nodes[1]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_1, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_1;
-
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_1 = goalVertex_1;
-  while (currentVertex_1 != sourceVertex_1) {
-    ShortestPath_1.push_back(currentVertex_1);
-    currentVertex_1 = predecessorMap[currentVertex_1];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_1.push_back(sourceVertex_1);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_1;
-  std::vector<unsigned long int>::const_iterator I_points1;
-  for (I_points1 = ShortestPath_1.begin(); I_points1 != ShortestPath_1.end(); ++I_points1) {
-    int i = boost::numeric_cast<int>(*I_points1);
-    FV_1.push_back(i);
-  }
-  ShortestPathFinal.push_back(FV_1);
-
-  // Compute the  shortest path between nodes[2] and nodes[0]
-  // Source from where the distance and path are calculated
-  Vertex sourceVertex_2 = get_entity_id(nodes[0]) - 1;
-  Vertex goalVertex_2   = get_entity_id(nodes[2]) - 1;
-  boost::dijkstra_shortest_paths(g, sourceVertex_2, boost::distance_map(distanceMap).predecessor_map(predecessorMap));
-
-  std::vector<boost::graph_traits<Graph>::vertex_descriptor> ShortestPath_2;
-
-  boost::graph_traits<Graph>::vertex_descriptor currentVertex_2 = goalVertex_2;
-  while (currentVertex_2 != sourceVertex_2) {
-    ShortestPath_2.push_back(currentVertex_2);
-    currentVertex_2 = predecessorMap[currentVertex_2];
-  }
-  // ShortestPath contains the shortest path between the given
-  // vertices.  Vertices are saved starting from end vertex to start
-  // vertex. The format of this output is "unsigned long int"
-  ShortestPath_2.push_back(sourceVertex_2);
-
-  // Change the format of the output from unsigned long int to int
-  std::vector<int>                               FV_2;
-  std::vector<unsigned long int>::const_iterator I_points2;
-  for (I_points2 = ShortestPath_2.begin(); I_points2 != ShortestPath_2.end(); ++I_points2) {
-    int i = boost::numeric_cast<int>(*I_points2);
-    FV_2.push_back(i);
-  }
-  ShortestPathFinal.push_back(FV_2);
-
-  std::vector<std::vector<int>> ShortestPathOutput;
-
-  for (int j = 0; j < 3; j++) {
-    for (unsigned int k = 0; k < (ShortestPathFinal[j].size() - 1); k++) {
-      std::vector<int> temp;
-      temp.push_back((ShortestPathFinal[j][k]) + 1);
-      temp.push_back((ShortestPathFinal[j][k + 1]) + 1);
-      ShortestPathOutput.push_back(temp);
-    }
-  }
-  return ShortestPathOutput;
+  return shortestPathSegments(surface_graph_, surface_nodes_, nodes);
 }
 
 // \brief Returns the directions of all the edges of the input mesh
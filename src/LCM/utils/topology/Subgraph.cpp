@@ -3,22 +3,18 @@
 // in the file license.txt in the top-level Albany directory.
 #include "Subgraph.hpp"
 
+#include <algorithm>
+
 #include "Topology.hpp"
 #include "Topology_Utils.hpp"
 
 namespace LCM {
 
 // Create a subgraph given a vertex list and an edge list.
-Subgraph::Subgraph(
-    Topology&                             topology,
-    std::set<stk::mesh::Entity>::iterator first_entity,
-    std::set<stk::mesh::Entity>::iterator last_entity,
-    std::set<STKEdge>::iterator           first_edge,
-    std::set<STKEdge>::iterator           last_edge)
-    : topology_(topology)
+Subgraph::Subgraph(Topology& topology, stk::mesh::EntityVector const& entities, std::vector<STKEdge> const& edges) : topology_(topology)
 {
   // Insert vertices and create the vertex map
-  for (std::set<stk::mesh::Entity>::iterator entity_iterator = first_entity; entity_iterator != last_entity; ++entity_iterator) {
+  for (auto entity_iterator = entities.begin(); entity_iterator != entities.end(); ++entity_iterator) {
     // get global vertex
     stk::mesh::Entity entity = *entity_iterator;
 
@@ -43,7 +39,7 @@ Subgraph::Subgraph(
   }
 
   // Add edges to the subgraph
-  for (std::set<STKEdge>::iterator edge_iterator = first_edge; edge_iterator != last_edge; ++edge_iterator) {
+  for (auto edge_iterator = edges.begin(); edge_iterator != edges.end(); ++edge_iterator) {
     // Get the edge
     STKEdge stk_edge = *edge_iterator;
 
@@ -197,20 +193,14 @@ Subgraph::addVertex(stk::mesh::EntityRank vertex_rank, stk::mesh::Entity entity)
   if (propagate_parts == true) {
     std::map<std::string, stk::mesh::Part*>& ns_parts = get_stk_mesh_struct()->nsPartVec;
 
-    stk::mesh::Selector select_local = stk::mesh::Selector(get_meta_data().locally_owned_part());
+    // Query the bucket of the entity directly instead of gathering all the
+    // local nodes of each node set.
+    stk::mesh::Bucket const& bucket = get_bulk_data().bucket(entity);
 
     for (auto it = ns_parts.begin(); it != ns_parts.end(); ++it) {
       stk::mesh::Part& ns_part = *(it->second);
 
-      stk::mesh::Selector select_in_nodeset = stk::mesh::Selector(ns_part);
-
-      stk::mesh::Selector select_local_in_nodeset = select_local & select_in_nodeset;
-
-      std::vector<stk::mesh::Entity> ns_nodes;
-
-      stk::mesh::get_selected_entities(select_local_in_nodeset, get_bulk_data().buckets(stk::topology::NODE_RANK), ns_nodes);
-
-      bool const is_local_and_in_nodeset = std::find(ns_nodes.begin(), ns_nodes.end(), entity) != ns_nodes.end();
+      bool const is_local_and_in_nodeset = bucket.owned() == true && bucket.member(ns_part) == true;
 
       if (is_local_and_in_nodeset == true) {
         add_parts.push_back(&ns_part);
@@ -335,36 +325,17 @@ Subgraph::getEdgeId(Edge const edge)
   return boost::get(edge_property_map, edge);
 }
 
-// Here we use the connected components algorithm, which requires
-// and undirected graph. These types are needed to build that graph
-// without the overhead that was used for the subgraph.
-// The adjacency list type must use a vector container for the vertices
-// so that they can be converted to indices to determine the components.
-typedef boost::adjacency_list<VectorS, VectorS, Undirected> UGraph;
-typedef boost::graph_traits<UGraph>::vertex_descriptor      UVertex;
-typedef boost::graph_traits<UGraph>::edge_descriptor        UEdge;
-
 namespace {
 
-void
-writeGraphviz(std::string const& output_filename, UGraph const& graph)
+// Root of a vertex index in a union-find forest, with path halving.
+size_t
+findRoot(std::vector<size_t>& parent, size_t i)
 {
-  // Open output file
-  std::ofstream gviz_out;
-
-  gviz_out.open(output_filename.c_str(), std::ios::out);
-
-  if (gviz_out.is_open() == false) {
-    std::cout << "Unable to open graphviz output file :";
-    std::cout << output_filename << '\n';
-    return;
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i         = parent[i];
   }
-
-  boost::write_graphviz(gviz_out, graph);
-
-  gviz_out.close();
-
-  return;
+  return i;
 }
 
 }  // anonymous namespace
@@ -374,12 +345,11 @@ writeGraphviz(std::string const& output_filename, UGraph const& graph)
 void
 Subgraph::testArticulationPoint(Vertex const articulation_vertex, size_t& number_components, VertexComponentMap& vertex_component_map)
 {
-  // Map to and from undirected graph and subgraph
-  std::map<UVertex, Vertex> u_sub_vertex_map;
-
-  std::map<Vertex, UVertex> sub_u_vertex_map;
-
-  UGraph graph;
+  // The vertices other than the articulation vertex are numbered by their
+  // position in the subgraph vertex list, and the connected components of
+  // the (undirected) graph without the articulation vertex are found with
+  // union-find on those indices.
+  std::vector<Vertex> vertices;
 
   VertexIterator vertex_begin;
 
@@ -387,72 +357,63 @@ Subgraph::testArticulationPoint(Vertex const articulation_vertex, size_t& number
 
   boost::tie(vertex_begin, vertex_end) = boost::vertices(*this);
 
-  // First add the vertices to the graph
   for (VertexIterator i = vertex_begin; i != vertex_end; ++i) {
-    Vertex vertex = *i;
-
-    // If this is the vertex that is subjected to the articulation point test
-    // skip it.
-    if (vertex == articulation_vertex) continue;
+    if (*i != articulation_vertex) vertices.push_back(*i);
+  }
 
-    UVertex uvertex = boost::add_vertex(graph);
+  size_t const number_vertices = vertices.size();
 
-    // Add to maps
-    std::pair<UVertex, Vertex> u_sub = std::make_pair(uvertex, vertex);
+  // Sorted (vertex, index) pairs to map vertices to indices.
+  std::vector<std::pair<Vertex, size_t>> vertex_index(number_vertices);
 
-    std::pair<Vertex, UVertex> sub_u = std::make_pair(vertex, uvertex);
+  for (size_t i = 0; i < number_vertices; ++i) vertex_index[i] = std::make_pair(vertices[i], i);
 
-    u_sub_vertex_map.insert(u_sub);
-    sub_u_vertex_map.insert(sub_u);
-  }
+  std::sort(vertex_index.begin(), vertex_index.end());
 
-  // Then add the edges
-  for (VertexIterator i = vertex_begin; i != vertex_end; ++i) {
-    Vertex source = *i;
+  auto index_of = [&](Vertex const vertex) {
+    auto it = std::lower_bound(vertex_index.begin(), vertex_index.end(), std::make_pair(vertex, size_t(0)));
+    assert(it != vertex_index.end() && it->first == vertex);
+    return it->second;
+  };
 
-    // If this is the vertex that is subjected to the articulation point test
-    // skip it.
-    if (source == articulation_vertex) continue;
+  std::vector<size_t> parent(number_vertices);
 
-    std::map<Vertex, UVertex>::const_iterator source_map_iterator = sub_u_vertex_map.find(source);
-
-    UVertex usource = (*source_map_iterator).second;
+  for (size_t i = 0; i < number_vertices; ++i) parent[i] = i;
 
+  for (size_t i = 0; i < number_vertices; ++i) {
     OutEdgeIterator out_edge_begin;
 
     OutEdgeIterator out_edge_end;
 
-    boost::tie(out_edge_begin, out_edge_end) = boost::out_edges(source, *this);
+    boost::tie(out_edge_begin, out_edge_end) = boost::out_edges(vertices[i], *this);
 
     for (OutEdgeIterator j = out_edge_begin; j != out_edge_end; ++j) {
-      Edge edge = *j;
-
-      Vertex target = boost::target(edge, *this);
+      Vertex target = boost::target(*j, *this);
 
       // If this is the vertex that is subjected to the articulation point test
       // skip it.
       if (target == articulation_vertex) continue;
 
-      std::map<Vertex, UVertex>::const_iterator target_map_iterator = sub_u_vertex_map.find(target);
+      size_t const root_source = findRoot(parent, i);
 
-      UVertex utarget = (*target_map_iterator).second;
+      size_t const root_target = findRoot(parent, index_of(target));
 
-      boost::add_edge(usource, utarget, graph);
+      if (root_source != root_target) parent[std::max(root_source, root_target)] = std::min(root_source, root_target);
     }
   }
 
-  std::vector<size_t> components(boost::num_vertices(graph));
-
-  number_components = boost::connected_components(graph, &components[0]);
+  // Number the components in order of their first vertex, as the boost
+  // connected components algorithm does.
+  std::vector<size_t> component_of_root(number_vertices, number_vertices);
 
-  for (std::map<UVertex, Vertex>::iterator i = u_sub_vertex_map.begin(); i != u_sub_vertex_map.end(); ++i) {
-    Vertex vertex = (*i).second;
+  number_components = 0;
 
-    size_t u_vertex = static_cast<size_t>((*i).first);
+  for (size_t i = 0; i < number_vertices; ++i) {
+    size_t const root = findRoot(parent, i);
 
-    std::pair<Vertex, size_t> component = std::make_pair(vertex, components[u_vertex]);
+    if (component_of_root[root] == number_vertices) component_of_root[root] = number_components++;
 
-    vertex_component_map.insert(component);
+    vertex_component_map.insert(std::make_pair(vertices[i], component_of_root[root]));
   }
 
   return;
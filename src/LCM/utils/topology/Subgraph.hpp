@@ -21,24 +21,16 @@ class Subgraph : public Graph
   /// \brief Create a subgraph given two vectors: a vertex list and
   ///        a edge list.
   ///
-  /// \param[in] bulkData for the stk mesh object
-  /// \param[in] start of the vertex list
-  /// \param[in] end of the vertex list
-  /// \param[in] start of the edge list
-  /// \param[in] end of the edge list
-  /// \param[in] number of dimensions in the analysis
+  /// \param[in] topology of the stk mesh object
+  /// \param[in] vertex list
+  /// \param[in] edge list
   ///
   /// Subgraph stored as a boost adjacency list.  Maps are created
   /// to associate the subgraph to the global stk mesh graph.  Any
   /// changes to the subgraph are automatically mirrored in the stk
   /// mesh.
   ///
-  Subgraph(
-      Topology&                             topology,
-      std::set<stk::mesh::Entity>::iterator first_entity,
-      std::set<stk::mesh::Entity>::iterator last_entity,
-      std::set<STKEdge>::iterator           first_edge,
-      std::set<STKEdge>::iterator           last_edge);
+  Subgraph(Topology& topology, stk::mesh::EntityVector const& entities, std::vector<STKEdge> const& edges);
 
   ///
   ///\brief Map a vertex in the subgraph to a entity in the stk mesh.
@@ -5,6 +5,7 @@
 
 #include <Albany_CommUtils.hpp>
 #include <Albany_STKNodeSharing.hpp>
+#include <algorithm>
 #include <stk_mesh/base/BulkData.hpp>
 #include <stk_mesh/base/FEMHelpers.hpp>
 #include <stk_mesh/base/FieldBase.hpp>
@@ -929,37 +930,70 @@ Topology::createSurfaceElementConnectivity(stk::mesh::Entity face_top, stk::mesh
 // Create vectors describing the vertices and edges of the star of
 // an entity in the stk mesh.
 void
-Topology::createStar(stk::mesh::Entity entity, std::set<stk::mesh::Entity>& subgraph_entities, std::set<STKEdge, EdgeLessThan>& subgraph_edges)
+Topology::createStar(stk::mesh::Entity entity, stk::mesh::EntityVector& subgraph_entities, std::vector<STKEdge>& subgraph_edges)
 {
-  subgraph_entities.insert(entity);
-
   assert(get_space_dimension() == 3);
 
-  stk::mesh::EntityRank const rank = get_bulk_data().entity_rank(entity);
+  stk::mesh::BulkData& bulk_data = get_bulk_data();
 
-  stk::mesh::EntityRank const one_up = static_cast<stk::mesh::EntityRank>(rank + 1);
+  subgraph_entities.clear();
+  subgraph_edges.clear();
 
-  stk::mesh::Entity const* relations = get_bulk_data().begin(entity, one_up);
+  // Entities are marked with the current epoch when first reached, so
+  // that marks never need to be cleared between stars.
+  ++star_epoch_;
+  if (star_epoch_ == 0) {
+    std::fill(star_marks_.begin(), star_marks_.end(), 0);
+    star_epoch_ = 1;
+  }
 
-  size_t const num_relations = get_bulk_data().num_connectivity(entity, one_up);
+  auto mark = [&](stk::mesh::Entity e) {
+    auto const offset = e.local_offset();
+    if (offset >= star_marks_.size()) star_marks_.resize(2 * offset + 1, 0);
+    bool const is_new   = star_marks_[offset] != star_epoch_;
+    star_marks_[offset] = star_epoch_;
+    return is_new;
+  };
 
-  stk::mesh::ConnectivityOrdinal const* ords = get_bulk_data().begin_ordinals(entity, one_up);
+  mark(entity);
+  subgraph_entities.push_back(entity);
 
-  for (size_t i = 0; i < num_relations; ++i) {
-    stk::mesh::Entity source = relations[i];
+  // Entities are appended as they are reached, so the list itself is the
+  // work queue of the traversal.
+  for (EntityVectorIndex k = 0; k < subgraph_entities.size(); ++k) {
+    stk::mesh::Entity const target = subgraph_entities[k];
+
+    stk::mesh::EntityRank const rank = bulk_data.entity_rank(target);
+
+    stk::mesh::EntityRank const one_up = static_cast<stk::mesh::EntityRank>(rank + 1);
+
+    stk::mesh::Entity const* relations = bulk_data.begin(target, one_up);
+
+    size_t const num_relations = bulk_data.num_connectivity(target, one_up);
 
-    if (is_interface_cell(source) == true) continue;
+    stk::mesh::ConnectivityOrdinal const* ords = bulk_data.begin_ordinals(target, one_up);
 
-    STKEdge edge;
+    for (size_t i = 0; i < num_relations; ++i) {
+      stk::mesh::Entity source = relations[i];
 
-    edge.source   = source;
-    edge.target   = entity;
-    edge.local_id = ords[i];
+      if (is_interface_cell(source) == true) continue;
 
-    subgraph_edges.insert(edge);
-    createStar(source, subgraph_entities, subgraph_edges);
+      STKEdge edge;
+
+      edge.source   = source;
+      edge.target   = target;
+      edge.local_id = ords[i];
+
+      // Each target is expanded once, so every edge is reached once.
+      subgraph_edges.push_back(edge);
+
+      if (mark(source) == true) subgraph_entities.push_back(source);
+    }
   }
 
+  std::sort(subgraph_entities.begin(), subgraph_entities.end());
+  std::sort(subgraph_edges.begin(), subgraph_edges.end(), EdgeLessThan());
+
   return;
 }
 
@@ -993,6 +1027,11 @@ Topology::splitOpenFaces()
     }
   }
 
+  // Star storage, reused for all the stars below.
+  stk::mesh::EntityVector star_entities;
+
+  std::vector<STKEdge> star_edges;
+
   modification_begin();
 
   // Iterate over open points and fracture them.
@@ -1025,22 +1064,9 @@ Topology::splitOpenFaces()
       stk::mesh::Entity segment = *j;
 
       // Create star of segment
-      std::set<stk::mesh::Entity> star_entities;
-
-      std::set<STKEdge, EdgeLessThan> star_edges;
-
       createStar(segment, star_entities, star_edges);
 
-      // Iterators
-      std::set<stk::mesh::Entity>::iterator first_entity = star_entities.begin();
-
-      std::set<stk::mesh::Entity>::iterator last_entity = star_entities.end();
-
-      std::set<STKEdge>::iterator first_edge = star_edges.begin();
-
-      std::set<STKEdge>::iterator last_edge = star_edges.end();
-
-      Subgraph segment_star(*this, first_entity, last_entity, first_edge, last_edge);
+      Subgraph segment_star(*this, star_entities, star_edges);
 
       // Collect open faces
       stk::mesh::Entity const* face_relations = bulk_data.begin_faces(segment);
@@ -1094,22 +1120,9 @@ Topology::splitOpenFaces()
     // All open faces and segments have been dealt with.
     // Split the node articulation point
     // Create star of node
-    std::set<stk::mesh::Entity> star_entities;
-
-    std::set<STKEdge, EdgeLessThan> star_edges;
-
     createStar(point, star_entities, star_edges);
 
-    // Iterators
-    std::set<stk::mesh::Entity>::iterator first_entity = star_entities.begin();
-
-    std::set<stk::mesh::Entity>::iterator last_entity = star_entities.end();
-
-    std::set<STKEdge>::iterator first_edge = star_edges.begin();
-
-    std::set<STKEdge>::iterator last_edge = star_edges.end();
-
-    Subgraph point_star(*this, first_entity, last_entity, first_edge, last_edge);
+    Subgraph point_star(*this, star_entities, star_edges);
 
     Vertex point_vertex = point_star.vertexFromEntity(point);
 
@@ -1196,64 +1209,94 @@ double
 Topology::erodeFailedElements()
 {
   auto const cell_rank     = stk::topology::ELEMENT_RANK;
-  auto const face_rank     = stk::topology::FACE_RANK;
-  auto const edge_rank     = stk::topology::EDGE_RANK;
-  auto const node_rank     = stk::topology::NODE_RANK;
   auto&      bulk_data     = get_bulk_data();
   auto&      meta_data     = get_meta_data();
   auto&      locally_owned = meta_data.locally_owned_part();
   double     eroded_volume = 0.0;
 
   assert(get_space_dimension() == cell_rank);
-  modification_begin();
 
-  // Collect and remove failed cells
-  auto const&             cell_buckets = bulk_data.buckets(cell_rank);
-  stk::mesh::EntityVector cells;
-  stk::mesh::get_selected_entities(locally_owned, cell_buckets, cells);
+  // Scan the failure state once for the failed cells.
   auto& bulk_failure_criterion      = static_cast<BulkFailureCriterion&>(*failure_criterion_);
   bulk_failure_criterion.accumulate = true;
-  for (auto cell : cells) {
-    if (failure_criterion_->check(bulk_data, cell) == true) {
-      auto cell_volume = getCellVolume(cell);
-      eroded_volume += cell_volume;
-      set_failure_state(cell, INTACT);
-      remove_entity_and_up_relations(cell);
-    }
-  }
+  stk::mesh::EntityVector cells;
+  bulk_failure_criterion.failedElements(bulk_data, cells);
   bulk_failure_criterion.accumulate = false;
 
-  auto const&             face_buckets = bulk_data.buckets(face_rank);
+  // Only the boundary entities of failed cells can become orphans.
   stk::mesh::EntityVector faces;
-  stk::mesh::get_selected_entities(locally_owned, face_buckets, faces);
-  for (auto face : faces) {
-    auto const num_elems = bulk_data.num_elements(face);
-    if (num_elems == 0) {
-      remove_entity_and_up_relations(face);
-    }
-  }
-  auto const&             edge_buckets = bulk_data.buckets(edge_rank);
   stk::mesh::EntityVector edges;
-  stk::mesh::get_selected_entities(locally_owned, edge_buckets, edges);
-  for (auto edge : edges) {
-    auto const num_elems = bulk_data.num_elements(edge);
-    auto const num_faces = bulk_data.num_faces(edge);
-    if (num_elems == 0 || num_faces == 0) {
-      remove_entity_and_up_relations(edge);
-    }
-  }
-  auto const&             node_buckets = bulk_data.buckets(node_rank);
   stk::mesh::EntityVector nodes;
-  stk::mesh::get_selected_entities(locally_owned, node_buckets, nodes);
-  for (auto node : nodes) {
-    auto const num_elems = bulk_data.num_elements(node);
-    auto const num_faces = bulk_data.num_faces(node);
-    auto const num_edges = bulk_data.num_edges(node);
-    if (num_elems == 0 || num_faces == 0 || num_edges == 0) {
-      remove_entity_and_up_relations(node);
+  for (auto cell : cells) {
+    faces.insert(faces.end(), bulk_data.begin_faces(cell), bulk_data.end_faces(cell));
+    edges.insert(edges.end(), bulk_data.begin_edges(cell), bulk_data.end_edges(cell));
+    nodes.insert(nodes.end(), bulk_data.begin_nodes(cell), bulk_data.end_nodes(cell));
+  }
+  for (auto* entities : {&faces, &edges, &nodes}) {
+    std::sort(entities->begin(), entities->end());
+    entities->erase(std::unique(entities->begin(), entities->end()), entities->end());
+  }
+
+  // Entities left without the cells, faces or edges above them
+  auto const remove_orphans = [&](stk::mesh::EntityVector const& candidate_faces,
+                                  stk::mesh::EntityVector const& candidate_edges,
+                                  stk::mesh::EntityVector const& candidate_nodes) {
+    for (auto face : candidate_faces) {
+      if (bulk_data.is_valid(face) == false || bulk_data.bucket(face).member(locally_owned) == false) continue;
+      auto const num_elems = bulk_data.num_elements(face);
+      if (num_elems == 0) {
+        remove_entity_and_up_relations(face);
+      }
+    }
+    for (auto edge : candidate_edges) {
+      if (bulk_data.is_valid(edge) == false || bulk_data.bucket(edge).member(locally_owned) == false) continue;
+      auto const num_elems = bulk_data.num_elements(edge);
+      auto const num_faces = bulk_data.num_faces(edge);
+      if (num_elems == 0 || num_faces == 0) {
+        remove_entity_and_up_relations(edge);
+      }
+    }
+    for (auto node : candidate_nodes) {
+      if (bulk_data.is_valid(node) == false || bulk_data.bucket(node).member(locally_owned) == false) continue;
+      auto const num_elems = bulk_data.num_elements(node);
+      auto const num_faces = bulk_data.num_faces(node);
+      auto const num_edges = bulk_data.num_edges(node);
+      if (num_elems == 0 || num_faces == 0 || num_edges == 0) {
+        remove_entity_and_up_relations(node);
+      }
     }
+  };
+
+  modification_begin();
+  for (auto cell : cells) {
+    auto cell_volume = getCellVolume(cell);
+    eroded_volume += cell_volume;
+    set_failure_state(cell, INTACT);
+    remove_entity_and_up_relations(cell);
   }
+  remove_orphans(faces, edges, nodes);
   modification_end();
+
+  // Cells removed on other ranks are only seen here after the cycle ends.
+  // Owned entities they leave orphaned lie on the rank boundary, so sweep
+  // the owned shared entities in a second cycle if any rank removed cells.
+  int       global_count = 0;
+  int const local_count  = cells.size();
+  auto      comm         = static_cast<stk::ParallelMachine>(MPI_COMM_WORLD);
+  stk::all_reduce_sum(comm, &local_count, &global_count, 1);
+  if (global_count > 0 && bulk_data.parallel_size() > 1) {
+    stk::mesh::Selector const owned_shared = locally_owned & meta_data.globally_shared_part();
+    stk::mesh::EntityVector   shared_faces;
+    stk::mesh::EntityVector   shared_edges;
+    stk::mesh::EntityVector   shared_nodes;
+    stk::mesh::get_selected_entities(owned_shared, bulk_data.buckets(stk::topology::FACE_RANK), shared_faces);
+    stk::mesh::get_selected_entities(owned_shared, bulk_data.buckets(stk::topology::EDGE_RANK), shared_edges);
+    stk::mesh::get_selected_entities(owned_shared, bulk_data.buckets(stk::topology::NODE_RANK), shared_nodes);
+    modification_begin();
+    remove_orphans(shared_faces, shared_edges, shared_nodes);
+    modification_end();
+  }
+
   Albany::fix_node_sharing(bulk_data);
   initializeCellFailureState();
   createBoundary();
@@ -9,6 +9,7 @@
 #include <set>
 #include <stk_mesh/base/FieldBase.hpp>
 
+#include "Topology_Search.hpp"
 #include "Topology_Types.hpp"
 #include "Topology_Utils.hpp"
 
@@ -199,8 +200,12 @@ class Topology
   ///
   ///   \attention Valid for entities of all ranks
   ///
+  ///   Traversal is iterative and each entity is expanded once, using
+  ///   visit marks indexed by the local entity offset. On return both
+  ///   lists are sorted (entities by handle, edges by EdgeLessThan).
+  ///
   void
-  createStar(stk::mesh::Entity entity, std::set<stk::mesh::Entity>& subgraph_entities, std::set<STKEdge, EdgeLessThan>& subgraph_edges);
+  createStar(stk::mesh::Entity entity, stk::mesh::EntityVector& subgraph_entities, std::vector<STKEdge>& subgraph_edges);
 
   ///
   /// \brief Fractures all open boundary entities of the mesh.
@@ -271,6 +276,21 @@ class Topology
   modification_end()
   {
     ALBANY_ASSERT(get_bulk_data().modification_end() == true);
+    clearSearchStructures();
+  }
+
+  ///
+  /// \brief Drop the cached search structures used by the minimum
+  ///        surface tools. They are rebuilt on next use.
+  ///
+  void
+  clearSearchStructures()
+  {
+    search_nodes_.clear();
+    node_tree_ = PointKdTree();
+    surface_nodes_.clear();
+    surface_tree_  = PointKdTree();
+    surface_graph_ = WeightedGraph();
   }
 
   ///
@@ -490,6 +510,21 @@ class Topology
   std::vector<std::vector<int>>
   shortestpath(std::vector<stk::mesh::Entity> const& nodes);
 
+  ///
+  /// \brief Builds the graph of the given mesh edges, weighted by their
+  ///        length. Vertices are the nodes of the edges, sorted.
+  ///
+  void
+  buildEdgeGraph(stk::mesh::EntityVector const& edges, stk::mesh::EntityVector& vertices, WeightedGraph& graph);
+
+  ///
+  /// \brief Shortest paths nodes[1] -> nodes[0], nodes[2] -> nodes[1]
+  ///        and nodes[0] -> nodes[2] on an edge graph, as pairs of
+  ///        consecutive node ids.
+  ///
+  std::vector<std::vector<int>>
+  shortestPathSegments(WeightedGraph const& graph, stk::mesh::EntityVector const& vertices, std::vector<stk::mesh::Entity> const& nodes);
+
   ///
   /// \brief Returns the directions of all the edges of the input mesh
   ///
@@ -1042,6 +1077,13 @@ class Topology
   std::set<EntityPair>                         fractured_faces_;
   std::vector<stk::topology>                   topologies_;
   std::vector<stk::mesh::EntityId>             highest_ids_;
+  std::vector<unsigned>                        star_marks_;
+  stk::mesh::EntityVector                      search_nodes_;
+  PointKdTree                                  node_tree_;
+  stk::mesh::EntityVector                      surface_nodes_;
+  PointKdTree                                  surface_tree_;
+  WeightedGraph                                surface_graph_;
+  unsigned                                     star_epoch_{0};
   std::set<stk::mesh::Entity>                  boundary_;
   std::string                                  bulk_block_name_{""};
   std::string                                  interface_block_name_{""};
@@ -4,6 +4,8 @@
 
 #include "Topology_FailureCriterion.hpp"
 
+#include <Kokkos_Core.hpp>
+
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Topology.hpp"
 
@@ -223,32 +225,79 @@ BulkFailureCriterion::BulkFailureCriterion(Topology& topology, std::string const
 {
 }
 
-bool
-BulkFailureCriterion::check(stk::mesh::BulkData& /* bulk_data */, stk::mesh::Entity element)
+ScalarFieldType const*
+BulkFailureCriterion::failureStateField()
 {
-  failure_state_ = get_meta_data().get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, failure_state_name_);
+  if (failure_state_ == nullptr) {
+    failure_state_ = get_meta_data().get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, failure_state_name_);
+  }
   ALBANY_ASSERT(failure_state_ != nullptr);
-  auto const* const pfs              = reinterpret_cast<double const* const>(stk::mesh::field_data(*failure_state_, element));
-  auto const        failure_modes    = static_cast<int>(pfs[0]);
-  auto              failure_state    = failure_modes;
-  auto const        num_displacement = failure_state / 10000;
-  failure_state -= 10000 * num_displacement;
-  auto const num_angle = failure_state / 1000;
-  failure_state -= 1000 * num_angle;
-  auto const num_yield = failure_state / 100;
-  failure_state -= 100 * num_yield;
-  auto const num_strain = failure_state / 10;
-  failure_state -= 10 * num_strain;
-  auto const num_tension = failure_state;
-  auto const num_failed  = num_displacement + num_angle + num_yield + num_strain + num_tension;
-  if (accumulate == true) {
-    count_displacement += num_displacement;
-    count_angle += num_angle;
-    count_yield += num_yield;
-    count_strain += num_strain;
-    count_tension += num_tension;
+  return failure_state_;
+}
+
+std::array<int, 5>
+BulkFailureCriterion::decodeFailureModes(double const failure_state)
+{
+  // Each decimal digit counts the integration points failed by one mode.
+  auto               remainder = static_cast<int>(failure_state);
+  std::array<int, 5> modes;
+  for (int mode = 0, divisor = 10000; mode < 5; ++mode, divisor /= 10) {
+    modes[mode] = remainder / divisor;
+    remainder -= divisor * modes[mode];
   }
+  return modes;
+}
+
+void
+BulkFailureCriterion::accumulateFailureModes(std::array<int, 5> const& modes)
+{
+  count_displacement += modes[0];
+  count_angle += modes[1];
+  count_yield += modes[2];
+  count_strain += modes[3];
+  count_tension += modes[4];
+}
+
+bool
+BulkFailureCriterion::check(stk::mesh::BulkData& /* bulk_data */, stk::mesh::Entity element)
+{
+  auto const* const pfs   = stk::mesh::field_data(*failureStateField(), element);
+  auto const        modes = decodeFailureModes(pfs[0]);
+  if (accumulate == true) accumulateFailureModes(modes);
+  auto const num_failed = modes[0] + modes[1] + modes[2] + modes[3] + modes[4];
   return num_failed >= failed_threshold;  // # of integration points that must fail (max is 8 per element)
 }
 
+void
+BulkFailureCriterion::failedElements(stk::mesh::BulkData& bulk_data, stk::mesh::EntityVector& failed)
+{
+  auto const&                    field         = *failureStateField();
+  auto&                          locally_owned = get_meta_data().locally_owned_part();
+  stk::mesh::BucketVector const& buckets       = bulk_data.get_buckets(stk::topology::ELEMENT_RANK, locally_owned);
+  auto const                     num_buckets   = buckets.size();
+
+  // Each bucket records its own failed elements and failure modes, so that
+  // the result does not depend on the number of threads.
+  std::vector<stk::mesh::EntityVector> bucket_failed(num_buckets);
+  std::vector<std::array<int, 5>>      bucket_modes(num_buckets, std::array<int, 5>{{0, 0, 0, 0, 0}});
+
+  Kokkos::parallel_for(
+      "BulkFailureCriterion::failedElements", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_buckets), [&](int const b) {
+        stk::mesh::Bucket const& bucket = *buckets[b];
+        auto const* const        pfs    = stk::mesh::field_data(field, bucket);
+        for (std::size_t i = 0; i < bucket.size(); ++i) {
+          auto const modes      = decodeFailureModes(pfs[i]);
+          auto const num_failed = modes[0] + modes[1] + modes[2] + modes[3] + modes[4];
+          for (int mode = 0; mode < 5; ++mode) bucket_modes[b][mode] += modes[mode];
+          if (num_failed >= failed_threshold) bucket_failed[b].push_back(bucket[i]);
+        }
+      });
+
+  failed.clear();
+  for (std::size_t b = 0; b < num_buckets; ++b) {
+    if (accumulate == true) accumulateFailureModes(bucket_modes[b]);
+    failed.insert(failed.end(), bucket_failed[b].begin(), bucket_failed[b].end());
+  }
+}
+
 }  // namespace LCM
@@ -10,6 +10,7 @@
 #if !defined(LCM_Topology_FailureCriterion_hpp)
 #define LCM_Topology_FailureCriterion_hpp
 
+#include <array>
 #include <cassert>
 #include <stk_mesh/base/FieldBase.hpp>
 
@@ -239,6 +240,14 @@ class BulkFailureCriterion : public AbstractFailureCriterion
   bool
   check(stk::mesh::BulkData& bulk_data, stk::mesh::Entity element);
 
+  ///
+  /// Collect the locally owned elements that have failed. The failure
+  /// state field is scanned bucket by bucket in parallel, and failure
+  /// modes are accumulated if requested.
+  ///
+  void
+  failedElements(stk::mesh::BulkData& bulk_data, stk::mesh::EntityVector& failed);
+
   BulkFailureCriterion()                            = delete;
   BulkFailureCriterion(BulkFailureCriterion const&) = delete;
   BulkFailureCriterion&
@@ -253,6 +262,17 @@ class BulkFailureCriterion : public AbstractFailureCriterion
   int       count_tension{0};
 
  private:
+  ScalarFieldType const*
+  failureStateField();
+
+  // Number of failed integration points per failure mode, in the order
+  // displacement, angle, yield, strain, tension.
+  static std::array<int, 5>
+  decodeFailureModes(double failure_state);
+
+  void
+  accumulateFailureModes(std::array<int, 5> const& modes);
+
   ScalarFieldType const* failure_state_{nullptr};
   std::string            failure_state_name_{""};
 };
@@ -0,0 +1,157 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license
+// detailed in the file license.txt in the top-level Albany directory.
+
+#include "Topology_Search.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "Albany_Macros.hpp"
+
+namespace LCM {
+
+PointKdTree::PointKdTree(std::vector<Point> const& points) : points_(points), index_(points.size())
+{
+  for (std::size_t i = 0; i < index_.size(); ++i) index_[i] = i;
+  build(0, index_.size(), 0);
+}
+
+void
+PointKdTree::build(std::size_t begin, std::size_t end, int depth)
+{
+  if (end - begin < 2) return;
+
+  int const         axis   = depth % 3;
+  std::size_t const middle = begin + (end - begin) / 2;
+
+  std::nth_element(index_.begin() + begin, index_.begin() + middle, index_.begin() + end, [&](std::size_t a, std::size_t b) {
+    return points_[a][axis] < points_[b][axis];
+  });
+
+  build(begin, middle, depth + 1);
+  build(middle + 1, end, depth + 1);
+}
+
+std::size_t
+PointKdTree::nearest(Point const& query) const
+{
+  ALBANY_ASSERT(empty() == false, "Nearest point query on an empty tree");
+
+  std::size_t best       = index_[0];
+  double      best_dist2 = std::numeric_limits<double>::max();
+  search(0, index_.size(), 0, query, best, best_dist2);
+  return best;
+}
+
+void
+PointKdTree::search(std::size_t begin, std::size_t end, int depth, Point const& query, std::size_t& best, double& best_dist2) const
+{
+  if (begin >= end) return;
+
+  int const         axis   = depth % 3;
+  std::size_t const middle = begin + (end - begin) / 2;
+  Point const&      point  = points_[index_[middle]];
+
+  double dist2 = 0.0;
+  for (int i = 0; i < 3; ++i) dist2 += (point[i] - query[i]) * (point[i] - query[i]);
+
+  // Ties go to the lowest index, as in a linear scan.
+  if (dist2 < best_dist2 || (dist2 == best_dist2 && index_[middle] < best)) {
+    best       = index_[middle];
+    best_dist2 = dist2;
+  }
+
+  double const delta = query[axis] - point[axis];
+
+  // Near side first, far side only if the splitting plane is within range.
+  if (delta < 0.0) {
+    search(begin, middle, depth + 1, query, best, best_dist2);
+    if (delta * delta <= best_dist2) search(middle + 1, end, depth + 1, query, best, best_dist2);
+  } else {
+    search(middle + 1, end, depth + 1, query, best, best_dist2);
+    if (delta * delta <= best_dist2) search(begin, middle, depth + 1, query, best, best_dist2);
+  }
+}
+
+WeightedGraph::WeightedGraph(std::size_t num_vertices, std::vector<std::array<int, 2>> const& edges, std::vector<float> const& weights)
+    : offsets_(num_vertices + 1, 0), targets_(2 * edges.size()), weights_(2 * edges.size())
+{
+  ALBANY_ASSERT(edges.size() == weights.size(), "Number of edges and weights differ");
+
+  // Count pass, then fill pass. Each edge is stored in both directions.
+  for (auto const& edge : edges) {
+    ++offsets_[edge[0] + 1];
+    ++offsets_[edge[1] + 1];
+  }
+  for (std::size_t v = 0; v < num_vertices; ++v) offsets_[v + 1] += offsets_[v];
+
+  std::vector<std::size_t> cursor(offsets_.begin(), offsets_.end() - 1);
+  for (std::size_t e = 0; e < edges.size(); ++e) {
+    for (int side = 0; side < 2; ++side) {
+      std::size_t const pos = cursor[edges[e][side]]++;
+      targets_[pos]         = edges[e][1 - side];
+      weights_[pos]         = weights[e];
+    }
+  }
+
+  distances_.assign(num_vertices, std::numeric_limits<float>::max());
+  predecessors_.assign(num_vertices, -1);
+}
+
+std::vector<int>
+WeightedGraph::shortestPath(int source, int goal) const
+{
+  using QueueEntry = std::pair<float, int>;
+
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+  // Only the vertices reached by this query are reset on exit.
+  std::vector<int> touched;
+
+  distances_[source]    = 0.0;
+  predecessors_[source] = source;
+  touched.push_back(source);
+  queue.push(std::make_pair(0.0f, source));
+
+  while (queue.empty() == false) {
+    QueueEntry const top = queue.top();
+    queue.pop();
+
+    int const vertex = top.second;
+
+    if (top.first > distances_[vertex]) continue;
+
+    if (vertex == goal) break;
+
+    for (std::size_t k = offsets_[vertex]; k < offsets_[vertex + 1]; ++k) {
+      int const   target   = targets_[k];
+      float const distance = top.first + weights_[k];
+
+      if (distance < distances_[target]) {
+        if (predecessors_[target] == -1) touched.push_back(target);
+        distances_[target]    = distance;
+        predecessors_[target] = vertex;
+        queue.push(std::make_pair(distance, target));
+      }
+    }
+  }
+
+  ALBANY_ASSERT(predecessors_[goal] != -1, "Vertex " << goal << " is not reachable from vertex " << source);
+
+  std::vector<int> path;
+  for (int vertex = goal; vertex != source; vertex = predecessors_[vertex]) path.push_back(vertex);
+  path.push_back(source);
+
+  for (auto const vertex : touched) {
+    distances_[vertex]    = std::numeric_limits<float>::max();
+    predecessors_[vertex] = -1;
+  }
+
+  return path;
+}
+
+}  // namespace LCM
@@ -0,0 +1,97 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license
+// detailed in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_Topology_Search_hpp)
+#define LCM_Topology_Search_hpp
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace LCM {
+
+///
+/// \brief Static k-d tree over points in 3D for nearest point queries.
+///
+/// Points are identified by their position in the input vector. The tree
+/// is stored implicitly: the points are permuted so that each subrange
+/// [begin, end) has its splitting point at the median position.
+///
+class PointKdTree
+{
+ public:
+  using Point = std::array<double, 3>;
+
+  PointKdTree() = default;
+
+  explicit PointKdTree(std::vector<Point> const& points);
+
+  bool
+  empty() const
+  {
+    return points_.empty();
+  }
+
+  ///
+  /// \brief Index (in the input vector) of the point closest to the query
+  ///
+  std::size_t
+  nearest(Point const& query) const;
+
+ private:
+  void
+  build(std::size_t begin, std::size_t end, int depth);
+
+  void
+  search(std::size_t begin, std::size_t end, int depth, Point const& query, std::size_t& best, double& best_dist2) const;
+
+  std::vector<Point>       points_;
+  std::vector<std::size_t> index_;
+};
+
+///
+/// \brief Undirected graph with float edge weights in CSR storage, with
+///        a binary heap Dijkstra that reuses its work arrays between
+///        queries.
+///
+class WeightedGraph
+{
+ public:
+  WeightedGraph() = default;
+
+  ///
+  /// \param[in] number of vertices
+  /// \param[in] edges as pairs of vertex indices
+  /// \param[in] weight of each edge
+  ///
+  WeightedGraph(std::size_t num_vertices, std::vector<std::array<int, 2>> const& edges, std::vector<float> const& weights);
+
+  std::size_t
+  num_vertices() const
+  {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+
+  ///
+  /// \brief Shortest path from source to goal.
+  ///
+  /// The path is returned from goal to source, both included, which is
+  /// the order in which the predecessors are traversed. Aborts if goal
+  /// is not reachable from source.
+  ///
+  std::vector<int>
+  shortestPath(int source, int goal) const;
+
+ private:
+  std::vector<std::size_t> offsets_;
+  std::vector<int>         targets_;
+  std::vector<float>       weights_;
+
+  mutable std::vector<float> distances_;
+  mutable std::vector<int>   predecessors_;
+};
+
+}  // namespace LCM
+
+#endif  // LCM_Topology_Search_hpp
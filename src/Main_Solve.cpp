@@ -102,6 +102,8 @@ main(int argc, char* argv[])
 
     setupTimer = Teuchos::null;
 
+    Albany::trackMemoryPhase("Solver Setup");
+
     std::string             solnMethod  = slvrfctry.getParameters().sublist("Problem").get<std::string>("Solution Method");
     Teuchos::ParameterList& solveParams = slvrfctry.getAnalysisParameters().sublist("Solve", /*mustAlreadyExist =*/false);
 
@@ -109,6 +111,8 @@ main(int argc, char* argv[])
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Thyra_MultiVector>>> thyraSensitivities;
     Piro::PerformSolve(*solver, solveParams, thyraResponses, thyraSensitivities);
 
+    Albany::trackMemoryPhase("Solve");
+
     // Check if thyraResponses are product vectors or regular vectors
     Teuchos::RCP<const Thyra_ProductVector> r_prod;
     if (thyraResponses.size() > 0) {
@@ -274,6 +278,7 @@ main(int argc, char* argv[])
       *out << "\nNumber of Failed Comparisons: " << status << std::endl;
 
       if (debugParams.get<bool>("Analyze Memory", false)) Albany::printMemoryAnalysis(std::cout, comm);
+      Albany::MemoryTracker::instance().printSummary(std::cout);
 
       if (writeToMatrixMarketDistrSolnMap == true) {
         Albany::writeMatrixMarket(xfinal, "xfinal_distributed");
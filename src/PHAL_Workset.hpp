@@ -8,8 +8,10 @@
 #include <list>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "Albany_DiscretizationUtils.hpp"
+#include "Albany_Macros.hpp"
 #include "Albany_SacadoTypes.hpp"
 #include "Albany_StateInfoStruct.hpp"
 #include "Albany_ThyraTypes.hpp"
@@ -125,14 +127,41 @@ struct Workset
   std::set<int>                                        fixed_dofs_;
   bool                                                 is_schwarz_bc_{false};
 
+  // Local rows of the strong (SDBC) and legacy Dirichlet conditions of a
+  // Jacobian fill. The Dirichlet evaluators record them and the Dirichlet
+  // aggregator eliminates all of them from the Jacobian in a single pass.
+  std::vector<LO> sdbc_dofs_;
+  std::vector<LO> dbc_dofs_;
+
   // Needed for ACE erosion
   Teuchos::RCP<LCM::Topology> topology{Teuchos::null};
 
   int spatial_dimension_{0};
 
   Albany::StateArray*              stateArrayPtr{nullptr};
+  Albany::StateHandleArray*        stateHandleArrayPtr{nullptr};
+  Albany::StateHandleMap const*    stateHandlesPtr{nullptr};
   Teuchos::RCP<Tpetra_MultiVector> auxDataPtrT;
 
+  // State array of this workset through a handle cached by the caller. An
+  // unresolved handle (< 0) is looked up by name once; states without a
+  // handle are served from the name-based StateArray.
+  Albany::MDArray&
+  getStateArray(std::string const& name, Albany::StateHandle& handle) const
+  {
+    if (handle < 0 && stateHandlesPtr != nullptr) {
+      auto const it = stateHandlesPtr->find(name);
+      if (it != stateHandlesPtr->end()) handle = it->second;
+    }
+    if (handle >= 0 && stateHandleArrayPtr != nullptr) {
+      ALBANY_EXPECT(
+          handle < static_cast<Albany::StateHandle>(stateHandleArrayPtr->size()),
+          "State handle " << handle << " of " << name << " is out of range");
+      return (*stateHandleArrayPtr)[handle];
+    }
+    return (*stateArrayPtr)[name];
+  }
+
   bool transientTerms{false};
   bool accelerationTerms{false};
 
@@ -148,6 +177,15 @@ struct Workset
   // either the Jacobian or the transpose of the Jacobian is scattered.
   bool is_adjoint{false};
 
+  // Flag indicating that ScatterResidual adds into the Jacobian a node block
+  // at a time, looking up the column offsets once per node pair.
+  bool block_jacobian{false};
+
+  // Flag indicating that response evaluators leave their local partial sums
+  // in g, so that the responses evaluated with the residual are reduced
+  // across ranks at once.
+  bool defer_response_reduction{false};
+
   // New field manager response stuff
   Teuchos::RCP<Teuchos::Comm<int> const> comm;
 
@@ -14,6 +14,7 @@
 #endif
 #include "AAdapt_RC_Manager.hpp"
 #include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_ModelEvaluator.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Thyra_ModelEvaluatorDelegatorBase.hpp"
@@ -157,6 +158,9 @@ AdaptiveSolutionManager::adaptProblem()
   if (adapter_->adaptMesh()) {
     resizeMeshDataArrays(disc_);
 
+    // The rebuilt worksets invalidate the handle-indexed state views.
+    stateMgr_.refreshStateHandleArrays();
+
     Teuchos::RCP<Thyra::ModelEvaluatorDelegatorBase<ST>> base = Teuchos::rcp_dynamic_cast<Thyra::ModelEvaluatorDelegatorBase<ST>>(model);
 
     // If dynamic cast fails
@@ -180,6 +184,8 @@ AdaptiveSolutionManager::adaptProblem()
 
     adapter_->postAdapt();
 
+    Albany::trackMemoryPhase("Adaptation");
+
     *out << "Mesh adaptation was successfully performed!" << std::endl;
 
     return true;
@@ -38,6 +38,8 @@ class AdaptiveSolutionManager : public Thyra::AdaptiveSolutionManager
   virtual bool
   queryAdaptationCriteria()
   {
+    // Adapters read state fields from the mesh by name
+    stateMgr_.resolveStateSlots();
     return adapter_->queryAdaptationCriteria(iter_);
   }
 
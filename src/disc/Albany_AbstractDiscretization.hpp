@@ -5,6 +5,8 @@
 #ifndef ALBANY_ABSTRACT_DISCRETIZATION_HPP
 #define ALBANY_ABSTRACT_DISCRETIZATION_HPP
 
+#include <functional>
+
 #include "Albany_AbstractMeshStruct.hpp"
 #include "Albany_DiscretizationUtils.hpp"
 #include "Albany_NodalDOFManager.hpp"
@@ -246,6 +248,13 @@ class AbstractDiscretization
   virtual int
   getNumEq() const = 0;
 
+  //! Flag if the Jacobian is scattered a node block at a time
+  virtual bool
+  hasBlockJacobian() const
+  {
+    return false;
+  }
+
   //! Get Numbering for layered mesh (mesh structred in one direction)
   virtual Teuchos::RCP<LayeredMeshNumbering<LO>>
   getLayeredMeshNumbering() const = 0;
@@ -307,6 +316,22 @@ class AbstractDiscretization
   // Routine that disables writing out of initial condition to Exodus file
   virtual void
   outputExodusSolutionInitialTime(const bool output_initial_soln_to_exo_file_) = 0;
+
+  //! Whether the next call to writeSolution writes the mesh fields to file.
+  //! The StateManager uses it to decide when states must be in their
+  //! canonical (named) mesh fields.
+  virtual bool
+  nextWriteIsOutputStep() const
+  {
+    return true;
+  }
+
+  //! Callback run before the mesh fields are written to file, so that states
+  //! held in swapped slots are put back into their named fields first.
+  virtual void
+  setStateSlotResolver(std::function<void()> const& /* resolver */)
+  {
+  }
 };
 
 }  // namespace Albany
@@ -4,8 +4,15 @@
 
 #include "Albany_ContactManager.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "Albany_ThyraUtils.hpp"
 #include "Albany_Utils.hpp"
 #include "Moertel_InterfaceT.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 int const printLevel = 4;
 
@@ -85,25 +92,47 @@ Albany::ContactManager::ContactManager(
   }
 
   int const mortarside(1);
-  int const nonmortarside(0);
 
   int const number_of_mortar_pairs = masterSideNames.size();
   ALBANY_ASSERT(number_of_mortar_pairs == slaveSideNames.size(), "Input error: number of master and slave interfaces differ.");
 
-  int interface_ctr = 0;
+  const MOERTEL::Function::FunctionType primal = MOERTEL::Function::func_Linear1D;
+  const MOERTEL::Function::FunctionType dual   = MOERTEL::Function::func_Linear1D /*func_Constant1D*/;
 
-  // Loop over all the master interfaces
+  // One interface per pair, so that the slave sides can be paired with the
+  // master sides as they move
   for (int pair = 0; pair < number_of_mortar_pairs; pair++) {
-    processSS(interface_ctr, slaveSideNames[pair], 0 /* Slave side */, mortarside, slaveNodeGIDs, sfile);
+    Teuchos::RCP<MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>> moertelInterface =
+        Teuchos::rcp(new MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>(pair, oneD, disc.getMapT()->getComm(), printLevel));
+
+    moertelInterface->SetMortarSide(mortarside);
+    moertelInterface->SetFunctionTypes(primal, dual);
 
-    interface_ctr++;
+    processSS(*moertelInterface, pair, slaveSideNames[pair], 0 /* Slave side */, slaveNodeGIDs, slaveSides, sfile);
+    processSS(*moertelInterface, pair, masterSideNames[pair], 1 /* mortar side */, masterNodeGIDs, masterSides, mfile);
+
+    // once we have looped over all the worksets for this pair, we close
+    // the interface
+    ALBANY_ASSERT(moertelInterface->Complete() == true, "Contact interface is not complete");
+
+    // add it to the manager
+    moertelManager->AddInterface(moertelInterface);
   }
 
-  // Loop over all the slave interfaces
+  // The search only sees the sides on this rank, so a contact pair split
+  // across ranks misses the contacts between sides on different ranks
+  Teuchos::RCP<Teuchos_Comm const> const comm = disc.getMapT()->getComm();
+  std::vector<int>                       local_sides(number_of_mortar_pairs, 0);
+  std::vector<int>                       total_sides(number_of_mortar_pairs, 0);
+  std::vector<int>                       largest_sides(number_of_mortar_pairs, 0);
+  for (auto const& side : slaveSides) ++local_sides[side.interface];
+  for (auto const& side : masterSides) ++local_sides[side.interface];
+  Teuchos::reduceAll<int, int>(*comm, Teuchos::REDUCE_SUM, number_of_mortar_pairs, local_sides.data(), total_sides.data());
+  Teuchos::reduceAll<int, int>(*comm, Teuchos::REDUCE_MAX, number_of_mortar_pairs, local_sides.data(), largest_sides.data());
   for (int pair = 0; pair < number_of_mortar_pairs; pair++) {
-    processSS(interface_ctr, masterSideNames[pair], 1 /* mortar side */, nonmortarside, masterNodeGIDs, mfile);
-
-    interface_ctr++;
+    if (total_sides[pair] != largest_sides[pair] && comm->getRank() == 0) {
+      std::cout << "WARNING: Contact pair " << pair << " is split across ranks; only sides on the same rank are paired" << std::endl;
+    }
   }
 
   // ============================================================= //
@@ -131,29 +160,34 @@ Albany::ContactManager::ContactManager(
   //   if (printlevel) cout << *manager;
   std::cout << *moertelManager;
 
-  // GAH here
+  // The candidate pairs start from the reference configuration. By default
+  // the skin is the largest side on this rank.
+  currentCoords = referenceCoords;
+  candidateDisplacement.assign(referenceCoords.size(), std::array<double, 3>{0.0, 0.0, 0.0});
+  candidateTime = std::numeric_limits<double>::quiet_NaN();
+
+  searchDistance = paramList.get<double>("Contact Search Distance", 0.0);
+  skinDistance   = paramList.get<double>("Skin Distance", 0.0);
+  if (skinDistance <= 0.0) {
+    for (auto const& side : slaveSides) skinDistance = std::max(skinDistance, MoertelT::BoundingBoxTree::Diagonal(sideBox(side)));
+    for (auto const& side : masterSides) skinDistance = std::max(skinDistance, MoertelT::BoundingBoxTree::Diagonal(sideBox(side)));
+  }
+
+  findCandidates();
+  findPairs(pairedOffsets, paired);
 }
 
 // Process all the contact surfaces and insert the data into a Moertel Interface
 void
 Albany::ContactManager::processSS(
-    int const            ctr,
-    std::string const&   sideSetName,
-    int                  s_or_mortar,
-    int                  mortarside,
-    WorksetContactNodes& nodeGIDs,
-    std::ofstream&       stream)
+    MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>& moertelInterface,
+    int const                                            ctr,
+    std::string const&                                   sideSetName,
+    int                                                  s_or_mortar,
+    WorksetContactNodes&                                 nodeGIDs,
+    std::vector<ContactSide>&                            sides,
+    std::ofstream&                                       stream)
 {
-  // one interface per side set name
-  Teuchos::RCP<MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>> moertelInterface =
-      Teuchos::rcp(new MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>(ctr, oneD, disc.getMapT()->getComm(), printLevel));
-
-  const MOERTEL::Function::FunctionType primal = MOERTEL::Function::func_Linear1D;
-  const MOERTEL::Function::FunctionType dual   = MOERTEL::Function::func_Linear1D /*func_Constant1D*/;
-
-  moertelInterface->SetMortarSide(mortarside);
-  moertelInterface->SetFunctionTypes(primal, dual);
-
   //  std::size_t numFields = disc.getWsElNodeEqID()[0][0][0].size(); // num
   //  equations at each node
   std::size_t numFields = disc.getWsElNodeEqID()->extent(3);  // num equations at each node
@@ -164,6 +198,10 @@ Albany::ContactManager::processSS(
 
   nodeGIDs.resize(numWorksets);
 
+  // Position of each node of this side set in the contact node arrays, a node
+  // may be on sides in several worksets
+  std::map<GO, int> inserted_nodes;
+
   for (int workset = 0; workset < numWorksets; workset++) {
     const Albany::SideSetList& ssList = disc.getSideSets(workset);
 
@@ -172,9 +210,6 @@ Albany::ContactManager::processSS(
     // If ss exists in this workset, loop over the sides in it and construct
     // moertel nodes/faces and interface
     if (it_side_set != ssList.end()) {
-      std::set<int>                            inserted_nodes;
-      std::pair<std::set<int>::iterator, bool> ret;
-
       std::vector<Albany::SideStruct> const& theSideSet = it_side_set->second;
 
       for (std::size_t side = 0; side < theSideSet.size(); ++side) {
@@ -199,15 +234,16 @@ Albany::ContactManager::processSS(
         stream << "    element block side is in = " << elem_block << std::endl;
 
         // gather nodes from sideset and if unique then create moertel node
-        bool const on_boundary = false;                    // will eventually want to allow boundaries to be
-                                                           // intersected by contact surfaces
-        int const                    contact_pair_id = 0;  // will eventually want to allow multiple pairs
-        const Teuchos::ArrayRCP<GO>& elNodeID        = disc.getWsElNodeID()[workset][elem_LID];
-        const auto                   elNodeEqID      = disc.getWsElNodeEqID()[workset];
+        bool const on_boundary = false;  // will eventually want to allow boundaries to be
+                                         // intersected by contact surfaces
+        const Teuchos::ArrayRCP<GO>& elNodeID   = disc.getWsElNodeID()[workset][elem_LID];
+        const auto                   elNodeEqID = disc.getWsElNodeEqID()[workset];
 
         // loop over the nodes on the side
 
         std::vector<int> nodev(numSideNodes);
+        ContactSide      contact_side;
+        contact_side.interface = ctr;
 
         for (int i = 0; i < numSideNodes; ++i) {
           std::size_t node    = subcell_side.node[i];
@@ -227,9 +263,7 @@ Albany::ContactManager::processSS(
           // Build the Moertel node list corresponding to unique nodes along the
           // interface
 
-          ret = inserted_nodes.insert(gnodeId);
-          //          const Teuchos::ArrayRCP<GO>& elNodeID =
-          //          disc.getWsElNodeID()[workset][elem_LID];
+          auto const ret = inserted_nodes.insert(std::make_pair(gnodeId, static_cast<int>(contactNodeGIDs.size())));
 
           if (ret.second == true) {  // this is a as yet unregistered node. add it
 
@@ -242,29 +276,158 @@ Albany::ContactManager::processSS(
               list_of_dofgid.push_back(global_eq_id);
             }
 
+            // The displacement is taken to be the first probDim equations
+            std::array<LO, 3> displacement{0, 0, 0};
+            for (int dim = 0; dim < probDim; ++dim) displacement[dim] = elNodeEqID(elem_LID, node, dim);
+
+            contactNodeGIDs.push_back(gnodeId);
+            contactNodeInterface.push_back(ctr);
+            referenceCoords.push_back({coords[0], coords[1], coords[2]});
+            displacementLIDs.push_back(displacement);
+
             MOERTEL::Node moertel_node(gnodeId, coords, list_of_dofgid.size(), &list_of_dofgid[0], on_boundary, printLevel, 2);
 
             std::cout << "Adding node: " << gnodeId << "  to interface: " << ctr << std::endl;
-            moertelInterface->AddNode(moertel_node, contact_pair_id);
+            moertelInterface.AddNode(moertel_node, s_or_mortar);
 
           }  // end add nodes to interface operations
-        }    // end loop over nodes on element side
+
+          contact_side.nodes.push_back(ret.first->second);
+        }  // end loop over nodes on element side
+
+        sides.push_back(contact_side);
 
         // 2D
         MOERTEL::Segment_Linear1D segment(side_GID, nodev, printLevel);
         //  	  MOERTEL::Segment_BiLinearQuad segment( side_GID, nnodes,
         //  nodeid, printLevel ); // 3D
-        moertelInterface->AddSegment(segment, s_or_mortar);
+        moertelInterface.AddSegment(segment, s_or_mortar);
       }
     }
   }
+}
+
+// Bounding box of a side in the current configuration
+MoertelT::BoundingBoxTree::Box
+Albany::ContactManager::sideBox(ContactSide const& side) const
+{
+  std::vector<double const*> x(side.nodes.size());
+  for (std::size_t i = 0; i < side.nodes.size(); ++i) x[i] = currentCoords[side.nodes[i]].data();
+  return MoertelT::BoundingBoxTree::Enclose(x.data(), static_cast<int>(x.size()));
+}
+
+// Master sides within the search plus the skin distance of each slave side
+void
+Albany::ContactManager::findCandidates() const
+{
+  std::vector<MoertelT::BoundingBoxTree::Box> master_boxes(masterSides.size());
+  for (std::size_t m = 0; m < masterSides.size(); ++m) master_boxes[m] = sideBox(masterSides[m]);
+  MoertelT::BoundingBoxTree const tree(master_boxes);
+
+  candidateOffsets.assign(1, 0);
+  candidates.clear();
+  std::vector<int> found;
+  for (auto const& side : slaveSides) {
+    found.clear();
+    tree.Near(sideBox(side), searchDistance + skinDistance, found);
+    for (auto const m : found)
+      if (masterSides[m].interface == side.interface) candidates.push_back(m);
+    candidateOffsets.push_back(candidates.size());
+  }
+
+  for (std::size_t n = 0; n < currentCoords.size(); ++n)
+    for (int dim = 0; dim < 3; ++dim) candidateDisplacement[n][dim] = currentCoords[n][dim] - referenceCoords[n][dim];
+}
+
+// Candidates within the search distance in the current configuration
+void
+Albany::ContactManager::findPairs(std::vector<std::size_t>& offsets, std::vector<int>& pairs) const
+{
+  std::vector<MoertelT::BoundingBoxTree::Box> master_boxes(masterSides.size());
+  for (std::size_t m = 0; m < masterSides.size(); ++m) master_boxes[m] = sideBox(masterSides[m]);
+
+  offsets.assign(1, 0);
+  pairs.clear();
+  for (std::size_t s = 0; s < slaveSides.size(); ++s) {
+    MoertelT::BoundingBoxTree::Box const box = sideBox(slaveSides[s]);
+    for (std::size_t k = candidateOffsets[s]; k < candidateOffsets[s + 1]; ++k) {
+      int const m = candidates[k];
+      if (MoertelT::BoundingBoxTree::Distance(box, master_boxes[m]) <= searchDistance) pairs.push_back(m);
+    }
+    offsets.push_back(pairs.size());
+  }
+}
+
+// Move the nodes of an interface to the current configuration and integrate
+void
+Albany::ContactManager::reintegrate(int const interface) const
+{
+  std::map<int, std::array<double, 3>> coords;
+  for (std::size_t n = 0; n < contactNodeGIDs.size(); ++n)
+    if (contactNodeInterface[n] == interface) coords[contactNodeGIDs[n]] = currentCoords[n];
+
+  Teuchos::RCP<MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>> moertelInterface = moertelManager->GetInterface(interface);
+  ALBANY_ASSERT(moertelInterface.is_null() == false, "Contact interface " << interface << " not found");
 
-  // once we have looped over all the worksets for this side set name, we close
-  // the interface
-  ALBANY_ASSERT(moertelInterface->Complete() == true, "Contact interface is not complete");
+  Teuchos::RCP<Teuchos::ParameterList> intparams = Teuchos::rcp(&moertelManager->Default_Parameters(), false);
+
+  bool const ok = moertelInterface->MoveNodes(coords) && moertelInterface->BuildNormals() && moertelInterface->Mortar_Integrate(intparams);
+  ALBANY_ASSERT(ok == true, "Contact interface " << interface << " failed to integrate in the current configuration");
+}
+
+void
+Albany::ContactManager::updateContact(Thyra_Vector const& overlapped_x, double const current_time) const
+{
+  if (!have_contact) return;
+
+  Teuchos::ArrayRCP<ST const> const x = Albany::getLocalData(overlapped_x);
+
+  // Current configuration, and the largest movement of a node since the
+  // candidates were found
+  double max_move = 0.0;
+  for (std::size_t n = 0; n < contactNodeGIDs.size(); ++n) {
+    double move2 = 0.0;
+    for (int dim = 0; dim < probDim; ++dim) {
+      double const u         = x[displacementLIDs[n][dim]];
+      currentCoords[n][dim]  = referenceCoords[n][dim] + u;
+      double const increment = u - candidateDisplacement[n][dim];
+      move2 += increment * increment;
+    }
+    max_move = std::max(max_move, std::sqrt(move2));
+  }
+
+  // All ranks take the same decisions, since the integration is collective
+  Teuchos::RCP<Teuchos_Comm const> const comm = disc.getMapT()->getComm();
+  double                                 global_max_move{0.0};
+  Teuchos::reduceAll<int, double>(*comm, Teuchos::REDUCE_MAX, max_move, Teuchos::ptr(&global_max_move));
+  max_move = global_max_move;
+
+  // Two sides approach each other by at most twice the largest movement, so
+  // the candidates hold all pairs until that exceeds the skin
+  if (current_time != candidateTime || 2.0 * max_move > skinDistance) {
+    findCandidates();
+    candidateTime = current_time;
+  }
+
+  std::vector<std::size_t> offsets;
+  std::vector<int>         pairs;
+  findPairs(offsets, pairs);
+
+  // Only the interfaces with a slave side that changed partners on any rank
+  int const        num_interfaces = masterSideNames.size();
+  std::vector<int> local_changed(num_interfaces, 0);
+  std::vector<int> changed(num_interfaces, 0);
+  for (std::size_t s = 0; s < slaveSides.size(); ++s) {
+    bool const same = offsets[s + 1] - offsets[s] == pairedOffsets[s + 1] - pairedOffsets[s] &&
+                      std::equal(pairs.begin() + offsets[s], pairs.begin() + offsets[s + 1], paired.begin() + pairedOffsets[s]);
+    if (same == false) local_changed[slaveSides[s].interface] = 1;
+  }
+  Teuchos::reduceAll<int, int>(*comm, Teuchos::REDUCE_MAX, num_interfaces, local_changed.data(), changed.data());
+  pairedOffsets.swap(offsets);
+  paired.swap(pairs);
 
-  // add it to the manager
-  moertelManager->AddInterface(moertelInterface);
+  for (int interface = 0; interface < num_interfaces; ++interface)
+    if (changed[interface] == 1) reintegrate(interface);
 }
 
 // Fill in residual from M&D
@@ -11,10 +11,13 @@
 #include "Teuchos_RCP.hpp"
 
 // Moertel-specific
+#include <array>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 #include "Moertel_ManagerT.hpp"
+#include "Moertel_SearchT.hpp"
 
 /** \brief This class implements the Mortar contact algorithm. Here is the
    overall sketch of how things work:
@@ -77,6 +80,24 @@ class ContactManager
   void
   fillInMortarResidual(int const, Teuchos::ArrayRCP<ST>&);
 
+  /*!
+   * \brief Follow the deformed configuration given by the overlapped solution
+   *
+   * Called once per fill. The master sides within the skin distance of each
+   * slave side are searched for at the first call of a time step, and again
+   * only if the nodes have moved more than half the skin distance since.
+   * Other calls check the candidates against the current configuration, and
+   * re-integrate only the interfaces on which the master sides paired with a
+   * slave side changed. These decisions are reduced over the ranks, since
+   * the integration is collective.
+   *
+   * The search only sees the contact sides on this rank. A contact pair
+   * split across ranks misses the contacts between sides on different
+   * ranks; construction warns about such pairs.
+   */
+  void
+  updateContact(Thyra_Vector const& overlapped_x, double const current_time) const;
+
  private:
   ContactManager();
 
@@ -85,8 +106,35 @@ class ContactManager
   WorksetContactNodes masterNodeGIDs;
   WorksetContactNodes slaveNodeGIDs;
 
+  //! A contact side on this rank, with its nodes as positions in the
+  //! contact node arrays
+  struct ContactSide
+  {
+    int              interface;
+    std::vector<int> nodes;
+  };
+
+  void
+  processSS(
+      MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode>& moertelInterface,
+      int const                                            ctr,
+      std::string const&                                   sideSetName,
+      int                                                  s_or_mortar,
+      WorksetContactNodes&                                 nodeGIDs,
+      std::vector<ContactSide>&                            sides,
+      std::ofstream&                                       stream);
+
+  MoertelT::BoundingBoxTree::Box
+  sideBox(ContactSide const& side) const;
+
   void
-  processSS(int const ctr, std::string const& sideSetName, int s_or_mortar, int mortarside, WorksetContactNodes&, std::ofstream& stream);
+  findCandidates() const;
+
+  void
+  findPairs(std::vector<std::size_t>& offsets, std::vector<int>& pairs) const;
+
+  void
+  reintegrate(int const interface) const;
 
   Teuchos::RCP<Teuchos::ParameterList> params;
 
@@ -110,6 +158,32 @@ class ContactManager
   std::ofstream sfile, mfile;
 
   bool oneD;
+
+  // Contact nodes on this rank, with the solution entries of their
+  // displacement, and the contact sides
+  std::vector<GO>                    contactNodeGIDs;
+  std::vector<int>                   contactNodeInterface;
+  std::vector<std::array<double, 3>> referenceCoords;
+  std::vector<std::array<LO, 3>>     displacementLIDs;
+  std::vector<ContactSide>           slaveSides;
+  std::vector<ContactSide>           masterSides;
+
+  // Sides closer than the search distance are paired, candidates are the
+  // pairs closer than the search distance plus the skin distance
+  double searchDistance;
+  double skinDistance;
+
+  // Current configuration, and the candidates with the displacement and time
+  // at which they were found, in CSR storage over the slave sides
+  mutable std::vector<std::array<double, 3>> currentCoords;
+  mutable std::vector<std::array<double, 3>> candidateDisplacement;
+  mutable std::vector<std::size_t>           candidateOffsets;
+  mutable std::vector<int>                   candidates;
+  mutable double                             candidateTime;
+
+  // Master sides paired with each slave side at the last update
+  mutable std::vector<std::size_t> pairedOffsets;
+  mutable std::vector<int>         paired;
 };
 
 }  // namespace Albany
@@ -85,6 +85,7 @@ struct AbstractSTKMeshStruct : public AbstractMeshStruct
   int  numDim;
   int  neq;
   bool interleavedOrdering;
+  bool blockJacobian{false};
 
   bool        exoOutput;
   std::string exoOutFile;
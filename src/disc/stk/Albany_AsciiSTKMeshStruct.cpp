@@ -426,6 +426,9 @@ AsciiSTKMeshStruct::setFieldAndBulkData(
   if (!temperature_field) have_temp = false;
   if (!basal_friction_field) have_beta = false;
 
+  if (have_bf == false) {
+    *out << "No bf file specified...  setting basal boundary to z=0 plane..." << std::endl;
+  }
   for (int i = 0; i < elem_mapT->getLocalNumElements(); i++) {
     const unsigned int elem_GID = elem_mapT->getGlobalElement(i);
     // std::cout << "elem_GID: " << elem_GID << std::endl;
@@ -611,7 +614,6 @@ AsciiSTKMeshStruct::setFieldAndBulkData(
     // If first node has z=0 and there is no basal face file provided, identify
     // it as a Basal SS
     if (have_bf == false) {
-      *out << "No bf file specified...  setting basal boundary to z=0 plane..." << std::endl;
       if (xyz[eles[i][0]][2] == 0.0) {
         // std::cout << "sideID: " << sideID << std::endl;
         singlePartVec[0]            = ssPartVec["Basal"];
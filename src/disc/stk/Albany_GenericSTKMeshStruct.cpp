@@ -121,6 +121,15 @@ GenericSTKMeshStruct::GenericSTKMeshStruct(
   }
 
   interleavedOrdering             = params->get("Interleaved Ordering", true);
+
+  // The Jacobian is stored as a point CRS matrix either way; node block
+  // assembly only changes how ScatterResidual adds into it.
+  std::string const jac_assembly = params->get<std::string>("Jacobian Assembly", "Point");
+  ALBANY_PANIC(
+      jac_assembly != "Point" && jac_assembly != "Node Block",
+      "Error! Invalid \"Jacobian Assembly\" '" << jac_assembly << "'. Valid choices are \"Point\" and \"Node Block\".\n");
+  blockJacobian = jac_assembly == "Node Block";
+  ALBANY_PANIC(blockJacobian && !interleavedOrdering, "Error! \"Jacobian Assembly\" = \"Node Block\" requires interleaved ordering.\n");
   allElementBlocksHaveSamePhysics = true;
   compositeTet                    = params->get<bool>("Use Composite Tet 10", false);
   num_time_deriv                  = params->get<int>("Number Of Time Derivatives");
@@ -295,6 +304,16 @@ GenericSTKMeshStruct::buildPerceptEMesh()
   return false;
 }
 
+bool
+GenericSTKMeshStruct::canFragment() const
+{
+  if (adaptParams.is_null()) return false;
+
+  std::string const method = adaptParams->get<std::string>("Method", "");
+
+  return method == "Erosion" || method == "Topmod" || method == "Random";
+}
+
 bool
 GenericSTKMeshStruct::buildUniformRefiner()
 {
@@ -1820,6 +1839,10 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
+  validPL->set<std::string>(
+      "Jacobian Assembly",
+      "Point",
+      "Jacobian assembly: Point or Node Block (scatter a node block at a time into the point CRS matrix; requires interleaved ordering)");
   validPL->set<bool>("Separate Evaluators by Element Block", false, "Flag for different evaluation trees for each Element Block");
   validPL->set<std::string>(
       "Transform Type",
@@ -50,6 +50,11 @@ class GenericSTKMeshStruct : public AbstractSTKMeshStruct
     return compositeTet;
   }
 
+  //! True if the adaptation can split the mesh into disconnected fragments,
+  //! i.e., with erosion or fracture
+  bool
+  canFragment() const;
+
   // This routine builds two maps: side3D_id->cell2D_id, and
   // side3D_node_lid->cell2D_node_lid. These maps are used because the side id
   // may differ from the cell id and the nodes order in a 2D cell may not be the
@@ -6,20 +6,63 @@
 
 #include <Albany_STKNodeSharing.hpp>
 #include <Shards_BasicTopologies.hpp>
+#include <algorithm>
+#include <array>
 #include <boost/algorithm/string/predicate.hpp>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <stk_io/IossBridge.hpp>
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_mesh/base/FieldBase.hpp>
 #include <stk_mesh/base/GetBuckets.hpp>
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/Selector.hpp>
+#include <unordered_map>
 
 #include "Albany_Macros.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+namespace {
+
+// Sides are matched to elements by their sorted node ids, padded with zeros
+int const max_side_nodes = 6;
+
+using SideKey = std::array<int, max_side_nodes>;
+
+struct SideKeyHash
+{
+  std::size_t
+  operator()(SideKey const& key) const
+  {
+    std::size_t hash = 0;
+    for (auto const id : key) hash = hash * 1000003 ^ std::hash<int>()(id);
+    return hash;
+  }
+};
+
+// Number of cells of the Morton curve along each direction
+std::uint32_t const morton_cells = 1u << 21;
+
+// Interleave the lower 21 bits of x with two zero bits each
+std::uint64_t
+spread_bits(std::uint32_t x)
+{
+  std::uint64_t v = x & 0x1fffff;
+  v               = (v | v << 32) & 0x1f00000000ffffULL;
+  v               = (v | v << 16) & 0x1f0000ff0000ffULL;
+  v               = (v | v << 8) & 0x100f00f00f00f00fULL;
+  v               = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+  v               = (v | v << 2) & 0x1249249249249249ULL;
+  return v;
+}
+
+}  // namespace
+
 Albany::GmshSTKMeshStruct::GmshSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params, const Teuchos::RCP<Teuchos_Comm const>& commT)
     : GenericSTKMeshStruct(params, Teuchos::null)
 {
@@ -272,90 +315,20 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
 
   metaData->commit();
 
-  bulkData->modification_begin();  // Begin modifying the mesh
-
-  // Only proc 0 has loaded the file
-  if (commT->getRank() == 0) {
-    stk::mesh::PartVector singlePartVec(1);
-    unsigned int          ebNo   = 0;  // element block #???
-    int                   sideID = 0;
-
-    AbstractSTKFieldContainer::IntScalarFieldType* proc_rank_field   = fieldContainer->getProcRankField();
-    AbstractSTKFieldContainer::VectorFieldType*    coordinates_field = fieldContainer->getCoordinatesField();
-
-    singlePartVec[0] = nsPartVec["Node"];
-
-    for (int i = 0; i < NumNodes; i++) {
-      stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, i + 1, singlePartVec);
-
-      double* coord;
-      coord    = stk::mesh::field_data(*coordinates_field, node);
-      coord[0] = pts[i][0];
-      coord[1] = pts[i][1];
-      if (numDim == 3) coord[2] = pts[i][2];
-    }
-
-    for (int i = 0; i < NumElems; i++) {
-      singlePartVec[0]       = partVec[ebNo];
-      stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, i + 1, singlePartVec);
-
-      for (int j = 0; j < NumElemNodes; j++) {
-        stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, elems[j][i]);
-        bulkData->declare_relation(elem, node, j);
-      }
-
-      int* p_rank = stk::mesh::field_data(*proc_rank_field, elem);
-      p_rank[0]   = commT->getRank();
-    }
-
-    std::string           partName;
-    stk::mesh::PartVector nsPartVec_i(1), ssPartVec_i(2);
-    ssPartVec_i[0] = ssPartVec["BoundarySide"];  // The whole boundary side
-    for (int i = 0; i < NumSides; i++) {
-      std::map<int, int> elm_count;
-      partName       = bdTagToNodeSetName[sides[NumSideNodes][i]];
-      nsPartVec_i[0] = nsPartVec[partName];
-
-      partName       = bdTagToSideSetName[sides[NumSideNodes][i]];
-      ssPartVec_i[1] = ssPartVec[partName];
-
-      stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), i + 1, ssPartVec_i);
-      for (int j = 0; j < NumSideNodes; ++j) {
-        stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK, sides[j][i]);
-        bulkData->change_entity_parts(node_j, nsPartVec_i);  // Add node to the boundary nodeset
-        bulkData->declare_relation(side, node_j, j);
-
-        int                      num_e = bulkData->num_elements(node_j);
-        const stk::mesh::Entity* e     = bulkData->begin_elements(node_j);
-        for (int k(0); k < num_e; ++k) {
-          ++elm_count[bulkData->identifier(e[k])];
-        }
-      }
+  // Only proc 0 has loaded the file. Unless a serial mesh is requested, it
+  // hands each proc its share of the mesh before anything is declared, so
+  // that the bulk data is built in parallel.
+  bool const serial_mesh = params->get<bool>("Use Serial Mesh", false);
 
-      // We have to find out what element has this side as a side. We check the
-      // node connectivity In particular, the element that is connected to all
-      // NumSideNodes nodes is the one.
-      bool found = false;
-
-      for (auto e : elm_count)
-        if (e.second == NumSideNodes) {
-          stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEM_RANK, e.first);
-          found                  = true;
-          int num_sides          = bulkData->num_sides(elem);
-          bulkData->declare_relation(elem, side, num_sides);
-          break;
-        }
+  std::vector<int>    ibuf;
+  std::vector<double> dbuf;
+  distribute_entities(commT, serial_mesh, ibuf, dbuf);
 
-      ALBANY_PANIC(found == false, "Error! Cannot find element connected to side " << i + 1 << ".\n");
-    }
-  }
+  bulkData->modification_begin();  // Begin modifying the mesh
+  declare_entities(commT, ibuf, dbuf);
   bulkData->modification_end();
 
 #if defined(ALBANY_ZOLTAN)
-  // Gmsh is for sure using a serial mesh. We hard code it here, in case the
-  // user did not set it
-  params->set<bool>("Use Serial Mesh", true);
-
   // Refine the mesh before starting the simulation if indicated
   uniformRefineMesh(commT);
 
@@ -376,6 +349,236 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
   fieldAndBulkDataSet = true;
 }
 
+void
+Albany::GmshSTKMeshStruct::find_side_owners(std::vector<int>& side_owner)
+{
+  ALBANY_PANIC(NumSideNodes > max_side_nodes, "Error! Sides with " << NumSideNodes << " nodes are not supported.\n");
+
+  std::unordered_map<SideKey, int, SideKeyHash> side_index;
+  side_index.reserve(NumSides);
+  for (int i = 0; i < NumSides; ++i) {
+    SideKey key{};
+    for (int j = 0; j < NumSideNodes; ++j) key[j] = sides[j][i];
+    std::sort(key.begin(), key.begin() + NumSideNodes);
+    side_index.emplace(key, i);
+  }
+
+  // Among the elements connected to a side, the one with the lowest id owns it
+  stk::topology const   topo = metaData->get_topology(*partVec[0]);
+  std::vector<unsigned> ordinals(NumElemNodes);
+  side_owner.assign(NumSides, -1);
+  for (int i = 0; i < NumElems; ++i) {
+    for (unsigned s = 0; s < topo.num_sides(); ++s) {
+      if (static_cast<int>(topo.side_topology(s).num_nodes()) != NumSideNodes) continue;
+      topo.side_node_ordinals(s, ordinals.data());
+      SideKey key{};
+      for (int j = 0; j < NumSideNodes; ++j) key[j] = elems[ordinals[j]][i];
+      std::sort(key.begin(), key.begin() + NumSideNodes);
+      auto const it = side_index.find(key);
+      if (it != side_index.end() && side_owner[it->second] < 0) side_owner[it->second] = i;
+    }
+  }
+
+  for (int i = 0; i < NumSides; ++i) {
+    ALBANY_PANIC(side_owner[i] < 0, "Error! Cannot find element connected to side " << i + 1 << ".\n");
+  }
+}
+
+void
+Albany::GmshSTKMeshStruct::distribute_entities(
+    const Teuchos::RCP<Teuchos_Comm const>& commT,
+    bool                                    serial_mesh,
+    std::vector<int>&                       ibuf,
+    std::vector<double>&                    dbuf)
+{
+  int const num_procs = serial_mesh == true ? 1 : commT->getSize();
+
+  if (commT->getRank() != 0) {
+    if (num_procs == 1) return;
+    int sizes[2];
+    Teuchos::receive<int, int>(*commT, 0, 2, sizes);
+    ibuf.resize(sizes[0]);
+    dbuf.resize(sizes[1]);
+    Teuchos::receive<int, int>(*commT, 0, sizes[0], ibuf.data());
+    Teuchos::receive<int, double>(*commT, 0, sizes[1], dbuf.data());
+    return;
+  }
+
+  // Order the elements along a Morton curve through their centroids, and
+  // give each proc a contiguous chunk of the curve.
+  std::vector<int> elem_order(NumElems);
+  std::iota(elem_order.begin(), elem_order.end(), 0);
+  if (num_procs > 1) {
+    double lo[3] = {0.0, 0.0, 0.0};
+    double hi[3] = {0.0, 0.0, 0.0};
+    for (int d = 0; d < numDim; ++d) {
+      lo[d] = std::numeric_limits<double>::max();
+      hi[d] = -std::numeric_limits<double>::max();
+      for (int i = 0; i < NumNodes; ++i) {
+        lo[d] = std::min(lo[d], pts[i][d]);
+        hi[d] = std::max(hi[d], pts[i][d]);
+      }
+    }
+    std::vector<std::uint64_t> morton(NumElems);
+    for (int i = 0; i < NumElems; ++i) {
+      std::uint32_t cell[3] = {0, 0, 0};
+      for (int d = 0; d < numDim; ++d) {
+        double centroid = 0.0;
+        for (int j = 0; j < NumElemNodes; ++j) centroid += pts[elems[j][i] - 1][d];
+        centroid /= NumElemNodes;
+        double const extent = hi[d] - lo[d];
+        double const scaled = extent > 0.0 ? (centroid - lo[d]) / extent : 0.0;
+        cell[d]             = std::min<std::uint32_t>(morton_cells - 1, static_cast<std::uint32_t>(scaled * morton_cells));
+      }
+      morton[i] = spread_bits(cell[0]) | (spread_bits(cell[1]) << 1) | (spread_bits(cell[2]) << 2);
+    }
+    std::stable_sort(elem_order.begin(), elem_order.end(), [&](int a, int b) { return morton[a] < morton[b]; });
+  }
+
+  std::vector<int> elem_proc(NumElems);
+  std::vector<int> proc_elems_begin(num_procs + 1);
+  for (int p = 0; p <= num_procs; ++p) proc_elems_begin[p] = static_cast<int>(static_cast<long long>(NumElems) * p / num_procs);
+  for (int p = 0; p < num_procs; ++p)
+    for (int k = proc_elems_begin[p]; k < proc_elems_begin[p + 1]; ++k) elem_proc[elem_order[k]] = p;
+
+  // Nodes of each proc, and the procs that share each node
+  std::vector<std::vector<int>> proc_nodes(num_procs);
+  for (int p = 0; p < num_procs; ++p) {
+    auto& nodes = proc_nodes[p];
+    for (int k = proc_elems_begin[p]; k < proc_elems_begin[p + 1]; ++k)
+      for (int j = 0; j < NumElemNodes; ++j) nodes.push_back(elems[j][elem_order[k]]);
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+  }
+  std::vector<int> node_procs_begin(NumNodes + 2, 0);
+  for (int p = 0; p < num_procs; ++p)
+    for (auto const node : proc_nodes[p]) ++node_procs_begin[node + 1];
+  for (int i = 0; i <= NumNodes; ++i) node_procs_begin[i + 1] += node_procs_begin[i];
+  std::vector<int> node_procs(node_procs_begin[NumNodes + 1]);
+  {
+    std::vector<int> cursor(node_procs_begin.begin(), node_procs_begin.end() - 1);
+    for (int p = 0; p < num_procs; ++p)
+      for (auto const node : proc_nodes[p]) node_procs[cursor[node]++] = p;
+  }
+
+  // Boundary tags of each node, and the sides of each proc
+  std::vector<std::pair<int, int>> node_tags;
+  for (int i = 0; i < NumSides; ++i)
+    for (int j = 0; j < NumSideNodes; ++j) node_tags.emplace_back(sides[j][i], sides[NumSideNodes][i]);
+  std::sort(node_tags.begin(), node_tags.end());
+  node_tags.erase(std::unique(node_tags.begin(), node_tags.end()), node_tags.end());
+
+  std::vector<int> side_owner;
+  find_side_owners(side_owner);
+  std::vector<std::vector<int>> proc_sides(num_procs);
+  for (int i = 0; i < NumSides; ++i) proc_sides[elem_proc[side_owner[i]]].push_back(i);
+
+  // Pack and send the entities of each proc. The buffers of proc 0 are kept.
+  for (int p = num_procs - 1; p >= 0; --p) {
+    auto const& nodes = proc_nodes[p];
+    ibuf.clear();
+    dbuf.clear();
+    ibuf.push_back(proc_elems_begin[p + 1] - proc_elems_begin[p]);
+    ibuf.push_back(nodes.size());
+    ibuf.push_back(proc_sides[p].size());
+    for (auto const node : nodes) {
+      ibuf.push_back(node);
+      auto const first = std::lower_bound(node_tags.begin(), node_tags.end(), std::make_pair(node, std::numeric_limits<int>::min()));
+      auto       last  = first;
+      while (last != node_tags.end() && last->first == node) ++last;
+      ibuf.push_back(last - first);
+      for (auto it = first; it != last; ++it) ibuf.push_back(it->second);
+      ibuf.push_back(node_procs_begin[node + 1] - node_procs_begin[node] - 1);
+      for (int k = node_procs_begin[node]; k < node_procs_begin[node + 1]; ++k)
+        if (node_procs[k] != p) ibuf.push_back(node_procs[k]);
+      for (int d = 0; d < 3; ++d) dbuf.push_back(pts[node - 1][d]);
+    }
+    for (int k = proc_elems_begin[p]; k < proc_elems_begin[p + 1]; ++k) {
+      int const i = elem_order[k];
+      ibuf.push_back(i + 1);
+      for (int j = 0; j < NumElemNodes; ++j) ibuf.push_back(elems[j][i]);
+    }
+    for (auto const i : proc_sides[p]) {
+      ibuf.push_back(i + 1);
+      ibuf.push_back(sides[NumSideNodes][i]);
+      ibuf.push_back(side_owner[i] + 1);
+      for (int j = 0; j < NumSideNodes; ++j) ibuf.push_back(sides[j][i]);
+    }
+    if (p == 0) break;
+    int const sizes[2] = {static_cast<int>(ibuf.size()), static_cast<int>(dbuf.size())};
+    Teuchos::send<int, int>(*commT, 2, sizes, p);
+    Teuchos::send<int, int>(*commT, sizes[0], ibuf.data(), p);
+    Teuchos::send<int, double>(*commT, sizes[1], dbuf.data(), p);
+  }
+}
+
+void
+Albany::GmshSTKMeshStruct::declare_entities(const Teuchos::RCP<Teuchos_Comm const>& commT, std::vector<int> const& ibuf, std::vector<double> const& dbuf)
+{
+  if (ibuf.empty() == true) return;
+
+  unsigned int ebNo = 0;  // element block #???
+
+  AbstractSTKFieldContainer::IntScalarFieldType* proc_rank_field   = fieldContainer->getProcRankField();
+  AbstractSTKFieldContainer::VectorFieldType*    coordinates_field = fieldContainer->getCoordinatesField();
+
+  int       pos       = 0;
+  int const num_elems = ibuf[pos++];
+  int const num_nodes = ibuf[pos++];
+  int const num_sides = ibuf[pos++];
+
+  stk::mesh::PartVector singlePartVec(1);
+  for (int i = 0; i < num_nodes; ++i) {
+    singlePartVec[0]       = nsPartVec["Node"];
+    stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, ibuf[pos++], singlePartVec);
+
+    double* coord;
+    coord    = stk::mesh::field_data(*coordinates_field, node);
+    coord[0] = dbuf[3 * i + 0];
+    coord[1] = dbuf[3 * i + 1];
+    if (numDim == 3) coord[2] = dbuf[3 * i + 2];
+
+    // Add node to the boundary nodesets
+    int const num_tags = ibuf[pos++];
+    for (int k = 0; k < num_tags; ++k) {
+      singlePartVec[0] = nsPartVec[bdTagToNodeSetName[ibuf[pos++]]];
+      bulkData->change_entity_parts(node, singlePartVec);
+    }
+
+    int const num_sharing = ibuf[pos++];
+    for (int k = 0; k < num_sharing; ++k) bulkData->add_node_sharing(node, ibuf[pos++]);
+  }
+
+  for (int i = 0; i < num_elems; ++i) {
+    singlePartVec[0]       = partVec[ebNo];
+    stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, ibuf[pos++], singlePartVec);
+
+    for (int j = 0; j < NumElemNodes; j++) {
+      stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, ibuf[pos++]);
+      bulkData->declare_relation(elem, node, j);
+    }
+
+    int* p_rank = stk::mesh::field_data(*proc_rank_field, elem);
+    p_rank[0]   = commT->getRank();
+  }
+
+  stk::mesh::PartVector ssPartVec_i(2);
+  ssPartVec_i[0] = ssPartVec["BoundarySide"];  // The whole boundary side
+  for (int i = 0; i < num_sides; ++i) {
+    int const side_id = ibuf[pos++];
+    ssPartVec_i[1]    = ssPartVec[bdTagToSideSetName[ibuf[pos++]]];
+
+    stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEM_RANK, ibuf[pos++]);
+    stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), side_id, ssPartVec_i);
+    for (int j = 0; j < NumSideNodes; ++j) {
+      stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK, ibuf[pos++]);
+      bulkData->declare_relation(side, node_j, j);
+    }
+    int num_sides_elem = bulkData->num_sides(elem);
+    bulkData->declare_relation(elem, side, num_sides_elem);
+  }
+}
+
 Teuchos::RCP<Teuchos::ParameterList const>
 Albany::GmshSTKMeshStruct::getValidDiscretizationParameters() const
 {
@@ -191,6 +191,24 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void
   add_nodeset(std::string nodeset_name, int tag, std::vector<std::string>& nsNames);
 
+  // Finds the element each side belongs to, by matching the sorted node ids
+  // of the sides of all elements against a hash table of the sides.
+  // Only proc 0 has the sides.
+  void
+  find_side_owners(std::vector<int>& side_owner);
+
+  // Assigns the elements to procs along a space filling curve through their
+  // centroids, and packs for each proc its elements, their nodes (with
+  // coordinates, nodeset tags and sharing procs) and their sides.
+  // Only proc 0 has the mesh. Returns the buffers of proc 0 and sends the
+  // others to their procs.
+  void
+  distribute_entities(const Teuchos::RCP<Teuchos_Comm const>& commT, bool serial_mesh, std::vector<int>& ibuf, std::vector<double>& dbuf);
+
+  // Declares the entities packed by distribute_entities in the bulk data.
+  void
+  declare_entities(const Teuchos::RCP<Teuchos_Comm const>& commT, std::vector<int> const& ibuf, std::vector<double> const& dbuf);
+
   // The version of the gmsh msh file
   GmshVersion version;
 
@@ -9,8 +9,12 @@
 #include <limits>
 
 #include "Albany_BucketArray.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_Gather.hpp"
+#include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_Utils.hpp"
@@ -31,6 +35,7 @@
 #include <iostream>
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_mesh/base/FEMHelpers.hpp>
+#include <stk_mesh/base/FieldBase.hpp>
 #include <stk_mesh/base/GetBuckets.hpp>
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/Selector.hpp>
@@ -43,8 +48,10 @@ extern "C" {
 }
 #endif
 
+#include <Kokkos_Core.hpp>
 #include <PHAL_Dimension.hpp>
 #include <algorithm>
+#include <numeric>
 
 // Uncomment the following line if you want debug output to be printed to screen
 
@@ -404,6 +411,37 @@ setup_latlon_interp(
 
 namespace Albany {
 
+namespace {
+
+// Sorts the entries of each row of a CSR graph, removes duplicates, and
+// compacts the storage, updating the offsets.
+template <typename T>
+void
+compressCrsGraph(std::vector<std::size_t>& offsets, std::vector<T>& entries)
+{
+  int const                num_rows = offsets.size() - 1;
+  std::vector<std::size_t> counts(num_rows);
+  Kokkos::parallel_for(
+      "compressCrsGraph", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_rows), [&](int const row) {
+        auto const begin = entries.begin() + offsets[row];
+        auto const end   = entries.begin() + offsets[row + 1];
+        std::sort(begin, end);
+        counts[row] = std::unique(begin, end) - begin;
+      });
+
+  std::size_t pos = 0;
+  for (int row = 0; row < num_rows; ++row) {
+    auto const src = offsets[row];
+    offsets[row]   = pos;
+    if (pos != src) std::move(entries.begin() + src, entries.begin() + src + counts[row], entries.begin() + pos);
+    pos += counts[row];
+  }
+  offsets[num_rows] = pos;
+  entries.resize(pos);
+}
+
+}  // anonymous namespace
+
 STKDiscretization::STKDiscretization(
     const Teuchos::RCP<Teuchos::ParameterList>&    discParams_,
     Teuchos::RCP<Albany::AbstractSTKMeshStruct>&   stkMeshStruct_,
@@ -420,7 +458,8 @@ STKDiscretization::STKDiscretization(
       rigidBodyModes(rigidBodyModes_),
       stkMeshStruct(stkMeshStruct_),
       discParams(discParams_),
-      interleavedOrdering(stkMeshStruct_->interleavedOrdering)
+      interleavedOrdering(stkMeshStruct_->interleavedOrdering),
+      blockJacobian(stkMeshStruct_->blockJacobian)
 {
   const bool disable_init_exo_output = discParams_->get<bool>("Disable Exodus Output Initial Time", false);
   if (disable_init_exo_output == true) output_initial_soln_to_exo_file = false;
@@ -792,6 +831,16 @@ STKDiscretization::setupMLCoords()
     return;
   }
 
+  // The mesh may come apart with erosion or fracture. The rotations of each
+  // fragment are then about its own centroid. Without them the mesh stays
+  // connected, so skip the search for fragments.
+  auto const* gms = dynamic_cast<GenericSTKMeshStruct const*>(stkMeshStruct.get());
+  if (gms != nullptr && gms->canFragment() == true) {
+    int                        num_fragments  = 1;
+    Teuchos::RCP<Thyra_Vector> node_fragments = computeNodeFragments(num_fragments);
+    rigidBodyModes->setNodeFragments(node_fragments, num_fragments);
+  }
+
   rigidBodyModes->setCoordinatesAndNullspace(coordMV, m_vs, m_overlap_vs);
 
   // Some optional matrix-market output was tagged on here; keep that
@@ -799,6 +848,127 @@ STKDiscretization::setupMLCoords()
   writeCoordsToMatrixMarket();
 }
 
+Teuchos::RCP<Thyra_Vector>
+STKDiscretization::computeNodeFragments(int& num_fragments) const
+{
+  // Nodes of the locally owned elements, in CSR form with overlap local ids.
+  const stk::mesh::Selector select_owned_in_part = stk::mesh::Selector(metaData.universal_part()) & stk::mesh::Selector(metaData.locally_owned_part());
+
+  const stk::mesh::BucketVector& buckets = bulkData.get_buckets(stk::topology::ELEMENT_RANK, select_owned_in_part);
+
+  auto ov_node_indexer = createGlobalLocalIndexer(m_overlap_node_vs);
+
+  std::vector<std::size_t> elem_offsets(1, 0);
+  std::vector<LO>          elem_nodes;
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    const stk::mesh::Bucket& buck_cells = *buckets[b];
+    for (std::size_t ecnt = 0; ecnt < buck_cells.size(); ecnt++) {
+      const stk::mesh::Entity  e             = buck_cells[ecnt];
+      const stk::mesh::Entity* node_rels     = bulkData.begin_nodes(e);
+      const size_t             num_node_rels = bulkData.num_nodes(e);
+      for (std::size_t ncnt = 0; ncnt < num_node_rels; ++ncnt) elem_nodes.push_back(ov_node_indexer->getLocalElement(gid(node_rels[ncnt])));
+      elem_offsets.push_back(elem_nodes.size());
+    }
+  }
+
+  LO const num_overlap_nodes = ov_node_indexer->getNumLocalElements();
+
+  // Union-find with path halving; the root of a set is its smallest member.
+  auto const find = [](std::vector<GO>& parent, GO n) {
+    while (parent[n] != n) {
+      parent[n] = parent[parent[n]];
+      n         = parent[n];
+    }
+    return n;
+  };
+  auto const unite = [&find](std::vector<GO>& parent, GO const a, GO const b) {
+    GO const root_a = find(parent, a);
+    GO const root_b = find(parent, b);
+    if (root_a < root_b) parent[root_b] = root_a;
+    if (root_b < root_a) parent[root_a] = root_b;
+  };
+
+  // Components of the local elements
+  std::vector<GO> node_parent(num_overlap_nodes);
+  std::iota(node_parent.begin(), node_parent.end(), 0);
+  for (std::size_t e = 0; e + 1 < elem_offsets.size(); ++e) {
+    for (auto n = elem_offsets[e] + 1; n < elem_offsets[e + 1]; ++n) unite(node_parent, elem_nodes[elem_offsets[e]], elem_nodes[n]);
+  }
+
+  // Number them consecutively across ranks
+  std::vector<GO> node_component(num_overlap_nodes);
+  int             num_local_components = 0;
+  for (LO lid = 0; lid < num_overlap_nodes; ++lid) {
+    if (find(node_parent, lid) == lid) node_component[lid] = num_local_components++;
+  }
+  int end_component  = 0;
+  int num_components = 0;
+  Teuchos::scan(*comm, Teuchos::REDUCE_SUM, num_local_components, Teuchos::ptr(&end_component));
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, num_local_components, Teuchos::ptr(&num_components));
+  GO const first_component = end_component - num_local_components;
+  for (LO lid = 0; lid < num_overlap_nodes; ++lid) node_component[lid] = first_component + node_component[find(node_parent, lid)];
+
+  // One exchange over the shared nodes: each node learns the largest
+  // component that contains it on any rank, and each pair of distinct
+  // components meeting at a node is an edge of the component graph.
+  auto cas_manager = createCombineAndScatterManager(m_node_vs, m_overlap_node_vs);
+
+  Teuchos::RCP<Thyra_Vector> labels         = Thyra::createMember(m_node_vs);
+  Teuchos::RCP<Thyra_Vector> overlap_labels = Thyra::createMember(m_overlap_node_vs);
+  {
+    auto ov_view = getNonconstLocalData(overlap_labels);
+    for (LO lid = 0; lid < num_overlap_nodes; ++lid) ov_view[lid] = node_component[lid] + 1;
+  }
+  labels->assign(0.0);
+  cas_manager->combine(*overlap_labels, *labels, CombineMode::ABSMAX);
+  cas_manager->scatter(*labels, *overlap_labels, CombineMode::INSERT);
+
+  std::vector<std::pair<GO, GO>> local_edges;
+  {
+    auto const ov_view = getLocalData(overlap_labels.getConst());
+    for (LO lid = 0; lid < num_overlap_nodes; ++lid) {
+      GO const other = static_cast<GO>(ov_view[lid]) - 1;
+      if (other != node_component[lid]) local_edges.emplace_back(node_component[lid], other);
+    }
+  }
+  std::sort(local_edges.begin(), local_edges.end());
+  local_edges.erase(std::unique(local_edges.begin(), local_edges.end()), local_edges.end());
+
+  Teuchos::Array<GO> my_edges;
+  for (auto const& edge : local_edges) {
+    my_edges.push_back(edge.first);
+    my_edges.push_back(edge.second);
+  }
+  Teuchos::Array<GO> all_edges;
+  gatherAllV(comm, my_edges(), all_edges);
+
+  // Every rank merges the same component graph, so the fragments are
+  // numbered alike everywhere, in the order of their smallest component.
+  std::vector<GO> component_parent(num_components);
+  std::iota(component_parent.begin(), component_parent.end(), 0);
+  for (int i = 0; i + 1 < all_edges.size(); i += 2) unite(component_parent, all_edges[i], all_edges[i + 1]);
+
+  std::vector<int> fragment(num_components, -1);
+  num_fragments = 0;
+  for (GO c = 0; c < num_components; ++c) {
+    GO const root = find(component_parent, c);
+    if (fragment[root] < 0) fragment[root] = num_fragments++;
+    fragment[c] = fragment[root];
+  }
+
+  auto                       node_indexer   = createGlobalLocalIndexer(m_node_vs);
+  LO const                   num_nodes      = node_indexer->getNumLocalElements();
+  Teuchos::RCP<Thyra_Vector> node_fragments = Thyra::createMember(m_node_vs);
+  {
+    auto frag_view = getNonconstLocalData(node_fragments);
+    for (LO lid = 0; lid < num_nodes; ++lid) {
+      LO const ov_lid = ov_node_indexer->getLocalElement(node_indexer->getGlobalElement(lid));
+      frag_view[lid]  = fragment[node_component[ov_lid]];
+    }
+  }
+  return node_fragments;
+}
+
 void
 STKDiscretization::writeCoordsToMatrixMarket() const
 {
@@ -905,6 +1075,7 @@ STKDiscretization::writeSolutionToFile(Thyra_Vector const& soln, double const ti
   if (stkMeshStruct->exoOutput && !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     // Skip this write if outputInterval == 0 and output_initial_soln_to_exo_file == false
     if ((output_initial_soln_to_exo_file == true) || (outputInterval > 0)) {
+      if (resolve_state_slots_) resolve_state_slots_();
       double time_label = monotonicTimeLabel(time);
       mesh_data->begin_output_step(outputFileIdx, time_label);
       int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
@@ -959,6 +1130,7 @@ STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double c
   if (stkMeshStruct->exoOutput && !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     // Skip this write if outputInterval == 0 and output_initial_soln_to_exo_file == false
     if ((output_initial_soln_to_exo_file == true) || (outputInterval > 0)) {
+      if (resolve_state_slots_) resolve_state_slots_();
       double time_label = monotonicTimeLabel(time);
       mesh_data->begin_output_step(outputFileIdx, time_label);
       int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
@@ -995,6 +1167,16 @@ STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double c
   }
 }
 
+bool
+STKDiscretization::nextWriteIsOutputStep() const
+{
+  // NetCDF output and side set outputs are not tied to the Exodus interval.
+  if (stkMeshStruct->cdfOutput == true || sideSetDiscretizations.empty() == false) return true;
+  if (stkMeshStruct->exoOutput == false) return false;
+  if ((outputInterval % stkMeshStruct->exoOutputInterval) != 0) return false;
+  return (output_initial_soln_to_exo_file == true) || (outputInterval > 0);
+}
+
 double
 STKDiscretization::monotonicTimeLabel(double const time)
 {
@@ -1460,14 +1642,16 @@ STKDiscretization::computeGraphs()
 void
 STKDiscretization::computeGraphsUpToFillComplete()
 {
-  std::map<int, stk::mesh::Part*>::iterator pv                = stkMeshStruct->partVec.begin();
-  const auto&                               topo              = stk::mesh::get_cell_topology(metaData.get_topology(*pv->second));
-  int                                       nodes_per_element = topo.getNodeCount();
-
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map,
   // coordinates, graphs
+  //
+  // The graph is built in two stages. First, the node-to-node adjacency is
+  // assembled once, in overlap node local ids, as a CSR graph with exact row
+  // counts (count pass + fill pass). Then it is expanded block-wise to dofs,
+  // in parallel over nodes, and each dof row is handed to the matrix factory
+  // already sorted and unique.
 
-  m_overlap_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(m_overlap_vs, m_overlap_vs, neq * nodes_per_element));
+  m_overlap_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(m_overlap_vs, m_overlap_vs));
 
   stk::mesh::Selector select_owned_in_part = stk::mesh::Selector(metaData.universal_part()) & stk::mesh::Selector(metaData.locally_owned_part());
 
@@ -1475,9 +1659,6 @@ STKDiscretization::computeGraphsUpToFillComplete()
 
   if (comm->getRank() == 0) *out << "STKDisc: " << cells.size() << " elements on Proc 0 " << std::endl;
 
-  GO                     row, col;
-  Teuchos::ArrayView<GO> colAV;
-
   // determining the equations that are defined on the whole domain
   std::vector<int> globalEqns;
   for (unsigned int k(0); k < neq; ++k) {
@@ -1486,89 +1667,155 @@ STKDiscretization::computeGraphsUpToFillComplete()
     }
   }
 
-  for (std::size_t i = 0; i < cells.size(); i++) {
-    stk::mesh::Entity        e         = cells[i];
-    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
-    const size_t             num_nodes = bulkData.num_nodes(e);
+  int const num_eq = neq;
 
-    // loop over local nodes
-    for (std::size_t j = 0; j < num_nodes; j++) {
-      stk::mesh::Entity rowNode = node_rels[j];
+  // Node block assembly needs all the dof rows of a node to share their columns
+  ALBANY_PANIC(
+      blockJacobian && !sideSetEquations.empty(), "Error! \"Jacobian Assembly\" = \"Node Block\" is not available with side set equations.\n");
 
-      // loop over eqs
-      for (std::size_t k = 0; k < globalEqns.size(); ++k) {
-        row = getGlobalDOF(gid(rowNode), globalEqns[k]);
-        for (std::size_t l = 0; l < num_nodes; l++) {
-          stk::mesh::Entity colNode = node_rels[l];
-          for (std::size_t m = 0; m < globalEqns.size(); ++m) {
-            col   = getGlobalDOF(gid(colNode), globalEqns[m]);
-            colAV = Teuchos::arrayView(&col, 1);
-            m_overlap_jac_factory->insertGlobalIndices(row, colAV);
-          }
-        }
+  auto ov_node_indexer = createGlobalLocalIndexer(m_overlap_node_vs);
+  auto ov_indexer      = createGlobalLocalIndexer(m_overlap_vs);
+  int  num_ov_nodes    = ov_node_indexer->getNumLocalElements();
+
+  // Node adjacency (in overlap node lids) of the owned cells.
+  std::vector<std::size_t> node_offsets;
+  std::vector<LO>          node_adj;
+  buildNodeAdjacency(cells, *ov_node_indexer, node_offsets, node_adj);
+
+  // Side-set equations: one node adjacency per equation, built from the
+  // owned sides of all the side sets the equation is defined on.
+  std::vector<int>                      ss_eqns;
+  std::vector<std::vector<std::size_t>> ss_offsets;
+  std::vector<std::vector<LO>>          ss_adj;
+  std::vector<int>                      ss_eqn_pos(num_eq, -1);
+  for (auto const& it : sideSetEquations) {
+    std::vector<stk::mesh::Entity> sides;
+    for (auto const& ss_name : it.second) {
+      stk::mesh::Part& part = *stkMeshStruct->ssPartVec.find(ss_name)->second;
+
+      // Get all owned sides in this side set
+      stk::mesh::Selector select_owned_in_sspart = stk::mesh::Selector(part) & stk::mesh::Selector(metaData.locally_owned_part());
+
+      std::vector<stk::mesh::Entity> ss_sides;
+      stk::mesh::get_selected_entities(select_owned_in_sspart, bulkData.buckets(metaData.side_rank()), ss_sides);
+      sides.insert(sides.end(), ss_sides.begin(), ss_sides.end());
+    }
+    ss_eqn_pos[it.first] = ss_eqns.size();
+    ss_eqns.push_back(it.first);
+    ss_offsets.emplace_back();
+    ss_adj.emplace_back();
+    buildNodeAdjacency(sides, *ov_node_indexer, ss_offsets.back(), ss_adj.back());
+  }
+  int const num_ss_eqns = ss_eqns.size();
+
+  // Global ids of overlap nodes and local ids (in the overlap dof vs) of
+  // their dofs. The indexers are queried here, outside the parallel loops.
+  std::vector<GO> node_gids(num_ov_nodes);
+  std::vector<LO> dof_lids(num_ov_nodes * num_eq);
+  for (int inode = 0; inode < num_ov_nodes; ++inode) {
+    node_gids[inode] = ov_node_indexer->getGlobalElement(inode);
+    for (int eq = 0; eq < num_eq; ++eq) {
+      dof_lids[inode * num_eq + eq] = ov_indexer->getLocalElement(getGlobalDOF(node_gids[inode], eq));
+    }
+  }
+
+  auto row_size = [](std::vector<std::size_t> const& offsets, int const inode) { return offsets[inode + 1] - offsets[inode]; };
+
+  // Count pass: upper bound on the entries of each dof row. Global equations
+  // couple with all global equations of the adjacent nodes. Side-set
+  // equations have a diagonal entry (to avoid singular matrices if there
+  // are no volume equations), couple with all the equations of the adjacent
+  // side nodes, and all equations of a side node couple back with them.
+  int const                num_ov_dofs = ov_indexer->getNumLocalElements();
+  std::vector<std::size_t> dof_offsets(num_ov_dofs + 1, 0);
+  for (int inode = 0; inode < num_ov_nodes; ++inode) {
+    std::size_t ss_back = 0;
+    for (int e = 0; e < num_ss_eqns; ++e) ss_back += row_size(ss_offsets[e], inode);
+    for (int eq = 0; eq < num_eq; ++eq) {
+      std::size_t count = ss_back;
+      if (ss_eqn_pos[eq] < 0) {
+        count += row_size(node_offsets, inode) * globalEqns.size();
+      } else {
+        count += 1 + row_size(ss_offsets[ss_eqn_pos[eq]], inode) * num_eq;
       }
+      dof_offsets[dof_lids[inode * num_eq + eq] + 1] = count;
     }
   }
+  for (int lrow = 0; lrow < num_ov_dofs; ++lrow) dof_offsets[lrow + 1] += dof_offsets[lrow];
 
-  if (sideSetEquations.size() > 0) {
-    // iterator over all sideSet-defined equations
-    std::map<int, std::vector<std::string>>::iterator it;
-    for (it = sideSetEquations.begin(); it != sideSetEquations.end(); ++it) {
-      // Get the eq number
-      int eq = it->first;
-
-      // In case we only have equations on side sets (no "volume" eqns),
-      // there would be problem with linear solvers. To avoid this, we
-      // put one diagonal entry for every side set equation.
-      // NOTE: some nodes will be processed twice, but this is safe:
-      //       the redundant indices will be discarded
-      for (std::size_t inode = 0; inode < overlapnodes.size(); ++inode) {
-        stk::mesh::Entity node = overlapnodes[inode];
-        row                    = getGlobalDOF(gid(node), eq);
-        colAV                  = Teuchos::arrayView(&row, 1);
-        m_overlap_jac_factory->insertGlobalIndices(row, colAV);
-      }
-
-      // Number of side sets this eq is defined on
-      int numSideSets = it->second.size();
-      for (int ss(0); ss < numSideSets; ++ss) {
-        stk::mesh::Part& part = *stkMeshStruct->ssPartVec.find(it->second[ss])->second;
-
-        // Get all owned sides in this side set
-        stk::mesh::Selector select_owned_in_sspart = stk::mesh::Selector(part) & stk::mesh::Selector(metaData.locally_owned_part());
-
-        std::vector<stk::mesh::Entity> sides;
-        stk::mesh::get_selected_entities(select_owned_in_sspart, bulkData.buckets(metaData.side_rank()),
-                                         sides);  // store the result in "sides"
-
-        // Loop on all the sides of this sideset
-        for (std::size_t localSideID = 0; localSideID < sides.size(); localSideID++) {
-          stk::mesh::Entity        sidee     = sides[localSideID];
-          stk::mesh::Entity const* node_rels = bulkData.begin_nodes(sidee);
-          const size_t             num_nodes = bulkData.num_nodes(sidee);
-
-          // loop over local nodes of the side (row)
-          for (std::size_t i = 0; i < num_nodes; i++) {
-            stk::mesh::Entity rowNode = node_rels[i];
-            row                       = getGlobalDOF(gid(rowNode), eq);
-
-            // loop over local nodes of the side (col)
-            for (std::size_t j = 0; j < num_nodes; j++) {
-              stk::mesh::Entity colNode = node_rels[j];
-
-              // loop on all the equations (the eq may be coupled with other
-              // eqns)
-              for (std::size_t m = 0; m < neq; m++) {
-                col = getGlobalDOF(gid(colNode), m);
-                m_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col, 1));
-                m_overlap_jac_factory->insertGlobalIndices(col, Teuchos::arrayView(&row, 1));
-              }
+  // Fill pass, in parallel over overlap nodes (rows are disjoint).
+  std::vector<GO> dof_cols(dof_offsets.back());
+  Kokkos::parallel_for(
+      "STKDiscretization::computeGraphs", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_ov_nodes), [&](int const inode) {
+        for (int eq = 0; eq < num_eq; ++eq) {
+          auto pos = dof_offsets[dof_lids[inode * num_eq + eq]];
+          if (ss_eqn_pos[eq] < 0) {
+            for (auto j = node_offsets[inode]; j < node_offsets[inode + 1]; ++j) {
+              for (auto const col_eq : globalEqns) dof_cols[pos++] = getGlobalDOF(node_gids[node_adj[j]], col_eq);
+            }
+          } else {
+            auto const& offsets = ss_offsets[ss_eqn_pos[eq]];
+            auto const& adj     = ss_adj[ss_eqn_pos[eq]];
+            dof_cols[pos++]     = getGlobalDOF(node_gids[inode], eq);
+            for (auto j = offsets[inode]; j < offsets[inode + 1]; ++j) {
+              for (int col_eq = 0; col_eq < num_eq; ++col_eq) dof_cols[pos++] = getGlobalDOF(node_gids[adj[j]], col_eq);
+            }
+          }
+          for (int e = 0; e < num_ss_eqns; ++e) {
+            for (auto j = ss_offsets[e][inode]; j < ss_offsets[e][inode + 1]; ++j) {
+              dof_cols[pos++] = getGlobalDOF(node_gids[ss_adj[e][j]], ss_eqns[e]);
             }
           }
         }
-      }
+      });
+
+  compressCrsGraph(dof_offsets, dof_cols);
+  m_overlap_jac_factory->setLocalGraph(std::move(dof_offsets), std::move(dof_cols));
+}
+
+void
+STKDiscretization::buildNodeAdjacency(
+    std::vector<stk::mesh::Entity> const& entities,
+    GlobalLocalIndexer const&             ov_node_indexer,
+    std::vector<std::size_t>&             offsets,
+    std::vector<LO>&                      adj) const
+{
+  // Two nodes are adjacent if they belong to the same entity. Each node is
+  // adjacent to itself, provided it belongs to at least one entity.
+  int const num_ov_nodes = ov_node_indexer.getNumLocalElements();
+
+  // Overlap lids of the nodes of each entity, queried once.
+  std::vector<std::size_t> ent_offsets(entities.size() + 1, 0);
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    ent_offsets[i + 1] = ent_offsets[i] + bulkData.num_nodes(entities[i]);
+  }
+  std::vector<LO> ent_nodes(ent_offsets.back());
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(entities[i]);
+    for (auto j = ent_offsets[i]; j < ent_offsets[i + 1]; ++j) {
+      ent_nodes[j] = ov_node_indexer.getLocalElement(gid(node_rels[j - ent_offsets[i]]));
+      ALBANY_PANIC(ent_nodes[j] < 0, "Error! Node of a locally owned entity is not in the overlap node vector space.\n");
     }
   }
+
+  // Count pass (duplicates included), then fill pass.
+  offsets.assign(num_ov_nodes + 1, 0);
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    auto const num_nodes = ent_offsets[i + 1] - ent_offsets[i];
+    for (auto j = ent_offsets[i]; j < ent_offsets[i + 1]; ++j) offsets[ent_nodes[j] + 1] += num_nodes;
+  }
+  for (int inode = 0; inode < num_ov_nodes; ++inode) offsets[inode + 1] += offsets[inode];
+
+  adj.resize(offsets.back());
+  std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    for (auto j = ent_offsets[i]; j < ent_offsets[i + 1]; ++j) {
+      auto& pos = cursor[ent_nodes[j]];
+      for (auto k = ent_offsets[i]; k < ent_offsets[i + 1]; ++k) adj[pos++] = ent_nodes[k];
+    }
+  }
+
+  compressCrsGraph(offsets, adj);
 }
 
 void
@@ -2552,6 +2799,17 @@ STKDiscretization::updateMesh()
     }
     buildSideSetProjectors();
   }
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled() == true) {
+    std::size_t bytes = 0;
+    for (stk::mesh::FieldBase const* field : metaData.get_fields()) {
+      for (stk::mesh::Bucket const* bucket : bulkData.buckets(field->entity_rank())) {
+        bytes += stk::mesh::field_bytes_per_entity(*field, *bucket) * bucket->size();
+      }
+    }
+    mt.setOwnerBytes(MemoryTracker::STK_FIELDS, bytes);
+  }
 }
 
 }  // namespace Albany
@@ -452,6 +452,13 @@ class STKDiscretization : public AbstractDiscretization
     return neq;
   }
 
+  //! Flag if the Jacobian is scattered a node block at a time
+  bool
+  hasBlockJacobian() const
+  {
+    return blockJacobian;
+  }
+
   //! Locate nodal dofs in non-overlapping vectors using local indexing
   int
   getOwnedDOF(int const inode, int const eq) const;
@@ -561,6 +568,15 @@ class STKDiscretization : public AbstractDiscretization
     return outputInterval;
   }
 
+  bool
+  nextWriteIsOutputStep() const;
+
+  void
+  setStateSlotResolver(std::function<void()> const& resolver)
+  {
+    resolve_state_slots_ = resolver;
+  }
+
   //! used when NetCDF output on a latitude-longitude grid is requested.
   // Each struct contains a latitude/longitude index and it's parametric
   // coordinates in an element.
@@ -610,6 +626,10 @@ class STKDiscretization : public AbstractDiscretization
   //! Process coords for ML
   void
   setupMLCoords();
+  //! Fragment of each owned node, i.e., the connected component of the mesh
+  //! it belongs to, numbered consecutively across ranks
+  Teuchos::RCP<Thyra_Vector>
+  computeNodeFragments(int& num_fragments) const;
   //! Process STK mesh for Overlap nodal quantitites
   void
   computeOverlapNodesAndUnknowns();
@@ -761,8 +781,12 @@ class STKDiscretization : public AbstractDiscretization
 
   int outputInterval;
 
+  //! Puts swapped states back into their named mesh fields before output
+  std::function<void()> resolve_state_slots_;
+
   size_t outputFileIdx;
   bool   interleavedOrdering;
+  bool   blockJacobian;
 
   // Boolean for disabling output of initial solution to Exodus file
   bool output_initial_soln_to_exo_file{true};
@@ -788,6 +812,15 @@ class STKDiscretization : public AbstractDiscretization
   void
   computeGraphsUpToFillComplete();
 
+  // Node-to-node adjacency (in overlap node lids, CSR, sorted rows) induced
+  // by the given entities: nodes of the same entity are adjacent.
+  void
+  buildNodeAdjacency(
+      std::vector<stk::mesh::Entity> const& entities,
+      GlobalLocalIndexer const&             ov_node_indexer,
+      std::vector<std::size_t>&             offsets,
+      std::vector<LO>&                      adj) const;
+
   void
   fillCompleteGraphs();
 
@@ -3,7 +3,10 @@
 // in the file license.txt in the top-level Albany directory.
 
 #include <Albany_STKNodeSharing.hpp>
+#include <algorithm>
 #include <stk_util/parallel/CommSparse.hpp>
+#include <utility>
+#include <vector>
 
 #include "Teuchos_TimeMonitor.hpp"
 
@@ -15,40 +18,74 @@ Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Albany Setup: fix_node_sharing");
 
-  stk::CommSparse comm(bulk_data.parallel());
+  int const num_procs = bulk_data.parallel_size();
 
+  // Rather than sending every node to every other proc, each node is sent to
+  // a rendezvous proc picked from its id. The rendezvous proc then tells
+  // each proc that has the node which other procs have it too.
+  std::vector<stk::mesh::EntityKey> keys;
+  const stk::mesh::BucketVector&    buckets = bulk_data.buckets(stk::topology::NODE_RANK);
+  for (size_t j = 0; j < buckets.size(); ++j) {
+    const stk::mesh::Bucket& bucket = *buckets[j];
+    if (bucket.owned()) {
+      for (size_t k = 0; k < bucket.size(); ++k) {
+        keys.push_back(bulk_data.entity_key(bucket[k]));
+      }
+    }
+  }
+
+  stk::CommSparse to_rendezvous(bulk_data.parallel());
+  for (int phase = 0; phase < 2; ++phase) {
+    for (auto const& key : keys) {
+      to_rendezvous.send_buffer(key.id() % num_procs).pack<stk::mesh::EntityKey>(key);
+    }
+
+    if (phase == 0) {
+      to_rendezvous.allocate_buffers();
+    } else {
+      to_rendezvous.communicate();
+    }
+  }
+
+  std::vector<std::pair<stk::mesh::EntityKey, int>> reported;
+  for (int i = 0; i < num_procs; ++i) {
+    while (to_rendezvous.recv_buffer(i).remaining()) {
+      stk::mesh::EntityKey key;
+      to_rendezvous.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+      reported.emplace_back(key, i);
+    }
+  }
+  std::sort(reported.begin(), reported.end());
+
+  stk::CommSparse from_rendezvous(bulk_data.parallel());
   for (int phase = 0; phase < 2; ++phase) {
-    for (int i = 0; i < bulk_data.parallel_size(); ++i) {
-      if (i != bulk_data.parallel_rank()) {
-        const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
-        for (size_t j = 0; j < buckets.size(); ++j) {
-          const stk::mesh::Bucket& bucket = *buckets[j];
-          if (bucket.owned()) {
-            for (size_t k = 0; k < bucket.size(); ++k) {
-              stk::mesh::EntityKey key = bulk_data.entity_key(bucket[k]);
-              comm.send_buffer(i).pack<stk::mesh::EntityKey>(key);
-            }
-          }
+    for (size_t first = 0, last = 0; first < reported.size(); first = last) {
+      while (last < reported.size() && reported[last].first == reported[first].first) ++last;
+      for (size_t a = first; a < last; ++a) {
+        for (size_t b = first; b < last; ++b) {
+          if (a == b) continue;
+          from_rendezvous.send_buffer(reported[a].second).pack<stk::mesh::EntityKey>(reported[a].first);
+          from_rendezvous.send_buffer(reported[a].second).pack<int>(reported[b].second);
         }
       }
     }
 
     if (phase == 0) {
-      comm.allocate_buffers();
+      from_rendezvous.allocate_buffers();
     } else {
-      comm.communicate();
+      from_rendezvous.communicate();
     }
   }
 
-  for (int i = 0; i < bulk_data.parallel_size(); ++i) {
-    if (i != bulk_data.parallel_rank()) {
-      while (comm.recv_buffer(i).remaining()) {
-        stk::mesh::EntityKey key;
-        comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
-        stk::mesh::Entity node = bulk_data.get_entity(key);
-        if (bulk_data.is_valid(node)) {
-          bulk_data.add_node_sharing(node, i);
-        }
+  for (int i = 0; i < num_procs; ++i) {
+    while (from_rendezvous.recv_buffer(i).remaining()) {
+      stk::mesh::EntityKey key;
+      int                  proc;
+      from_rendezvous.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+      from_rendezvous.recv_buffer(i).unpack<int>(proc);
+      stk::mesh::Entity node = bulk_data.get_entity(key);
+      if (bulk_data.is_valid(node)) {
+        bulk_data.add_node_sharing(node, proc);
       }
     }
   }
@@ -9,4 +9,5 @@
 
 PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::DirichletBase)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::Dirichlet)
+PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::DirichletAggregatorBase)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::DirichletAggregator)
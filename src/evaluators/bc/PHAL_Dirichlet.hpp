@@ -5,6 +5,10 @@
 #ifndef PHAL_DIRICHLET_HPP
 #define PHAL_DIRICHLET_HPP
 
+#include <vector>
+
+#include "Albany_KokkosTypes.hpp"
+#include "Albany_ThyraTypes.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
@@ -13,6 +17,10 @@
 #include "Sacado_ParameterAccessor.hpp"
 #include "Teuchos_ParameterList.hpp"
 
+namespace Albany {
+class CombineAndScatterManager;
+}  // namespace Albany
+
 namespace PHAL {
 /** \brief Gathers solution values from the Newton solution vector into
     the nodal fields of the field manager
@@ -94,21 +102,79 @@ class Dirichlet<PHAL::AlbanyTraits::Jacobian, Traits> : public DirichletBase<PHA
 // Evaluator to aggregate all Dirichlet BCs into one "field"
 // **************************************************************
 template <typename EvalT, typename Traits>
-class DirichletAggregator : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
+class DirichletAggregatorBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
 {
  private:
   typedef typename EvalT::ScalarT ScalarT;
 
  public:
-  DirichletAggregator(Teuchos::ParameterList& p);
+  DirichletAggregatorBase(Teuchos::ParameterList& p);
 
   void
   postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm);
+};
+
+template <typename EvalT, typename Traits>
+class DirichletAggregator : public DirichletAggregatorBase<EvalT, Traits>
+{
+ public:
+  DirichletAggregator(Teuchos::ParameterList& p) : DirichletAggregatorBase<EvalT, Traits>(p) {}
 
   // This function will be overloaded with template specialized code
   void evaluateFields(typename Traits::EvalData /* d */){};
 };
 
+// **************************************************************
+// Jacobian: eliminate the rows and columns of all the Dirichlet DOFs
+// recorded in the workset in a single pass over the local matrix.
+// The DOFs of the SDBCs have their off-diagonal row and column entries
+// zeroed. The DOFs of the legacy DBCs have their row zeroed and j_coeff
+// put on the diagonal.
+// **************************************************************
+template <typename Traits>
+class DirichletAggregator<PHAL::AlbanyTraits::Jacobian, Traits> : public DirichletAggregatorBase<PHAL::AlbanyTraits::Jacobian, Traits>
+{
+ public:
+  DirichletAggregator(Teuchos::ParameterList& p);
+
+  void
+  evaluateFields(typename Traits::EvalData d);
+
+  struct PHAL_DirichletElimination_Tag
+  {
+  };
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const PHAL_DirichletElimination_Tag&, int const& row) const;
+
+ private:
+  // Kinds of Dirichlet DOFs in the mask
+  static constexpr ST sdbc_kind = 1.0;
+  static constexpr ST dbc_kind  = 2.0;
+
+  void
+  buildMask(typename Traits::EvalData workset);
+
+  // The mask holds the kind of each local column of J, and of each local
+  // row through the leading owned columns. It is only rebuilt when the
+  // recorded DOFs or the column space of J change.
+  std::vector<LO>                                      sdbc_dofs_;
+  std::vector<LO>                                      dbc_dofs_;
+  GO                                                   num_global_dofs_{0};
+  Teuchos::RCP<Thyra_VectorSpace const>                col_vs_;
+  Teuchos::RCP<Albany::CombineAndScatterManager const> cas_manager_;
+  Teuchos::RCP<Thyra_Vector>                           row_mask_;
+  Teuchos::RCP<Thyra_Vector>                           col_mask_;
+
+  typedef typename PHX::Device::execution_space                              ExecutionSpace;
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_DirichletElimination_Tag> PHAL_DirichletElimination_Policy;
+
+  Albany::DeviceLocalMatrix<ST>  Jac_kokkos;
+  Albany::DeviceView1d<const ST> mask_kokkos;
+  ST                             j_coeff{0.0};
+};
+
 }  // namespace PHAL
 
 #endif  // PHAL_DIRICHLET_HPP
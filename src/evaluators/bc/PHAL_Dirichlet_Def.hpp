@@ -2,12 +2,16 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <algorithm>
+
+#include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_Macros.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "PHAL_Dirichlet.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 // **********************************************************************
 // Genereric Template Code for Constructor and PostRegistrationSetup
@@ -79,7 +83,7 @@ Dirichlet<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename Traits:
   for (auto ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     if (has_nbi == true) {
       auto const& bi_field = stk_disc->getNodeBoundaryIndicator();
-      auto const  ns_gids  = workset.nodeSetGIDs->find(ns_id)->second;
+      auto const& ns_gids  = workset.nodeSetGIDs->find(ns_id)->second;
       auto const  gid      = ns_gids[ns_node] + 1;
       auto const  it       = bi_field.find(gid);
       if (it == bi_field.end()) continue;
@@ -111,26 +115,18 @@ Dirichlet<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
   auto        stk_disc    = dynamic_cast<Albany::STKDiscretization*>(rcp_disc.get());
   auto        x           = workset.x;
   auto        f           = workset.f;
-  auto        J           = workset.Jac;
   auto const  fill        = f != Teuchos::null;
   auto        f_view      = fill ? Albany::getNonconstLocalData(f) : Teuchos::null;
   auto        x_view      = fill ? Albany::getLocalData(x) : Teuchos::null;
-  auto const  j_coeff     = workset.j_coeff;
   auto const  has_nbi     = stk_disc->hasNodeBoundaryIndicator();
   auto const  ns_id       = this->nodeSetID;
   auto const  is_erodible = ns_id.find("erodible") != std::string::npos;
   auto const& ns_nodes    = workset.nodeSets->find(ns_id)->second;
 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1);
-  Teuchos::Array<ST> entries;
-  Teuchos::Array<LO> indices;
-  value[0] = j_coeff;
-
   for (auto ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     if (has_nbi == true) {
       auto const& bi_field = stk_disc->getNodeBoundaryIndicator();
-      auto const  ns_gids  = workset.nodeSetGIDs->find(ns_id)->second;
+      auto const& ns_gids  = workset.nodeSetGIDs->find(ns_id)->second;
       auto const  gid      = ns_gids[ns_node] + 1;
       auto const  it       = bi_field.find(gid);
       if (it == bi_field.end()) continue;
@@ -139,15 +135,10 @@ Dirichlet<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
       if (nbi == 0.0) continue;
     }
     auto const dof = ns_nodes[ns_node][this->offset];
-    index[0]       = dof;
 
-    // Extract the row, zero it out, then put j_coeff on diagonal
-    Albany::getLocalRowValues(J, dof, indices, entries);
-    for (auto& val : entries) {
-      val = 0.0;
-    }
-    Albany::setLocalRowValues(J, dof, indices(), entries());
-    Albany::setLocalRowValues(J, dof, index(), value());
+    // The row is zeroed, with j_coeff on the diagonal, by the Dirichlet
+    // aggregator in one pass over J for all the DBCs.
+    workset.dbc_dofs_.push_back(dof);
 
     if (fill == true) {
       f_view[dof] = x_view[dof] - this->value.val();
@@ -160,7 +151,7 @@ Dirichlet<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
 // **********************************************************************
 
 template <typename EvalT, typename Traits>
-DirichletAggregator<EvalT, Traits>::DirichletAggregator(Teuchos::ParameterList& p)
+DirichletAggregatorBase<EvalT, Traits>::DirichletAggregatorBase(Teuchos::ParameterList& p)
 {
   auto        dl   = p.get<Teuchos::RCP<PHX::DataLayout>>("Data Layout");
   auto const& dbcs = *p.get<Teuchos::RCP<std::vector<std::string>>>("DBC Names");
@@ -178,10 +169,99 @@ DirichletAggregator<EvalT, Traits>::DirichletAggregator(Teuchos::ParameterList&
 // **********************************************************************
 template <typename EvalT, typename Traits>
 void
-DirichletAggregator<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm)
+DirichletAggregatorBase<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm)
 {
   d.fill_field_dependencies(this->dependentFields(), this->evaluatedFields());
 }
 
+// **********************************************************************
+// Specialization: Jacobian
+// **********************************************************************
+template <typename Traits>
+DirichletAggregator<PHAL::AlbanyTraits::Jacobian, Traits>::DirichletAggregator(Teuchos::ParameterList& p)
+    : DirichletAggregatorBase<PHAL::AlbanyTraits::Jacobian, Traits>(p)
+{
+}
+
+// **********************************************************************
+template <typename Traits>
+void
+DirichletAggregator<PHAL::AlbanyTraits::Jacobian, Traits>::buildMask(typename Traits::EvalData workset)
+{
+  auto       J         = workset.Jac;
+  auto       range_vs  = J->range();
+  auto       col_vs    = Albany::getColumnSpace(J);
+  auto const domain_vs = range_vs;  // we are assuming this!
+  auto       comm      = Albany::getComm(range_vs);
+
+  auto& sdbc_dofs = workset.sdbc_dofs_;
+  auto& dbc_dofs  = workset.dbc_dofs_;
+  std::sort(sdbc_dofs.begin(), sdbc_dofs.end());
+  sdbc_dofs.erase(std::unique(sdbc_dofs.begin(), sdbc_dofs.end()), sdbc_dofs.end());
+  std::sort(dbc_dofs.begin(), dbc_dofs.end());
+  dbc_dofs.erase(std::unique(dbc_dofs.begin(), dbc_dofs.end()), dbc_dofs.end());
+
+  // All ranks take part in the scatter if the mask changes on any of them.
+  bool const new_col_vs    = col_vs_.is_null() || Albany::sameAs(col_vs, col_vs_) == false;
+  int const  local_changed = new_col_vs || sdbc_dofs != sdbc_dofs_ || dbc_dofs != dbc_dofs_;
+  int        changed       = 0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, local_changed, Teuchos::ptrFromRef(changed));
+  if (changed == 0) return;
+
+  if (new_col_vs == true) {
+    col_vs_      = col_vs;
+    cas_manager_ = Albany::createCombineAndScatterManager(domain_vs, col_vs);
+    row_mask_    = Thyra::createMember(range_vs);
+    col_mask_    = Thyra::createMember(col_vs);
+  }
+  sdbc_dofs_ = sdbc_dofs;
+  dbc_dofs_  = dbc_dofs;
+
+  row_mask_->assign(0.0);
+  col_mask_->assign(0.0);
+  {
+    auto row_mask_data = Albany::getNonconstLocalData(row_mask_);
+    for (auto const dof : sdbc_dofs_) row_mask_data[dof] = sdbc_kind;
+    for (auto const dof : dbc_dofs_) row_mask_data[dof] = dbc_kind;
+  }
+  cas_manager_->scatter(row_mask_, col_mask_, Albany::CombineMode::INSERT);
+
+  GO const local_num_dofs = sdbc_dofs_.size() + dbc_dofs_.size();
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, local_num_dofs, Teuchos::ptrFromRef(num_global_dofs_));
+}
+
+// **********************************************************************
+template <typename Traits>
+void
+DirichletAggregator<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  this->buildMask(workset);
+  if (num_global_dofs_ == 0) return;
+
+  Jac_kokkos  = Albany::getNonconstDeviceData(workset.Jac);
+  mask_kokkos = Albany::getDeviceData(col_mask_.getConst());
+  j_coeff     = workset.j_coeff;
+  Kokkos::parallel_for(PHAL_DirichletElimination_Policy(0, Jac_kokkos.numRows()), *this);
+}
+
+// **********************************************************************
+// Kokkos kernel
+template <typename Traits>
+KOKKOS_INLINE_FUNCTION void
+DirichletAggregator<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_DirichletElimination_Tag&, int const& row) const
+{
+  // Rows are owned, so they are also the leading columns of the mask.
+  auto const row_kind = mask_kokkos(row);
+  auto       row_view = Jac_kokkos.row(row);
+  for (int entry = 0; entry < row_view.length; ++entry) {
+    auto const col = row_view.colidx(entry);
+    if (col == row) {
+      if (row_kind == dbc_kind) row_view.value(entry) = j_coeff;
+      continue;
+    }
+    if (row_kind != 0.0 || mask_kokkos(col) == sdbc_kind) row_view.value(entry) = 0.0;
+  }
+}
+
 // **********************************************************************
 }  // namespace PHAL
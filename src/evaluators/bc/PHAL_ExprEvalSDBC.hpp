@@ -57,13 +57,6 @@ class ExprEvalSDBC<PHAL::AlbanyTraits::Jacobian, Traits> : public PHAL::Dirichle
 
   void
   evaluateFields(typename Traits::EvalData d);
-
-  void
-  set_row_and_col_is_dbc(typename Traits::EvalData d);
-
- protected:
-  Teuchos::RCP<Thyra_Vector> row_is_dbc_{Teuchos::null};
-  Teuchos::RCP<Thyra_Vector> col_is_dbc_{Teuchos::null};
 };
 
 }  // namespace PHAL
@@ -5,6 +5,9 @@
 #ifndef PHAL_NEUMANN_HPP
 #define PHAL_NEUMANN_HPP
 
+#include <vector>
+
+#include "Albany_DiscretizationUtils.hpp"
 #include "Albany_Layouts.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "Albany_MeshSpecs.hpp"
@@ -168,6 +171,39 @@ class NeumannBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalu
   void
   evaluateNeumannContribution(typename Traits::EvalData d);
 
+  // Geometry of the sides of one element block and local side id. Grouping
+  // the sides this way allows calling Intrepid2 once per group.
+  struct SideGroup
+  {
+    int                                           ebIndex{0};
+    int                                           side{0};
+    Kokkos::DynRankView<int, PHX::Device>         cells;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsCell;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
+  };
+
+  // Geometry of the side set in a workset, and the (block, cell, side) of
+  // each of its sides that it was built for.
+  struct SideSetGeometry
+  {
+    std::vector<int>       side_keys;
+    std::vector<SideGroup> groups;
+    int                    num_blocks{0};
+  };
+
+  bool
+  isSideSetGeometryCurrent(SideSetGeometry const& geometry, Albany::SideSetList::mapped_type const& side_set) const;
+
+  void
+  buildSideSetGeometry(SideSetGeometry& geometry, Albany::SideSetList::mapped_type const& side_set);
+
+  // The side geometry depends on the coordinates only, so it is kept per
+  // workset across evaluations and rebuilt when the mesh changes.
+  std::vector<SideSetGeometry> side_set_geometry;
+
   // Input:
   //! Coordinate vector at vertices
   PHX::MDField<const MeshScalarT, Cell, Vertex, Dim> coordVec;
@@ -182,8 +218,6 @@ class NeumannBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalu
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> intrepidBasis;
 
   // Temporary Views
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsCell_buffer;
-
   Kokkos::DynRankView<ScalarT, PHX::Device> dofCell_buffer;
   Kokkos::DynRankView<ScalarT, PHX::Device> dofCellVec_buffer;
 
@@ -192,12 +226,8 @@ class NeumannBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalu
   Kokkos::DynRankView<RealType, PHX::Device> cubWeightsSide_buffer;
   Kokkos::DynRankView<RealType, PHX::Device> basis_refPointsSide_buffer;
 
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide_det_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_measure_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> side_normals_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> normal_lengths_buffer;
 
@@ -2,6 +2,9 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <map>
+#include <type_traits>
+
 #include "Albany_Application.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
@@ -12,6 +15,7 @@
 #include "Intrepid2_DefaultCubatureFactory.hpp"
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "PHAL_Neumann.hpp"
+#include "PHAL_Utilities.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Topology.hpp"
@@ -218,21 +222,15 @@ NeumannBase<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d,
   // done by Neumann Aggregator
 
   // Allocate Temporary Views
-  physPointsCell_buffer = Kokkos::createDynRankView(coordVec.get_view(), "physPointsCell", numCells * numNodes * cellDims);
-  temporary_buffer      = Kokkos::createDynRankView(coordVec.get_view(), "temporary_buffer", numCells * maxNumQpSide * cellDims * cellDims);
+  temporary_buffer = Kokkos::createDynRankView(coordVec.get_view(), "temporary_buffer", numCells * maxNumQpSide * cellDims * cellDims);
 
   cubPointsSide_buffer       = Kokkos::DynRankView<RealType, PHX::Device>("cubPointsSide", maxNumQpSide * maxSideDim);
   refPointsSide_buffer       = Kokkos::DynRankView<RealType, PHX::Device>("refPointsSide", maxNumQpSide * cellDims);
   cubWeightsSide_buffer      = Kokkos::DynRankView<RealType, PHX::Device>("cubWeightsSide", maxNumQpSide);
   basis_refPointsSide_buffer = Kokkos::DynRankView<RealType, PHX::Device>("basis_refPointsSide", numNodes * maxNumQpSide);
 
-  physPointsSide_buffer            = Kokkos::createDynRankView(coordVec.get_view(), "physPointsSide", numCells * maxNumQpSide * cellDims);
-  jacobianSide_buffer              = Kokkos::createDynRankView(coordVec.get_view(), "jacobianSide", numCells * maxNumQpSide * cellDims * cellDims);
-  jacobianSide_det_buffer          = Kokkos::createDynRankView(coordVec.get_view(), "jacobianSide", numCells * maxNumQpSide);
-  weighted_measure_buffer          = Kokkos::createDynRankView(coordVec.get_view(), "weighted_measure", numCells * maxNumQpSide);
-  trans_basis_refPointsSide_buffer = Kokkos::createDynRankView(coordVec.get_view(), "trans_basis_refPointsSide", numCells * numNodes * maxNumQpSide);
-  weighted_trans_basis_refPointsSide_buffer =
-      Kokkos::createDynRankView(coordVec.get_view(), "weighted_trans_basis_refPointsSide", numCells * numNodes * maxNumQpSide);
+  jacobianSide_det_buffer = Kokkos::createDynRankView(coordVec.get_view(), "jacobianSide", numCells * maxNumQpSide);
+  weighted_measure_buffer = Kokkos::createDynRankView(coordVec.get_view(), "weighted_measure", numCells * maxNumQpSide);
   side_normals_buffer   = Kokkos::createDynRankView(coordVec.get_view(), "side_normals", numCells * maxNumQpSide * cellDims);
   normal_lengths_buffer = Kokkos::createDynRankView(coordVec.get_view(), "normal_lengths", numCells * maxNumQpSide);
 
@@ -279,35 +277,42 @@ NeumannBase<EvalT, Traits>::evaluateNeumannContribution(typename Traits::EvalDat
   // "data" is same as neumann -- always ScalarT but not always
   // with full deriv dimension of a ScalarT variable.
 
-  // std::cout << "NN0 " << std::endl;
-  switch (bc_type) {
-    case INTJUMP:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case ROBIN:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case STEFAN_BOLTZMANN:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case NORMAL:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case PRESS:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case TRACTION:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    case CLOSED_FORM:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-    default:
-      neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
-      break;
-  }
+  // Both only depend on the layouts and are allocated once, except that the
+  // types that take their derivatives from dof follow its deriv dimension,
+  // which can change between evaluations (e.g. with the number of
+  // parameters of a Tangent evaluation).
+  bool const from_dof          = bc_type == ROBIN || bc_type == STEFAN_BOLTZMANN || bc_type == CLOSED_FORM;
+  bool const deriv_dim_changed = from_dof == true && PHAL::getDerivativeDimensionsFromView(neumann) != PHAL::getDerivativeDimensionsFromView(dof.get_view());
+  if (neumann.data() == nullptr || deriv_dim_changed == true) {
+    switch (bc_type) {
+      case INTJUMP:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case ROBIN:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case STEFAN_BOLTZMANN:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case NORMAL:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case PRESS:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case TRACTION:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      case CLOSED_FORM:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(dof.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+      default:
+        neumann = Kokkos::createDynRankViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(coordVec.get_view(), "DDN", numCells, numNodes, numDOFsSet);
+        break;
+    }
 
-  data_buffer = Kokkos::createDynRankView(neumann, "data", numCells * maxNumQpSide * numDOFsSet);
+    data_buffer = Kokkos::createDynRankView(neumann, "data", numCells * maxNumQpSide * numDOFsSet);
+  }
 
   // Needed?
   Kokkos::deep_copy(neumann, 0.0);
@@ -391,29 +396,141 @@ NeumannBase<EvalT, Traits>::evaluateNeumannContribution(typename Traits::EvalDat
   }
 #endif
 
-  using DynRankViewRealT       = Kokkos::DynRankView<RealType, PHX::Device>;
-  using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
-  using DynRankViewScalarT     = Kokkos::DynRankView<ScalarT, PHX::Device>;
-
-  DynRankViewRealT cubPointsSide;
-  DynRankViewRealT refPointsSide;
-  DynRankViewRealT cubWeightsSide;
-  DynRankViewRealT basis_refPointsSide;
+  using DynRankViewScalarT = Kokkos::DynRankView<ScalarT, PHX::Device>;
 
-  DynRankViewMeshScalarT physPointsSide;
-  DynRankViewMeshScalarT jacobianSide;
-  DynRankViewMeshScalarT jacobianSide_det;
-  DynRankViewMeshScalarT weighted_measure;
-  DynRankViewMeshScalarT trans_basis_refPointsSide;
-  DynRankViewMeshScalarT weighted_trans_basis_refPointsSide;
-  DynRankViewMeshScalarT physPointsCell;
+  if (side_set_geometry.size() != numWorksets) {
+    side_set_geometry.resize(numWorksets);
+  }
+  auto& geometry = side_set_geometry[worksetNum];
+  if (isSideSetGeometryCurrent(geometry, side_set) == false) {
+    buildSideSetGeometry(geometry, side_set);
+  }
+  numBlocks = geometry.num_blocks;
 
   DynRankViewScalarT dofSide;
-  DynRankViewScalarT dofSideVec;
   DynRankViewScalarT dofCell;
-  DynRankViewScalarT dofCellVec;
   DynRankViewScalarT data;
 
+  // Loop over the sides that form the boundary condition
+  for (auto const& group : geometry.groups) {
+    int const side       = group.side;
+    int const numCells_  = group.cells.extent(0);
+    int const numQPsSide = cubatureSide[side]->getNumPoints();
+
+    auto const& cellVec                            = group.cells;
+    auto const& physPointsSide                     = group.physPointsSide;
+    auto const& jacobianSide                       = group.jacobianSide;
+    auto const& weighted_trans_basis_refPointsSide = group.weighted_trans_basis_refPointsSide;
+
+    // Map cell (reference) degree of freedom points to the appropriate side
+    // (elem_side)
+    if (bc_type == ROBIN || bc_type == STEFAN_BOLTZMANN) {
+      dofCell = Kokkos::createViewWithType<DynRankViewScalarT>(dofCell_buffer, dofCell_buffer.data(), numCells_, numNodes, numDOFsSet);
+      dofSide = Kokkos::createViewWithType<DynRankViewScalarT>(dofSide_buffer, dofSide_buffer.data(), numCells_, numQPsSide, numDOFsSet);
+
+      Kokkos::deep_copy(dofCell, 0.0);
+      for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
+        for (std::size_t node = 0; node < numNodes; ++node) {
+          for (std::size_t icomp = 0; icomp < numDOFsSet; ++icomp) {
+            if (vectorDOF) {
+              dofCell(iCell, node, icomp) = dof(cellVec(iCell), node, this->offset[icomp]);
+            } else {
+              dofCell(iCell, node, icomp) = dof(cellVec(iCell), node);
+            }
+          }
+        }
+      }
+
+      // This is needed, since evaluate currently sums into
+      Kokkos::deep_copy(dofSide, 0.0);
+
+      for (std::size_t icomp = 0; icomp < numDOFsSet; ++icomp) {
+        IFST::evaluate(
+            Kokkos::subview(dofSide, Kokkos::ALL(), Kokkos::ALL(), icomp),
+            Kokkos::subview(dofCell, Kokkos::ALL(), Kokkos::ALL(), icomp),
+            group.trans_basis_refPointsSide);
+      }
+    }
+
+    // Transform the given BC data to the physical space QPs in each side
+    // (elem_side)
+    data = Kokkos::createViewWithType<DynRankViewScalarT>(data_buffer, data_buffer.data(), numCells_, numQPsSide, numDOFsSet);
+
+    // Note: if you add a BC here, you need to add it above as well
+    // to allocate neumann correctly.
+    switch (bc_type) {
+      case INTJUMP: {
+        ScalarT const elem_scale = matScaling[group.ebIndex];
+        calc_dudn_const(data, elem_scale);
+        break;
+      }
+
+      case ROBIN: calc_dudn_robin(data, dofSide); break;
+
+      case STEFAN_BOLTZMANN: calc_dudn_radiate(data, dofSide); break;
+
+      case NORMAL: calc_dudn_const(data); break;
+
+      case PRESS: calc_press(data, jacobianSide, *cellType, side); break;
+
+      case ACEPRESS: calc_ace_press(data, physPointsSide, jacobianSide, *cellType, side, worksetNum, workset.current_time); break;
+
+      case ACEPRESS_HYDROSTATIC: calc_ace_press_hydrostatic(data, physPointsSide, jacobianSide, *cellType, side, worksetNum, workset.current_time); break;
+
+      case TRACTION: calc_traction_components(data); break;
+      case CLOSED_FORM: calc_closed_form(data, physPointsSide, jacobianSide, *cellType, side, workset); break;
+      default: calc_gradu_dotn_const(data, jacobianSide, *cellType, side); break;
+    }
+
+    // Put this side's contribution into the vector
+    for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
+      int cell = cellVec(iCell);
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        for (std::size_t qp = 0; qp < numQPsSide; ++qp) {
+          for (std::size_t dim = 0; dim < numDOFsSet; ++dim) {
+            neumann(cell, node, dim) += data(iCell, qp, dim) * weighted_trans_basis_refPointsSide(iCell, node, qp);
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename EvalT, typename Traits>
+bool
+NeumannBase<EvalT, Traits>::isSideSetGeometryCurrent(SideSetGeometry const& geometry, Albany::SideSetList::mapped_type const& side_set) const
+{
+  // Coordinates that depend on the solution change with every evaluation.
+  if (std::is_same<MeshScalarT, RealType>::value == false) return false;
+
+  // The side set is rebuilt when the mesh changes.
+  if (geometry.side_keys.size() != 3 * side_set.size()) return false;
+  for (std::size_t i = 0; i < side_set.size(); ++i) {
+    if (geometry.side_keys[3 * i + 0] != side_set[i].elem_ebIndex) return false;
+    if (geometry.side_keys[3 * i + 1] != side_set[i].elem_LID) return false;
+    if (geometry.side_keys[3 * i + 2] != side_set[i].side_local_id) return false;
+  }
+
+  // And so are the coordinates when the mesh moves.
+  for (auto const& group : geometry.groups) {
+    for (std::size_t iCell = 0; iCell < group.cells.extent(0); ++iCell) {
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        for (std::size_t dim = 0; dim < cellDims; ++dim) {
+          if (group.physPointsCell(iCell, node, dim) != coordVec(group.cells(iCell), node, dim)) return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <typename EvalT, typename Traits>
+void
+NeumannBase<EvalT, Traits>::buildSideSetGeometry(SideSetGeometry& geometry, Albany::SideSetList::mapped_type const& side_set)
+{
+  using DynRankViewRealT       = Kokkos::DynRankView<RealType, PHX::Device>;
+  using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
+
   //! For each element block, and for each local side id (e.g. side_id=0,1,2,3,4
   //! for a Prism) we want to identify all the physical cells associated to that
   //! side id and block. In this way we can group them and call Intrepid2
@@ -423,10 +540,12 @@ NeumannBase<EvalT, Traits>::evaluateNeumannContribution(typename Traits::EvalDat
   //! we do not know before the evaluator how many cells are associated to a
   //! local side id.
 
-  std::map<int, int>                                              ordinalEbIndex;
-  std::vector<int>                                                ebIndexVec;
-  std::vector<std::vector<int>>                                   numCellsOnSidesOnBlocks;
-  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device>>> cellsOnSidesOnBlocks;
+  std::map<int, int>            ordinalEbIndex;
+  std::vector<int>              ebIndexVec;
+  std::vector<std::vector<int>> numCellsOnSidesOnBlocks;
+
+  geometry.side_keys.clear();
+  geometry.side_keys.reserve(3 * side_set.size());
   for (auto const& it_side : side_set) {
     int const ebIndex   = it_side.elem_ebIndex;
     int const elem_side = it_side.side_local_id;
@@ -437,12 +556,25 @@ NeumannBase<EvalT, Traits>::evaluateNeumannContribution(typename Traits::EvalDat
     }
 
     numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
+
+    geometry.side_keys.push_back(ebIndex);
+    geometry.side_keys.push_back(it_side.elem_LID);
+    geometry.side_keys.push_back(elem_side);
   }
-  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
+
+  // Groups are ordered by block and then by side, and hold their cells in the
+  // order of the side set.
+  std::vector<std::vector<int>> groupOnSidesOnBlocks(ordinalEbIndex.size(), std::vector<int>(numSidesOnElem, -1));
+  geometry.groups.clear();
   for (int ib = 0; ib < ordinalEbIndex.size(); ib++) {
-    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
     for (int is = 0; is < numSidesOnElem; is++) {
-      cellsOnSidesOnBlocks[ib][is]    = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
+      if (numCellsOnSidesOnBlocks[ib][is] == 0) continue;
+      SideGroup group;
+      group.ebIndex                = ebIndexVec[ib];
+      group.side                   = is;
+      group.cells                  = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
+      groupOnSidesOnBlocks[ib][is] = geometry.groups.size();
+      geometry.groups.push_back(group);
       numCellsOnSidesOnBlocks[ib][is] = 0;
     }
   }
@@ -452,152 +584,77 @@ NeumannBase<EvalT, Traits>::evaluateNeumannContribution(typename Traits::EvalDat
     int const elem_LID  = it_side.elem_LID;
     int const elem_side = it_side.side_local_id;
 
-    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
+    geometry.groups[groupOnSidesOnBlocks[iBlock][elem_side]].cells(numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
   }
 
-  numBlocks = ordinalEbIndex.size();
-  // Loop over the sides that form the boundary condition
-  for (int iblock = 0; iblock < numBlocks; ++iblock) {
-    for (int side = 0; side < numSidesOnElem; ++side) {
-      int numCells_ = numCellsOnSidesOnBlocks[iblock][side];
-      if (numCells_ == 0) continue;
-
-      // Get the data that corresponds to the side
-
-      int sideDims   = sideType[side]->getDimension();
-      int numQPsSide = cubatureSide[side]->getNumPoints();
-
-      Kokkos::DynRankView<int, PHX::Device> cellVec = cellsOnSidesOnBlocks[iblock][side];
-
-      // need to resize containers because they depend on side topology
-      cubPointsSide       = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
-      refPointsSide       = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
-      cubWeightsSide      = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
-      basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
-
-      physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
-      jacobianSide =
-          Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
-      jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
-      weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
-      trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(
-          trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-      weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(
-          weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-      physPointsCell = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
-
-      cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
-
-      // Copy the coordinate data over to a temp container
-      for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
-        for (std::size_t node = 0; node < numNodes; ++node) {
-          for (std::size_t dim = 0; dim < cellDims; ++dim) {
-            physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell), node, dim);
-          }
-        }
-      }
-
-      // Map side cubature points to the reference parent cell based on the
-      // appropriate side (elem_side)
-      ICT::mapToReferenceSubcell(refPointsSide, cubPointsSide, sideDims, side, *cellType);
-
-      // Calculate side geometry
-      ICT::setJacobian(jacobianSide, refPointsSide, physPointsCell, *cellType);
-
-      ICT::setJacobianDet(jacobianSide_det, jacobianSide);
-
-      if (sideDims < 2) {  // for 1 and 2D, get weighted edge measure
-        IFST::computeEdgeMeasure(weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-      } else {  // for 3D, get weighted face measure
-        IFST::computeFaceMeasure(weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-      }
-
-      // Values of the basis functions at side cubature points, in the reference
-      // parent cell domain
-      intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
-
-      // Transform values of the basis functions
-      IFST::HGRADtransformVALUE(trans_basis_refPointsSide, basis_refPointsSide);
-
-      // Multiply with weighted measure
-      IFST::multiplyMeasure(weighted_trans_basis_refPointsSide, weighted_measure, trans_basis_refPointsSide);
-
-      // Map cell (reference) cubature points to the appropriate side
-      // (elem_side) in physical space
-      ICT::mapToPhysicalFrame(physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
-
-      // Map cell (reference) degree of freedom points to the appropriate side
-      // (elem_side)
-      if (bc_type == ROBIN || bc_type == STEFAN_BOLTZMANN) {
-        dofCell = Kokkos::createViewWithType<DynRankViewScalarT>(dofCell_buffer, dofCell_buffer.data(), numCells_, numNodes, numDOFsSet);
-        dofSide = Kokkos::createViewWithType<DynRankViewScalarT>(dofSide_buffer, dofSide_buffer.data(), numCells_, numQPsSide, numDOFsSet);
-
-        Kokkos::deep_copy(dofCell, 0.0);
-        for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
-          for (std::size_t node = 0; node < numNodes; ++node) {
-            for (std::size_t icomp = 0; icomp < numDOFsSet; ++icomp) {
-              if (vectorDOF) {
-                dofCell(iCell, node, icomp) = dof(cellVec(iCell), node, this->offset[icomp]);
-              } else {
-                dofCell(iCell, node, icomp) = dof(cellVec(iCell), node);
-              }
-            }
-          }
-        }
-
-        // This is needed, since evaluate currently sums into
-        Kokkos::deep_copy(dofSide, 0.0);
-
-        for (std::size_t icomp = 0; icomp < numDOFsSet; ++icomp) {
-          IFST::evaluate(
-              Kokkos::subview(dofSide, Kokkos::ALL(), Kokkos::ALL(), icomp),
-              Kokkos::subview(dofCell, Kokkos::ALL(), Kokkos::ALL(), icomp),
-              trans_basis_refPointsSide);
+  geometry.num_blocks = ordinalEbIndex.size();
+
+  for (auto& group : geometry.groups) {
+    int const side      = group.side;
+    int const numCells_ = group.cells.extent(0);
+
+    // Get the data that corresponds to the side
+    int const sideDims   = sideType[side]->getDimension();
+    int const numQPsSide = cubatureSide[side]->getNumPoints();
+
+    // need to resize containers because they depend on side topology
+    DynRankViewRealT cubPointsSide       = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
+    DynRankViewRealT refPointsSide       = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
+    DynRankViewRealT cubWeightsSide      = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
+    DynRankViewRealT basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
+
+    DynRankViewMeshScalarT jacobianSide_det =
+        Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
+    DynRankViewMeshScalarT weighted_measure =
+        Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
+
+    // These are kept for the evaluations to come
+    group.physPointsCell            = Kokkos::createDynRankView(coordVec.get_view(), "physPointsCell", numCells_, numNodes, cellDims);
+    group.physPointsSide            = Kokkos::createDynRankView(coordVec.get_view(), "physPointsSide", numCells_, numQPsSide, cellDims);
+    group.jacobianSide              = Kokkos::createDynRankView(coordVec.get_view(), "jacobianSide", numCells_, numQPsSide, cellDims, cellDims);
+    group.trans_basis_refPointsSide = Kokkos::createDynRankView(coordVec.get_view(), "trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+    group.weighted_trans_basis_refPointsSide =
+        Kokkos::createDynRankView(coordVec.get_view(), "weighted_trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+
+    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
+
+    // Copy the coordinate data over to a temp container
+    for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        for (std::size_t dim = 0; dim < cellDims; ++dim) {
+          group.physPointsCell(iCell, node, dim) = coordVec(group.cells(iCell), node, dim);
         }
       }
+    }
 
-      // Transform the given BC data to the physical space QPs in each side
-      // (elem_side)
-      data = Kokkos::createViewWithType<Kokkos::DynRankView<ScalarT, PHX::Device>>(data_buffer, data_buffer.data(), numCells_, numQPsSide, numDOFsSet);
-
-      // Note: if you add a BC here, you need to add it above as well
-      // to allocate neumann correctly.
-      switch (bc_type) {
-        case INTJUMP: {
-          ScalarT const elem_scale = matScaling[ebIndexVec[iblock]];
-          calc_dudn_const(data, elem_scale);
-          break;
-        }
-
-        case ROBIN: calc_dudn_robin(data, dofSide); break;
+    // Map side cubature points to the reference parent cell based on the
+    // appropriate side (elem_side)
+    ICT::mapToReferenceSubcell(refPointsSide, cubPointsSide, sideDims, side, *cellType);
 
-        case STEFAN_BOLTZMANN: calc_dudn_radiate(data, dofSide); break;
+    // Calculate side geometry
+    ICT::setJacobian(group.jacobianSide, refPointsSide, group.physPointsCell, *cellType);
 
-        case NORMAL: calc_dudn_const(data); break;
+    ICT::setJacobianDet(jacobianSide_det, group.jacobianSide);
 
-        case PRESS: calc_press(data, jacobianSide, *cellType, side); break;
+    if (sideDims < 2) {  // for 1 and 2D, get weighted edge measure
+      IFST::computeEdgeMeasure(weighted_measure, group.jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+    } else {  // for 3D, get weighted face measure
+      IFST::computeFaceMeasure(weighted_measure, group.jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+    }
 
-        case ACEPRESS: calc_ace_press(data, physPointsSide, jacobianSide, *cellType, side, worksetNum, workset.current_time); break;
+    // Values of the basis functions at side cubature points, in the reference
+    // parent cell domain
+    intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
 
-        case ACEPRESS_HYDROSTATIC: calc_ace_press_hydrostatic(data, physPointsSide, jacobianSide, *cellType, side, worksetNum, workset.current_time); break;
+    // Transform values of the basis functions
+    IFST::HGRADtransformVALUE(group.trans_basis_refPointsSide, basis_refPointsSide);
 
-        case TRACTION: calc_traction_components(data); break;
-        case CLOSED_FORM: calc_closed_form(data, physPointsSide, jacobianSide, *cellType, side, workset); break;
-        default: calc_gradu_dotn_const(data, jacobianSide, *cellType, side); break;
-      }
+    // Multiply with weighted measure
+    IFST::multiplyMeasure(group.weighted_trans_basis_refPointsSide, weighted_measure, group.trans_basis_refPointsSide);
 
-      // Put this side's contribution into the vector
-      for (std::size_t iCell = 0; iCell < numCells_; ++iCell) {
-        int cell = cellVec(iCell);
-        for (std::size_t node = 0; node < numNodes; ++node) {
-          for (std::size_t qp = 0; qp < numQPsSide; ++qp) {
-            for (std::size_t dim = 0; dim < numDOFsSet; ++dim) {
-              neumann(cell, node, dim) += data(iCell, qp, dim) * weighted_trans_basis_refPointsSide(iCell, node, qp);
-            }
-          }
-        }
-      }
-    }
+    // Map cell (reference) cubature points to the appropriate side
+    // (elem_side) in physical space
+    ICT::mapToPhysicalFrame(group.physPointsSide, refPointsSide, group.physPointsCell, intrepidBasis);
   }
 }
 
@@ -54,13 +54,6 @@ class SDirichlet<PHAL::AlbanyTraits::Jacobian, Traits> : public PHAL::DirichletB
 
   void
   evaluateFields(typename Traits::EvalData d);
-
-  void
-  set_row_and_col_is_dbc(typename Traits::EvalData d);
-
- protected:
-  Teuchos::RCP<Thyra_Vector> row_is_dbc_;
-  Teuchos::RCP<Thyra_Vector> col_is_dbc_;
 };
 
 }  // namespace PHAL
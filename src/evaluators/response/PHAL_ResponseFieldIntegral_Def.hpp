@@ -205,7 +205,10 @@ template <typename EvalT, typename Traits>
 void
 PHAL::ResponseFieldIntegral<EvalT, Traits>::postEvaluate(typename Traits::PostEvalData workset)
 {
-  PHAL::reduceAll<ScalarT>(*workset.comm, Teuchos::REDUCE_SUM, this->global_response_eval);
+  // Responses evaluated with the residual are reduced together by Application
+  if (workset.defer_response_reduction == false) {
+    PHAL::reduceAll<ScalarT>(*workset.comm, Teuchos::REDUCE_SUM, this->global_response_eval);
+  }
   // Do global scattering
   PHAL::SeparableScatterScalarResponse<EvalT, Traits>::postEvaluate(workset);
 }
@@ -105,6 +105,9 @@ MortarContactResidual<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(type
 #if defined(ALBANY_TIMER)
   auto start = std::chrono::high_resolution_clock::now();
 #endif
+  // Move the contact interfaces to the current configuration once per fill
+  if (workset.wsIndex == 0) workset.disc->getContactManager()->updateContact(*workset.x, workset.current_time);
+
   // Get map for local data structures
   nodeID = workset.wsElNodeEqID;
 
@@ -381,6 +384,9 @@ MortarContactResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(type
 #if defined(ALBANY_TIMER)
   auto start = std::chrono::high_resolution_clock::now();
 #endif
+  // Move the contact interfaces to the current configuration once per fill
+  if (workset.wsIndex == 0) workset.disc->getContactManager()->updateContact(*workset.x, workset.current_time);
+
   // Get map for local data structures
   nodeID = workset.wsElNodeEqID;
 
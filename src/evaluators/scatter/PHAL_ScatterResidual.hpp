@@ -189,6 +189,15 @@ class ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits> : public ScatterResi
   struct PHAL_ScatterJacRank2_Tag
   {
   };
+  struct PHAL_ScatterJacRank0_Block_Tag
+  {
+  };
+  struct PHAL_ScatterJacRank1_Block_Tag
+  {
+  };
+  struct PHAL_ScatterJacRank2_Block_Tag
+  {
+  };
 
   KOKKOS_INLINE_FUNCTION
   void
@@ -220,7 +229,26 @@ class ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits> : public ScatterResi
   void
   operator()(const PHAL_ScatterJacRank2_Tag&, const int& cell) const;
 
+  // Block Jacobian kernels: all the dof rows of a node share the same
+  // columns, so the value offsets are looked up once per node pair and
+  // reused for every row of the node.
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const PHAL_ScatterJacRank0_Block_Tag&, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const PHAL_ScatterJacRank1_Block_Tag&, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const PHAL_ScatterJacRank2_Block_Tag&, const int& cell) const;
+
  private:
+  // Positions, relative to the start of the row, of the cell unknowns in
+  // the given local row of the Jacobian; -1 for columns not in the row
+  KOKKOS_INLINE_FUNCTION
+  void
+  blockColumnOffsets(int const cell, LO const row, LO* offsets) const;
+
   int                           neq, nunk, numDims;
   Albany::DeviceLocalMatrix<ST> Jac_kokkos;
 
@@ -239,6 +267,9 @@ class ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits> : public ScatterResi
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank2_Tag>         PHAL_ScatterResRank2_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Adjoint_Tag> PHAL_ScatterJacRank2_Adjoint_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Tag>         PHAL_ScatterJacRank2_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank0_Block_Tag>   PHAL_ScatterJacRank0_Block_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank1_Block_Tag>   PHAL_ScatterJacRank1_Block_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Block_Tag>   PHAL_ScatterJacRank2_Block_Policy;
 };
 
 }  // namespace PHAL
@@ -427,6 +427,111 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
   }
 }
 
+template <typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::blockColumnOffsets(int const cell, LO const row, LO* offsets) const
+{
+  // Column indices in the local rows are sorted. The dofs of a node are
+  // usually contiguous in the column map, so one search per node suffices;
+  // otherwise fall back to a search per dof. Columns missing from the row
+  // get a negative offset and are skipped, as sumIntoValues does.
+  auto const start = Jac_kokkos.graph.row_map(row);
+  LO const   len   = Jac_kokkos.graph.row_map(row + 1) - start;
+
+  auto find = [&](LO const col) {
+    LO lo = 0, hi = len;
+    while (lo < hi) {
+      LO const mid = (lo + hi) / 2;
+      if (Jac_kokkos.graph.entries(start + mid) < col)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  };
+
+  for (int node_col = 0; node_col < this->numNodes; node_col++) {
+    LO const first = find(nodeID(cell, node_col, 0));
+    for (int eq_col = 0; eq_col < neq; eq_col++) {
+      LO const col = nodeID(cell, node_col, eq_col);
+      LO       pos = first + eq_col;
+      if (pos >= len || Jac_kokkos.graph.entries(start + pos) != col) pos = find(col);
+      if (pos >= len || Jac_kokkos.graph.entries(start + pos) != col) pos = -1;
+      offsets[neq * node_col + eq_col] = pos;
+    }
+  }
+}
+
+template <typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank0_Block_Tag&, int const& cell) const
+{
+  LO offsets[500];
+
+  if (nunk > 500) {
+    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
+  }
+
+  for (int node = 0; node < this->numNodes; ++node) {
+    blockColumnOffsets(cell, nodeID(cell, node, this->offset), offsets);
+    for (int eq = 0; eq < numFields; eq++) {
+      auto const start  = Jac_kokkos.graph.row_map(nodeID(cell, node, this->offset + eq));
+      auto       valptr = val_kokkos[eq](cell, node);
+      for (int lunk = 0; lunk < nunk; ++lunk) {
+        if (offsets[lunk] >= 0) Kokkos::atomic_add(&Jac_kokkos.values(start + offsets[lunk]), valptr.fastAccessDx(lunk));
+      }
+    }
+  }
+}
+
+template <typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank1_Block_Tag&, int const& cell) const
+{
+  LO offsets[500];
+
+  if (nunk > 500) {
+    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
+  }
+
+  for (int node = 0; node < this->numNodes; ++node) {
+    blockColumnOffsets(cell, nodeID(cell, node, this->offset), offsets);
+    for (int eq = 0; eq < numFields; eq++) {
+      if (((this->valVec)(cell, node, eq)).hasFastAccess()) {
+        auto const start = Jac_kokkos.graph.row_map(nodeID(cell, node, this->offset + eq));
+        for (int lunk = 0; lunk < nunk; ++lunk) {
+          if (offsets[lunk] >= 0) Kokkos::atomic_add(&Jac_kokkos.values(start + offsets[lunk]), (this->valVec)(cell, node, eq).fastAccessDx(lunk));
+        }
+      }
+    }
+  }
+}
+
+template <typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank2_Block_Tag&, int const& cell) const
+{
+  LO offsets[500];
+
+  if (nunk > 500) {
+    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
+  }
+
+  for (int node = 0; node < this->numNodes; ++node) {
+    blockColumnOffsets(cell, nodeID(cell, node, this->offset), offsets);
+    for (int eq = 0; eq < numFields; eq++) {
+      if (((this->valTensor)(cell, node, eq / numDims, eq % numDims)).hasFastAccess()) {
+        auto const start = Jac_kokkos.graph.row_map(nodeID(cell, node, this->offset + eq));
+        for (int lunk = 0; lunk < nunk; ++lunk) {
+          if (offsets[lunk] < 0) continue;
+          Kokkos::atomic_add(
+              &Jac_kokkos.values(start + offsets[lunk]), (this->valTensor)(cell, node, eq / numDims, eq % numDims).fastAccessDx(lunk));
+        }
+      }
+    }
+  }
+}
+
 // **********************************************************************
 template <typename Traits>
 void
@@ -461,6 +566,9 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
     if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank0_Adjoint_Policy(0, workset.numCells), *this);
       cudaCheckError();
+    } else if (workset.block_jacobian) {
+      Kokkos::parallel_for(PHAL_ScatterJacRank0_Block_Policy(0, workset.numCells), *this);
+      cudaCheckError();
     } else {
       Kokkos::parallel_for(PHAL_ScatterJacRank0_Policy(0, workset.numCells), *this);
       cudaCheckError();
@@ -474,6 +582,9 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
     if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank1_Adjoint_Policy(0, workset.numCells), *this);
       cudaCheckError();
+    } else if (workset.block_jacobian) {
+      Kokkos::parallel_for(PHAL_ScatterJacRank1_Block_Policy(0, workset.numCells), *this);
+      cudaCheckError();
     } else {
       Kokkos::parallel_for(PHAL_ScatterJacRank1_Policy(0, workset.numCells), *this);
       cudaCheckError();
@@ -488,6 +599,9 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
 
     if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank2_Adjoint_Policy(0, workset.numCells), *this);
+    } else if (workset.block_jacobian) {
+      Kokkos::parallel_for(PHAL_ScatterJacRank2_Block_Policy(0, workset.numCells), *this);
+      cudaCheckError();
     } else {
       Kokkos::parallel_for(PHAL_ScatterJacRank2_Policy(0, workset.numCells), *this);
       cudaCheckError();
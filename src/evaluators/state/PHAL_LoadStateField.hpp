@@ -34,6 +34,7 @@ class LoadStateFieldBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX
   PHX::MDField<ScalarType> data;
   std::string              fieldName;
   std::string              stateName;
+  Albany::StateHandle      stateHandle{-1};
 };
 
 template <typename EvalT, typename Traits>
@@ -54,6 +55,7 @@ class LoadStateField : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Ev
   PHX::MDField<ParamScalarT> data;
   std::string                fieldName;
   std::string                stateName;
+  Albany::StateHandle        stateHandle{-1};
 };
 
 // Shortcut names
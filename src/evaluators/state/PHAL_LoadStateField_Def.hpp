@@ -17,6 +17,7 @@ LoadStateFieldBase<EvalT, Traits, ScalarType>::LoadStateFieldBase(Teuchos::Param
 {
   fieldName = p.get<std::string>("Field Name");
   stateName = p.get<std::string>("State Name");
+  if (p.isParameter("State Handle")) stateHandle = p.get<Albany::StateHandle>("State Handle");
 
   PHX::MDField<ScalarType> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout>>("State Field Layout"));
   data = f;
@@ -40,7 +41,7 @@ template <typename EvalT, typename Traits, typename ScalarType>
 void
 LoadStateFieldBase<EvalT, Traits, ScalarType>::evaluateFields(typename Traits::EvalData workset)
 {
-  const Albany::MDArray&            stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray&            stateToLoad = workset.getStateArray(stateName, stateHandle);
   PHAL::MDFieldIterator<ScalarType> d(data);
   for (int i = 0; !d.done() && i < stateToLoad.size(); ++d, ++i) *d = stateToLoad[i];
   for (; !d.done(); ++d) *d = 0.;
@@ -51,6 +52,7 @@ LoadStateField<EvalT, Traits>::LoadStateField(Teuchos::ParameterList const& p)
 {
   fieldName = p.get<std::string>("Field Name");
   stateName = p.get<std::string>("State Name");
+  if (p.isParameter("State Handle")) stateHandle = p.get<Albany::StateHandle>("State Handle");
 
   PHX::MDField<ParamScalarT> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout>>("State Field Layout"));
   data = f;
@@ -77,7 +79,7 @@ LoadStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   // cout << "LoadStateField importing state " << stateName << " to field "
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray&              stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray&              stateToLoad = workset.getStateArray(stateName, stateHandle);
   PHAL::MDFieldIterator<ParamScalarT> d(data);
   for (int i = 0; !d.done() && i < stateToLoad.size(); ++d, ++i) *d = stateToLoad[i];
   for (; !d.done(); ++d) *d = 0.;
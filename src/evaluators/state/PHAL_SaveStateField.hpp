@@ -61,6 +61,7 @@ class SaveStateField<PHAL::AlbanyTraits::Residual, Traits> : public PHX::Evaluat
   PHX::MDField<ScalarT const> field;
   std::string                 fieldName;
   std::string                 stateName;
+  Albany::StateHandle         stateHandle{-1};
 
   bool nodalState;
   bool worksetState;
@@ -40,6 +40,7 @@ SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::SaveStateField(Teuchos::Pa
 {
   fieldName = p.get<std::string>("Field Name");
   stateName = p.get<std::string>("State Name");
+  if (p.isParameter("State Handle")) stateHandle = p.get<Albany::StateHandle>("State Handle");
 
   Teuchos::RCP<PHX::DataLayout> layout = p.get<Teuchos::RCP<PHX::DataLayout>>("State Field Layout");
   field                                = decltype(field)(fieldName, layout);
@@ -99,12 +100,16 @@ SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::saveElemState(typename Tra
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  if (stateHandle < 0) {
+    ALBANY_PANIC(
+        (workset.stateArrayPtr->find(stateName) == workset.stateArrayPtr->end()),
+        std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
+  }
 
-  ALBANY_PANIC((it == workset.stateArrayPtr->end()), std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
+  Albany::MDArray sta = workset.getStateArray(stateName, stateHandle);
+  // A handle of a state that this workset does not carry has no array behind it.
+  ALBANY_PANIC(sta.rank() == 0, std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray                         sta = it->second;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -146,12 +151,16 @@ SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::saveWorksetState(typename
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  if (stateHandle < 0) {
+    ALBANY_PANIC(
+        (workset.stateArrayPtr->find(stateName) == workset.stateArrayPtr->end()),
+        std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
+  }
 
-  ALBANY_PANIC((it == workset.stateArrayPtr->end()), std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
+  Albany::MDArray sta = workset.getStateArray(stateName, stateHandle);
+  // A handle of a state that this workset does not carry has no array behind it.
+  ALBANY_PANIC(sta.rank() == 0, std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray                         sta = it->second;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -152,6 +152,7 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
 
   validPL->set<bool>("Use MDField Memoization", false, "Use memoization to avoid recomputing MDFields");
   validPL->set<bool>("Use MDField Memoization For Parameters", false, "Use memoization to avoid recomputing MDFields dependent on parameters");
+  validPL->set<bool>("Double-Buffered States", false, "Swap current and old state arrays at each accepted step instead of copying them");
   validPL->set<bool>(
       "Ignore Residual In Jacobian",
       false,
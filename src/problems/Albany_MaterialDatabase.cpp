@@ -287,6 +287,17 @@ MaterialDatabase::getElementBlockSublist(std::string const& eb_name, std::string
   return mat_sublist.sublist(sublist_name);
 }
 
+std::vector<std::string>
+MaterialDatabase::getElementBlockNames() const
+{
+  std::vector<std::string> names;
+  if (p_eb_list_ == nullptr) return names;
+  for (auto it = p_eb_list_->begin(); it != p_eb_list_->end(); ++it) {
+    if (p_eb_list_->isSublist(p_eb_list_->name(it)) == true) names.push_back(p_eb_list_->name(it));
+  }
+  return names;
+}
+
 template <typename T>
 std::vector<T>
 MaterialDatabase::getAllMatchingParams(std::string const& param_name)
@@ -73,6 +73,10 @@ class MaterialDatabase
   Teuchos::ParameterList&
   getElementBlockSublist(std::string const& eb_name, std::string const& sublist_name);
 
+  //! Get the names of all element blocks in the database
+  std::vector<std::string>
+  getElementBlockNames() const;
+
   //! Get a vector of the value of all parameters in the entire list with name
   //! == param_name
   template <typename T>
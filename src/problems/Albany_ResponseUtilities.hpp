@@ -5,6 +5,7 @@
 #ifndef ALBANY_RESPONSE_UTILITIES_HPP
 #define ALBANY_RESPONSE_UTILITIES_HPP
 
+#include <Phalanx_Evaluator.hpp>
 #include <Phalanx_FieldManager.hpp>
 #include <Phalanx_FieldTag.hpp>
 #include <Teuchos_ParameterList.hpp>
@@ -19,6 +20,17 @@ namespace Albany {
 
 class StateManager;
 
+//! Residual field manager of an element block and the response evaluator
+//! registered in it, for a response evaluated during the residual fill.
+//! Passed to constructResponses in the response parameter list as
+//! "Residual Response".
+struct ResidualResponse
+{
+  Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>> fm;
+
+  Teuchos::RCP<PHX::Evaluator<PHAL::AlbanyTraits>> evaluator;
+};
+
 /*!
  * \brief Abstract interface for representing a 1-D finite element
  * problem.
@@ -59,6 +71,14 @@ class ResponseUtilities
   };
 
  private:
+  //! Create the evaluator for the response named in responseList
+  Teuchos::RCP<PHX::Evaluator<Traits>>
+  createResponseEvaluator(
+      Teuchos::ParameterList&              responseList,
+      Teuchos::RCP<Teuchos::ParameterList> paramsFromProblem,
+      Albany::StateManager&                stateMgr,
+      Albany::MeshSpecsStruct const*       meshSpecs);
+
   //! Struct of PHX::DataLayout objects defined all together.
   Teuchos::RCP<Albany::Layouts>                        dl;
   std::map<std::string, Teuchos::RCP<Albany::Layouts>> dls;  // Different sides may have different layouts (b/c
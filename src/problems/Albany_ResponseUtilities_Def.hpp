@@ -1,6 +1,8 @@
 // Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
+#include <type_traits>
+
 #include "Adapt_ElementSizeField.hpp"
 #include "Albany_ResponseUtilities.hpp"
 #include "Albany_Utils.hpp"
@@ -18,13 +20,12 @@ Albany::ResponseUtilities<EvalT, Traits>::ResponseUtilities(Teuchos::RCP<Albany:
 }
 
 template <typename EvalT, typename Traits>
-Teuchos::RCP<const PHX::FieldTag>
-Albany::ResponseUtilities<EvalT, Traits>::constructResponses(
-    PHX::FieldManager<PHAL::AlbanyTraits>& fm,
-    Teuchos::ParameterList&                responseParams,
-    Teuchos::RCP<Teuchos::ParameterList>   paramsFromProblem,
-    Albany::StateManager&                  stateMgr,
-    Albany::MeshSpecsStruct const*         meshSpecs)
+Teuchos::RCP<PHX::Evaluator<Traits>>
+Albany::ResponseUtilities<EvalT, Traits>::createResponseEvaluator(
+    Teuchos::ParameterList&              responseParams,
+    Teuchos::RCP<Teuchos::ParameterList> paramsFromProblem,
+    Albany::StateManager&                stateMgr,
+    Albany::MeshSpecsStruct const*       meshSpecs)
 {
   using PHX::DataLayout;
   using Teuchos::ParameterList;
@@ -109,6 +110,29 @@ Albany::ResponseUtilities<EvalT, Traits>::constructResponses(
         << "Supplied parameter list is " << std::endl
         << responseParams);
 
+  return res_ev;
+}
+
+template <typename EvalT, typename Traits>
+Teuchos::RCP<const PHX::FieldTag>
+Albany::ResponseUtilities<EvalT, Traits>::constructResponses(
+    PHX::FieldManager<PHAL::AlbanyTraits>& fm,
+    Teuchos::ParameterList&                responseParams,
+    Teuchos::RCP<Teuchos::ParameterList>   paramsFromProblem,
+    Albany::StateManager&                  stateMgr,
+    Albany::MeshSpecsStruct const*         meshSpecs)
+{
+  // Take out the residual field manager of a response evaluated with the
+  // residual, the response evaluators do not accept it.
+  char const*                            rr_parm = "Residual Response";
+  Teuchos::RCP<Albany::ResidualResponse> resid_response;
+  if (responseParams.isType<Teuchos::RCP<Albany::ResidualResponse>>(rr_parm)) {
+    resid_response = responseParams.get<Teuchos::RCP<Albany::ResidualResponse>>(rr_parm);
+    responseParams.remove(rr_parm, false);
+  }
+
+  Teuchos::RCP<PHX::Evaluator<Traits>> res_ev = createResponseEvaluator(responseParams, paramsFromProblem, stateMgr, meshSpecs);
+
   // Register the evaluator
   fm.template registerEvaluator<EvalT>(res_ev);
 
@@ -126,5 +150,17 @@ Albany::ResponseUtilities<EvalT, Traits>::constructResponses(
   // Require the response tag;
   fm.requireField<EvalT>(*ev_tag);
 
+  // A response evaluated with the residual also gets its own instance of the
+  // evaluator in the residual field manager, where it runs on the fields of
+  // the residual fill.
+  if (resid_response != Teuchos::null) {
+    if (std::is_same<EvalT, PHAL::AlbanyTraits::Residual>::value == true) {
+      resid_response->evaluator = createResponseEvaluator(responseParams, paramsFromProblem, stateMgr, meshSpecs);
+      resid_response->fm->template registerEvaluator<EvalT>(resid_response->evaluator);
+      resid_response->fm->template requireField<EvalT>(*ev_tag);
+    }
+    responseParams.set<Teuchos::RCP<Albany::ResidualResponse>>(rr_parm, resid_response);
+  }
+
   return ev_tag;
 }
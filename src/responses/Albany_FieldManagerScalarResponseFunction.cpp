@@ -8,6 +8,7 @@
 #include "Albany_Application.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_MeshSpecs.hpp"
+#include "Albany_ResponseUtilities.hpp"
 #include "Albany_StateManager.hpp"
 #include "PHAL_Utilities.hpp"
 
@@ -83,12 +84,52 @@ FieldManagerScalarResponseFunction::setup(Teuchos::ParameterList& responseParams
   if (reb_parm_present) {
     responseParams.remove(reb_parm, false);
   }
+
+  // Evaluate during the residual fill? Only responses that are plain sums
+  // over the cells can have their reduction deferred.
+  char const* ewr_parm         = "Evaluate With Residual";
+  bool const  ewr_parm_present = responseParams.isType<bool>(ewr_parm), ewr = ewr_parm_present && responseParams.get<bool>(ewr_parm, false);
+  if (ewr_parm_present) {
+    responseParams.remove(ewr_parm, false);
+  }
+  if (ewr == true) {
+    std::string const& name = responseParams.get<std::string>("Name");
+    bool const         summed =
+        name == "PHAL Field Integral" || name == "PHAL Field IntegralT" || name == "PHAL Thermal Energy" || name == "PHAL Thermal EnergyT" ||
+        name.compare(0, 21, "Squared L2 Difference") == 0;
+    ALBANY_PANIC(summed == false, "Response " << name << " cannot be evaluated with the residual" << std::endl);
+    ALBANY_PANIC(
+        reb == false && meshSpecs->ebNameToIndex.size() > 1,
+        "Response " << name << " must be restricted to its element block to be evaluated with the residual" << std::endl);
+  }
+
+  // Responses are evaluated on the solution as given, so with strong
+  // Dirichlet conditions, which modify it for the residual fill, the response
+  // is left to its own fill and nothing is added to the residual graph.
+  fused = ewr == true && (problem->useSDBCs() == false || problem->getDirichletFieldManager().is_null() == true);
+
   // Create field manager
   rfm = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
 
+  // A response evaluated with the residual also registers its evaluator in
+  // the residual field manager of the element block
+  char const*                    rr_parm = "Residual Response";
+  Teuchos::RCP<ResidualResponse> resid_response;
+  if (fused == true) {
+    resid_response     = Teuchos::rcp(new ResidualResponse);
+    resid_response->fm = problem->getFieldManager()[meshSpecs->ebNameToIndex[meshSpecs->ebName]];
+    responseParams.set<Teuchos::RCP<ResidualResponse>>(rr_parm, resid_response);
+  }
+
   // Create evaluators for field manager
   Teuchos::Array<Teuchos::RCP<const PHX::FieldTag>> tags =
       problem->buildEvaluators(*rfm, *meshSpecs, *stateMgr, BUILD_RESPONSE_FM, Teuchos::rcp(&responseParams, false));
+
+  if (fused == true) {
+    fused_evaluator = resid_response->evaluator;
+    responseParams.remove(rr_parm, false);
+  }
+
   int rank      = tags[0]->dataLayout().rank();
   num_responses = tags[0]->dataLayout().extent(rank - 1);
   if (num_responses == 0) {
@@ -101,6 +142,7 @@ FieldManagerScalarResponseFunction::setup(Teuchos::ParameterList& responseParams
 
   if (phx_graph_parm_present) responseParams.set<int>(phx_graph_parm, vis_response_graph);
   if (reb_parm_present) responseParams.set<bool>(reb_parm, reb);
+  if (ewr_parm_present) responseParams.set<bool>(ewr_parm, ewr);
 }
 
 template <typename EvalT>
@@ -207,6 +249,12 @@ FieldManagerScalarResponseFunction::evaluateResponse(
           << "Post registration setup not performed in field manager " << std::endl
           << "Forgot to call \"postRegSetup\"? ");
 
+  // Reuse the values computed during the residual fill of this evaluation
+  if (fused_state == application->getSolutionState()) {
+    g->assign(*fused_g);
+    return;
+  }
+
   // Set data in Workset struct
   PHAL::Workset workset;
   application->setupBasicWorksetInfo(workset, current_time, x, xdot, xdotdot, p);
@@ -216,6 +264,35 @@ FieldManagerScalarResponseFunction::evaluateResponse(
   evaluate<PHAL::AlbanyTraits::Residual>(workset);
 }
 
+void
+FieldManagerScalarResponseFunction::fusedPreEvaluate(PHAL::Workset& workset)
+{
+  if (fused_g.is_null()) fused_g = Thyra::createMember(responseVectorSpace());
+  fused_g->assign(0.0);
+
+  Teuchos::RCP<Thyra_Vector> const g = workset.g;
+  workset.g                          = fused_g;
+  fused_evaluator->preEvaluate(workset);
+  workset.g = g;
+}
+
+void
+FieldManagerScalarResponseFunction::fusedPostEvaluate(PHAL::Workset& workset)
+{
+  Teuchos::RCP<Thyra_Vector> const g = workset.g;
+  workset.g                          = fused_g;
+  workset.defer_response_reduction   = true;
+  fused_evaluator->postEvaluate(workset);
+  workset.defer_response_reduction = false;
+  workset.g                        = g;
+}
+
+void
+FieldManagerScalarResponseFunction::markFusedCurrent()
+{
+  fused_state = application->getSolutionState();
+}
+
 void
 FieldManagerScalarResponseFunction::evaluateGradient(
     double const                            current_time,
@@ -8,6 +8,7 @@
 #include "Albany_ScalarResponseFunction.hpp"
 #include "Albany_StateInfoStruct.hpp"  // contains MeshSpecsStuct
 #include "PHAL_AlbanyTraits.hpp"
+#include "Phalanx_Evaluator.hpp"
 #include "Phalanx_FieldManager.hpp"
 
 namespace Albany {
@@ -69,6 +70,37 @@ class FieldManagerScalarResponseFunction : public ScalarResponseFunction
       Teuchos::RCP<Thyra_MultiVector> const&  dg_dxdotdot,
       Teuchos::RCP<Thyra_MultiVector> const&  dg_dp);
 
+  //! Whether the response is evaluated during the residual fill
+  bool
+  isFused() const
+  {
+    return fused;
+  }
+
+  //! \name Evaluation during the residual fill
+  //! The response evaluator runs in the residual field manager of the
+  //! element block, Application calls these around its workset loop. The
+  //! values are left as local partial sums in fusedValues() until
+  //! Application has reduced them, after which markFusedCurrent() lets
+  //! evaluateResponse return them until the solution state of Application
+  //! changes.
+  //@{
+  void
+  fusedPreEvaluate(PHAL::Workset& workset);
+
+  void
+  fusedPostEvaluate(PHAL::Workset& workset);
+
+  Teuchos::RCP<Thyra_Vector> const&
+  fusedValues() const
+  {
+    return fused_g;
+  }
+
+  void
+  markFusedCurrent();
+  //@}
+
  protected:
   //! Constructor for derived classes
   /*!
@@ -138,6 +170,13 @@ class FieldManagerScalarResponseFunction : public ScalarResponseFunction
   int element_block_index;
 
   bool performedPostRegSetup;
+
+  //! Evaluated during the residual fill by fused_evaluator, with the values
+  //! kept in fused_g for the solution state fused_state of Application
+  bool                                             fused{false};
+  Teuchos::RCP<PHX::Evaluator<PHAL::AlbanyTraits>> fused_evaluator;
+  Teuchos::RCP<Thyra_Vector>                       fused_g;
+  unsigned long long                               fused_state{0};
 };
 
 }  // namespace Albany
@@ -111,7 +111,10 @@ Albany::ResponseFactory::createResponseFunction(
     for (int i = 0; i < meshSpecs.size(); i++) {
       // Skip if dealing with interface block
       // if (meshSpecs[i]->ebName == "Surface Element") continue;
-      responses.push_back(rcp(new Albany::FieldManagerScalarResponseFunction(app, prob, meshSpecs[i], stateMgr, responseParams)));
+      RCP<Albany::FieldManagerScalarResponseFunction> response =
+          rcp(new Albany::FieldManagerScalarResponseFunction(app, prob, meshSpecs[i], stateMgr, responseParams));
+      if (response->isFused() == true) app->addFusedResponse(response);
+      responses.push_back(response);
     }
   }
 
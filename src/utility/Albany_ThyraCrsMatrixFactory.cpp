@@ -1,5 +1,7 @@
 #include "Albany_ThyraCrsMatrixFactory.hpp"
 
+#include <algorithm>
+
 #include "Albany_Macros.hpp"
 #include "Albany_TpetraTypes.hpp"
 #include "Albany_Utils.hpp"
@@ -69,33 +71,63 @@ ThyraCrsMatrixFactory::insertGlobalIndices(const GO row, const Teuchos::ArrayVie
   }
 }
 
+void
+ThyraCrsMatrixFactory::setLocalGraph(std::vector<std::size_t>&& row_offsets, std::vector<GO>&& cols)
+{
+  ALBANY_PANIC(m_filled, "Error! Cannot set the local graph after fillComplete has been called.\n");
+  ALBANY_PANIC(
+      row_offsets.size() != t_local_graph.size() + 1,
+      "Error! Row offsets size (" << row_offsets.size() << ") does not match the number of local rows + 1 ("
+                                  << t_local_graph.size() + 1 << ").\n");
+  ALBANY_PANIC(row_offsets.back() != cols.size(), "Error! Last row offset does not match the number of column indices.\n");
+
+  t_bulk_offsets = std::move(row_offsets);
+  t_bulk_cols    = std::move(cols);
+}
+
 void
 ThyraCrsMatrixFactory::fillComplete()
 {
   // We created the CrsGraph,
-  // insert indices from the temporary local graph,
-  // and call fill complete.
+  // insert indices from the temporary local graph (and from the bulk CSR
+  // graph, if one was set), and call fill complete.
   Teuchos::ArrayRCP<size_t> nonzeros_per_row_array(t_range->getLocalNumElements());
 
+  bool const has_bulk = !t_bulk_offsets.empty();
   for (int lrow = 0; lrow < nonzeros_per_row_array.size(); ++lrow) {
     nonzeros_per_row_array[lrow] = t_local_graph[lrow].size();
+    if (has_bulk) nonzeros_per_row_array[lrow] += t_bulk_offsets[lrow + 1] - t_bulk_offsets[lrow];
   }
 
   m_graph->t_graph = Teuchos::rcp(new Tpetra_CrsGraph(t_range, nonzeros_per_row_array()));
 
+  // Each row is inserted with a single call, with its indices already sorted
+  // and unique. Rows present in both graphs are merged first.
+  Teuchos::Array<Tpetra_GO> t_indices;
   for (int lrow = 0; lrow < nonzeros_per_row_array.size(); ++lrow) {
-    auto& row_indices = t_local_graph[lrow];
-    if (row_indices.size() > 0) {
-      Teuchos::Array<Tpetra_GO> t_indices(row_indices.size());
-      int                       i = 0;
-      for (const auto& index : row_indices) t_indices[i++] = index;
-      auto row = t_range->getGlobalElement(lrow);
-
-      m_graph->t_graph->insertGlobalIndices(row, t_indices);
+    auto&      row_indices = t_local_graph[lrow];
+    auto const bulk_begin  = has_bulk ? t_bulk_offsets[lrow] : 0;
+    auto const bulk_end    = has_bulk ? t_bulk_offsets[lrow + 1] : 0;
+    if (row_indices.empty() && bulk_begin == bulk_end) continue;
+
+    t_indices.resize(bulk_end - bulk_begin);
+    for (auto k = bulk_begin; k < bulk_end; ++k) t_indices[k - bulk_begin] = static_cast<Tpetra_GO>(t_bulk_cols[k]);
+    if (!row_indices.empty()) {
+      auto const middle = t_indices.size();
+      t_indices.insert(t_indices.end(), row_indices.begin(), row_indices.end());
+      std::inplace_merge(t_indices.begin(), t_indices.begin() + middle, t_indices.end());
+      t_indices.erase(std::unique(t_indices.begin(), t_indices.end()), t_indices.end());
     }
+    auto row = t_range->getGlobalElement(lrow);
+
+    m_graph->t_graph->insertGlobalIndices(row, t_indices());
   }
 
   t_local_graph.clear();
+  t_bulk_offsets.clear();
+  t_bulk_cols.clear();
+  t_bulk_offsets.shrink_to_fit();
+  t_bulk_cols.shrink_to_fit();
   auto t_domain = getTpetraMap(m_domain_vs);
   m_graph->t_graph->fillComplete(t_domain, t_range);
   t_range.reset();
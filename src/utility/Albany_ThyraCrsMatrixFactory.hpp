@@ -2,6 +2,7 @@
 #define ALBANY_THYRA_CRS_MATRIX_FACTORY_HPP
 
 #include <set>
+#include <vector>
 
 #include "Albany_ThyraTypes.hpp"
 #include "Albany_TpetraThyraUtils.hpp"
@@ -44,6 +45,14 @@ struct ThyraCrsMatrixFactory
   void
   insertGlobalIndices(const GO row, const Teuchos::ArrayView<const GO>& indices);
 
+  // Hands the whole local graph over at once, in CSR form: the (global)
+  // column indices of the local row lrow of the range vector space are
+  // cols[row_offsets[lrow]], ..., cols[row_offsets[lrow+1]-1], and must be
+  // sorted and without duplicates. Indices inserted via insertGlobalIndices
+  // (before or after this call) are merged in when fillComplete is called.
+  void
+  setLocalGraph(std::vector<std::size_t>&& row_offsets, std::vector<GO>&& cols);
+
   // Creates the CrsGraph,
   // inserting indices from the temporary local graph,
   // and calls fillComplete.
@@ -81,6 +90,8 @@ struct ThyraCrsMatrixFactory
   Teuchos::RCP<Thyra_VectorSpace const> m_range_vs;
 
   std::vector<std::set<Tpetra_GO>> t_local_graph;
+  std::vector<std::size_t>         t_bulk_offsets;
+  std::vector<GO>                  t_bulk_cols;
   Teuchos::RCP<const Tpetra_Map>   t_range;
 
   bool m_filled;